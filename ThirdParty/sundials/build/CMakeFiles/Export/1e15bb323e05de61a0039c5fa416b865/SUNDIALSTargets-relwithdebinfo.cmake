@@ -0,0 +1,179 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "RelWithDebInfo".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "SUNDIALS::generic_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::generic_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::generic_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_generic.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::generic_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::generic_static "${_IMPORT_PREFIX}/lib/libsundials_generic.a" )
+
+# Import target "SUNDIALS::nvecserial_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::nvecserial_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::nvecserial_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_nvecserial.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::nvecserial_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::nvecserial_static "${_IMPORT_PREFIX}/lib/libsundials_nvecserial.a" )
+
+# Import target "SUNDIALS::sunmatrixband_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunmatrixband_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunmatrixband_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixband.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunmatrixband_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunmatrixband_static "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixband.a" )
+
+# Import target "SUNDIALS::sunmatrixdense_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunmatrixdense_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunmatrixdense_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixdense.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunmatrixdense_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunmatrixdense_static "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixdense.a" )
+
+# Import target "SUNDIALS::sunmatrixsparse_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunmatrixsparse_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunmatrixsparse_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixsparse.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunmatrixsparse_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunmatrixsparse_static "${_IMPORT_PREFIX}/lib/libsundials_sunmatrixsparse.a" )
+
+# Import target "SUNDIALS::sunlinsolband_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolband_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolband_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolband.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolband_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolband_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolband.a" )
+
+# Import target "SUNDIALS::sunlinsoldense_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsoldense_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsoldense_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsoldense.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsoldense_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsoldense_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsoldense.a" )
+
+# Import target "SUNDIALS::sunlinsolpcg_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolpcg_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolpcg_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolpcg.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolpcg_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolpcg_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolpcg.a" )
+
+# Import target "SUNDIALS::sunlinsolspbcgs_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolspbcgs_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolspbcgs_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspbcgs.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolspbcgs_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolspbcgs_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspbcgs.a" )
+
+# Import target "SUNDIALS::sunlinsolspfgmr_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolspfgmr_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolspfgmr_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspfgmr.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolspfgmr_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolspfgmr_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspfgmr.a" )
+
+# Import target "SUNDIALS::sunlinsolspgmr_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolspgmr_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolspgmr_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspgmr.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolspgmr_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolspgmr_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolspgmr.a" )
+
+# Import target "SUNDIALS::sunlinsolsptfqmr_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolsptfqmr_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolsptfqmr_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolsptfqmr.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolsptfqmr_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolsptfqmr_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolsptfqmr.a" )
+
+# Import target "SUNDIALS::sunlinsolklu_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunlinsolklu_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunlinsolklu_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolklu.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunlinsolklu_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunlinsolklu_static "${_IMPORT_PREFIX}/lib/libsundials_sunlinsolklu.a" )
+
+# Import target "SUNDIALS::sunnonlinsolnewton_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunnonlinsolnewton_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunnonlinsolnewton_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunnonlinsolnewton.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunnonlinsolnewton_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunnonlinsolnewton_static "${_IMPORT_PREFIX}/lib/libsundials_sunnonlinsolnewton.a" )
+
+# Import target "SUNDIALS::sunnonlinsolfixedpoint_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::sunnonlinsolfixedpoint_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::sunnonlinsolfixedpoint_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_sunnonlinsolfixedpoint.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::sunnonlinsolfixedpoint_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::sunnonlinsolfixedpoint_static "${_IMPORT_PREFIX}/lib/libsundials_sunnonlinsolfixedpoint.a" )
+
+# Import target "SUNDIALS::cvodes_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::cvodes_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::cvodes_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_cvodes.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::cvodes_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::cvodes_static "${_IMPORT_PREFIX}/lib/libsundials_cvodes.a" )
+
+# Import target "SUNDIALS::idas_static" for configuration "RelWithDebInfo"
+set_property(TARGET SUNDIALS::idas_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(SUNDIALS::idas_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELWITHDEBINFO "C"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/libsundials_idas.a"
+  )
+
+list(APPEND _cmake_import_check_targets SUNDIALS::idas_static )
+list(APPEND _cmake_import_check_files_for_SUNDIALS::idas_static "${_IMPORT_PREFIX}/lib/libsundials_idas.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
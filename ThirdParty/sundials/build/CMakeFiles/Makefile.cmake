@@ -0,0 +1,229 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/ThirdParty/sundials/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SUNDIALSConfig.cmake.in"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsBuildOptionsPost.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsBuildOptionsPre.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsDeprecated.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsExampleOptions.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsIndexSize.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsSetupCompilers.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsSetupConfig.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsSetupTPLs.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/SundialsTPLOptions.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsAddLibrary.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsAddTest.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsAddTestInstall.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsCMakeMacros.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsInstallExamples.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/macros/SundialsOption.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/tpl/FindKLU.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/tpl/SundialsKLU.cmake"
+  "/root/repo/ThirdParty/sundials/cmake/tpl/SundialsPOSIXTimers.cmake"
+  "/root/repo/ThirdParty/sundials/include/sundials/sundials_config.in"
+  "/root/repo/ThirdParty/sundials/include/sundials/sundials_fconfig.in"
+  "/root/repo/ThirdParty/sundials/src/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/cvodes/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/idas/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/nvector/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/nvector/serial/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sundials/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/band/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/dense/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/klu/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/pcg/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/spbcgs/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/spfgmr/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/spgmr/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunlinsol/sptfqmr/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunmatrix/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunmatrix/band/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunmatrix/dense/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunmatrix/sparse/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunmemory/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunnonlinsol/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunnonlinsol/fixedpoint/CMakeLists.txt"
+  "/root/repo/ThirdParty/sundials/src/sunnonlinsol/newton/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "include/sundials/sundials_config.h"
+  "include/sundials/sundials_fconfig.h"
+  "SUNDIALSConfigVersion.cmake"
+  "SUNDIALSConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/sundials/sundials_export.h"
+  "src/sundials/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nvector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nvector/serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunmatrix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunmatrix/band/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunmatrix/dense/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunmatrix/sparse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/band/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/dense/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/pcg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/spbcgs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/spfgmr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/spgmr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/sptfqmr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunlinsol/klu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunnonlinsol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunnonlinsol/newton/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunnonlinsol/fixedpoint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sunmemory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cvodes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/idas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/DependInfo.cmake"
+  "src/sundials/CMakeFiles/sundials_generic_static.dir/DependInfo.cmake"
+  "src/nvector/serial/CMakeFiles/sundials_nvecserial_obj_static.dir/DependInfo.cmake"
+  "src/nvector/serial/CMakeFiles/sundials_nvecserial_static.dir/DependInfo.cmake"
+  "src/sunmatrix/band/CMakeFiles/sundials_sunmatrixband_obj_static.dir/DependInfo.cmake"
+  "src/sunmatrix/band/CMakeFiles/sundials_sunmatrixband_static.dir/DependInfo.cmake"
+  "src/sunmatrix/dense/CMakeFiles/sundials_sunmatrixdense_obj_static.dir/DependInfo.cmake"
+  "src/sunmatrix/dense/CMakeFiles/sundials_sunmatrixdense_static.dir/DependInfo.cmake"
+  "src/sunmatrix/sparse/CMakeFiles/sundials_sunmatrixsparse_obj_static.dir/DependInfo.cmake"
+  "src/sunmatrix/sparse/CMakeFiles/sundials_sunmatrixsparse_static.dir/DependInfo.cmake"
+  "src/sunlinsol/band/CMakeFiles/sundials_sunlinsolband_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/band/CMakeFiles/sundials_sunlinsolband_static.dir/DependInfo.cmake"
+  "src/sunlinsol/dense/CMakeFiles/sundials_sunlinsoldense_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/dense/CMakeFiles/sundials_sunlinsoldense_static.dir/DependInfo.cmake"
+  "src/sunlinsol/pcg/CMakeFiles/sundials_sunlinsolpcg_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/pcg/CMakeFiles/sundials_sunlinsolpcg_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spbcgs/CMakeFiles/sundials_sunlinsolspbcgs_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spbcgs/CMakeFiles/sundials_sunlinsolspbcgs_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spfgmr/CMakeFiles/sundials_sunlinsolspfgmr_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spfgmr/CMakeFiles/sundials_sunlinsolspfgmr_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spgmr/CMakeFiles/sundials_sunlinsolspgmr_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/spgmr/CMakeFiles/sundials_sunlinsolspgmr_static.dir/DependInfo.cmake"
+  "src/sunlinsol/sptfqmr/CMakeFiles/sundials_sunlinsolsptfqmr_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/sptfqmr/CMakeFiles/sundials_sunlinsolsptfqmr_static.dir/DependInfo.cmake"
+  "src/sunlinsol/klu/CMakeFiles/sundials_sunlinsolklu_obj_static.dir/DependInfo.cmake"
+  "src/sunlinsol/klu/CMakeFiles/sundials_sunlinsolklu_static.dir/DependInfo.cmake"
+  "src/sunnonlinsol/newton/CMakeFiles/sundials_sunnonlinsolnewton_obj_static.dir/DependInfo.cmake"
+  "src/sunnonlinsol/newton/CMakeFiles/sundials_sunnonlinsolnewton_static.dir/DependInfo.cmake"
+  "src/sunnonlinsol/fixedpoint/CMakeFiles/sundials_sunnonlinsolfixedpoint_obj_static.dir/DependInfo.cmake"
+  "src/sunnonlinsol/fixedpoint/CMakeFiles/sundials_sunnonlinsolfixedpoint_static.dir/DependInfo.cmake"
+  "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/DependInfo.cmake"
+  "src/cvodes/CMakeFiles/sundials_cvodes_static.dir/DependInfo.cmake"
+  "src/idas/CMakeFiles/sundials_idas_obj_static.dir/DependInfo.cmake"
+  "src/idas/CMakeFiles/sundials_idas_static.dir/DependInfo.cmake"
+  )
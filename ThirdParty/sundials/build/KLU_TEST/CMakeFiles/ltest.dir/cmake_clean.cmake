@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ltest.dir/ltest.c.o"
+  "ltest"
+  "ltest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ltest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
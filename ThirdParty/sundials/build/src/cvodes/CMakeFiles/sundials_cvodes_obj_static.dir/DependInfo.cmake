@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodea.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodea.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodea.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodea_io.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodea_io.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodea_io.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_bandpre.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bandpre.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bandpre.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_bbdpre.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bbdpre.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bbdpre.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_diag.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_diag.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_diag.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_direct.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_direct.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_direct.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_io.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_io.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_io.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_ls.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_ls.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_ls.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_nls.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_nls_sim.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_sim.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_sim.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_nls_stg.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_nls_stg1.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg1.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg1.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/cvodes/cvodes_spils.c" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_spils.c.o" "gcc" "src/cvodes/CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_spils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodea.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodea.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodea_io.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodea_io.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bandpre.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bandpre.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bbdpre.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_bbdpre.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_diag.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_diag.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_direct.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_direct.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_io.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_io.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_ls.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_ls.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_sim.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_sim.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg1.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_nls_stg1.c.o.d"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_spils.c.o"
+  "CMakeFiles/sundials_cvodes_obj_static.dir/cvodes_spils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_cvodes_obj_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
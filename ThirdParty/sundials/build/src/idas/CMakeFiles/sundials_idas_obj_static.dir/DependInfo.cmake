@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/sundials/src/idas/idaa.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idaa.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idaa.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idaa_io.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idaa_io.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idaa_io.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_bbdpre.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_bbdpre.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_bbdpre.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_direct.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_direct.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_direct.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_ic.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_ic.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_ic.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_io.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_io.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_io.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_ls.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_ls.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_ls.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_nls.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_nls_sim.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls_sim.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls_sim.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_nls_stg.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls_stg.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_nls_stg.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/idas/idas_spils.c" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_spils.c.o" "gcc" "src/idas/CMakeFiles/sundials_idas_obj_static.dir/idas_spils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
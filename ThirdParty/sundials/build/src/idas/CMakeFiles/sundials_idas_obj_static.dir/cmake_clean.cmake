@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sundials_idas_obj_static.dir/idaa.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idaa.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idaa_io.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idaa_io.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_bbdpre.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_bbdpre.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_direct.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_direct.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_ic.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_ic.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_io.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_io.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_ls.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_ls.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls_sim.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls_sim.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls_stg.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_nls_stg.c.o.d"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_spils.c.o"
+  "CMakeFiles/sundials_idas_obj_static.dir/idas_spils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_idas_obj_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sundials_nvecserial_obj_static.dir/nvector_serial.c.o"
+  "CMakeFiles/sundials_nvecserial_obj_static.dir/nvector_serial.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_nvecserial_obj_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_band.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_band.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_band.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_dense.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_dense.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_dense.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_direct.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_direct.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_direct.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_futils.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_futils.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_futils.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_iterative.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_iterative.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_iterative.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_linearsolver.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_linearsolver.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_linearsolver.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_math.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_math.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_math.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_matrix.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_matrix.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_matrix.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_memory.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_memory.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_memory.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_nonlinearsolver.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nonlinearsolver.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nonlinearsolver.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_nvector.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_nvector_senswrapper.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector_senswrapper.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector_senswrapper.c.o.d"
+  "/root/repo/ThirdParty/sundials/src/sundials/sundials_version.c" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_version.c.o" "gcc" "src/sundials/CMakeFiles/sundials_generic_obj_static.dir/sundials_version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_band.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_band.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_dense.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_dense.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_direct.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_direct.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_futils.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_futils.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_iterative.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_iterative.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_linearsolver.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_linearsolver.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_math.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_math.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_matrix.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_matrix.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_memory.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_memory.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nonlinearsolver.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nonlinearsolver.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector_senswrapper.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_nvector_senswrapper.c.o.d"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_version.c.o"
+  "CMakeFiles/sundials_generic_obj_static.dir/sundials_version.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_generic_obj_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,74 @@
+# Install script for directory: /root/repo/ThirdParty/sundials/src/sundials
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/root/repo/ThirdParty/sundials/build")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  MESSAGE("
+Install shared components
+")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/ThirdParty/sundials/build/src/sundials/libsundials_generic.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/sundials" TYPE FILE FILES
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_band.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_dense.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_direct.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_fnvector.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_futils.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_iterative.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_linearsolver.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_math.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_matrix.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_memory.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_nonlinearsolver.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_mpi_types.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_nvector.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_types.h"
+    "/root/repo/ThirdParty/sundials/include/sundials/sundials_version.h"
+    )
+endif()
+
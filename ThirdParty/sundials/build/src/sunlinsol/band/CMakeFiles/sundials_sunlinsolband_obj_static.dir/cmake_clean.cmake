@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sundials_sunlinsolband_obj_static.dir/sunlinsol_band.c.o"
+  "CMakeFiles/sundials_sunlinsolband_obj_static.dir/sunlinsol_band.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_sunlinsolband_obj_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libsundials_sunlinsolklu.a"
+  "libsundials_sunlinsolklu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_sunlinsolklu_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libsundials_sunlinsolklu.a"
+)
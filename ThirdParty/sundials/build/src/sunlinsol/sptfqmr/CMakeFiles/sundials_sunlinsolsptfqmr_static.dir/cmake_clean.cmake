@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libsundials_sunlinsolsptfqmr.a"
+  "libsundials_sunlinsolsptfqmr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_sunlinsolsptfqmr_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
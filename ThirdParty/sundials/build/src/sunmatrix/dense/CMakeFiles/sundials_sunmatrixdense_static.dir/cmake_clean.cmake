@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libsundials_sunmatrixdense.a"
+  "libsundials_sunmatrixdense.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sundials_sunmatrixdense_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
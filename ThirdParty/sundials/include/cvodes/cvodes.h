@@ -518,6 +518,8 @@ SUNDIALS_EXPORT int CVodeB(void *cvode_mem, realtype tBout, int itaskB);
 /* Optional Input Functions For Adjoint Problems */
 
 SUNDIALS_EXPORT int CVodeSetAdjNoSensi(void *cvode_mem);
+SUNDIALS_EXPORT int CVodeSetAdjSpillCheckpoints(void *cvode_mem,
+                                                booleantype spill);
 
 SUNDIALS_EXPORT int CVodeSetUserDataB(void *cvode_mem, int which,
                                       void *user_dataB);
@@ -51,6 +51,11 @@
 static CkpntMem CVAckpntInit(CVodeMem cv_mem);
 static CkpntMem CVAckpntNew(CVodeMem cv_mem);
 static void CVAckpntDelete(CkpntMem *ck_memPtr);
+static int CVAckpntVectors(CkpntMem ck_mem, N_Vector **slots,
+                           booleantype *quad);
+static int CVAckpntSpill(CVodeMem cv_mem, CkpntMem ck_mem);
+static int CVAckpntLoad(CVodeMem cv_mem, CkpntMem ck_mem);
+static int CVArecordTstop(CVadjMem ca_mem, realtype tstop);
 
 static void CVAbckpbDelete(CVodeBMem *cvB_memPtr);
 
@@ -145,6 +150,15 @@ int CVodeAdjInit(void *cvode_mem, long int steps, int interp)
   /* No interpolation data is available */
   ca_mem->ca_ckpntData = NULL;
 
+  /* Modified for AMICI:
+     check points are kept in memory, no stop times recorded yet */
+  ca_mem->ca_spillCkpnts = SUNFALSE;
+  ca_mem->ca_ckpntFile = NULL;
+  ca_mem->ca_ckpntFileSize = 0;
+  ca_mem->ca_tstops = NULL;
+  ca_mem->ca_ntstops = 0;
+  ca_mem->ca_tstopsSize = 0;
+
   /* ------------------------------------
    * Initialization of interpolation data
    * ------------------------------------ */
@@ -293,6 +307,11 @@ int CVodeAdjReInit(void *cvode_mem)
   ca_mem->ca_nckpnts = 0;
   ca_mem->ca_ckpntData = NULL;
 
+  /* Modified for AMICI:
+     the scratch file is reused, recorded stop times are discarded */
+  ca_mem->ca_ckpntFileSize = 0;
+  ca_mem->ca_ntstops = 0;
+
   /* CVodeF and CVodeB not called yet */
 
   ca_mem->ca_firstCVodeFcall = SUNTRUE;
@@ -324,6 +343,13 @@ void CVodeAdjFree(void *cvode_mem)
     /* Delete check points one by one */
     while (ca_mem->ck_mem != NULL) CVAckpntDelete(&(ca_mem->ck_mem));
 
+    /* Modified for AMICI:
+       close the scratch file and free the recorded stop times */
+    if (ca_mem->ca_ckpntFile != NULL) fclose(ca_mem->ca_ckpntFile);
+    ca_mem->ca_ckpntFile = NULL;
+    free(ca_mem->ca_tstops);
+    ca_mem->ca_tstops = NULL;
+
     /* Free vectors at all data points */
     if (ca_mem->ca_IMmallocDone) {
       ca_mem->ca_IMfree(cv_mem);
@@ -410,6 +436,13 @@ int CVodeF(void *cvode_mem, realtype tout, N_Vector yout,
   if (cv_mem->cv_tstopset) {
     ca_mem->ca_tstopCVodeFcall = SUNTRUE;
     ca_mem->ca_tstopCVodeF = cv_mem->cv_tstop;
+
+    /* Modified for AMICI:
+       record all stop times, to reproduce the steps in CVAdataStore */
+    if (CVArecordTstop(ca_mem, cv_mem->cv_tstop) != CV_SUCCESS) {
+      cvProcessError(cv_mem, CV_MEM_FAIL, "CVODEA", "CVodeF", MSGCV_MEM_FAIL);
+      return(CV_MEM_FAIL);
+    }
   }
 
   /* On the first step:
@@ -532,6 +565,17 @@ int CVodeF(void *cvode_mem, realtype tout, N_Vector yout,
       ca_mem->ca_nckpnts++;
       cv_mem->cv_forceSetup = SUNTRUE;
 
+      /* Modified for AMICI:
+         keep only the new check point in memory */
+      if (ca_mem->ca_spillCkpnts) {
+        flag = CVAckpntSpill(cv_mem, tmp->ck_next);
+        if (flag != CV_SUCCESS) {
+          cvProcessError(cv_mem, CV_MEM_FAIL, "CVODEA", "CVodeF", MSGCV_MEM_FAIL);
+          flag = CV_MEM_FAIL;
+          break;
+        }
+      }
+
       /* Reset i=0 and load dt_mem[0] */
       dt_mem[0]->t = ca_mem->ck_mem->ck_t0;
       ca_mem->ca_IMstore(cv_mem, dt_mem[0]);
@@ -1637,6 +1681,10 @@ static CkpntMem CVAckpntInit(CVodeMem cv_mem)
   /* Next in list */
   ck_mem->ck_next  = NULL;
 
+  /* Modified for AMICI: not written to the scratch file */
+  ck_mem->ck_spilled = SUNFALSE;
+  ck_mem->ck_fileOffset = -1;
+
   return(ck_mem);
 }
 
@@ -1660,6 +1708,10 @@ static CkpntMem CVAckpntNew(CVodeMem cv_mem)
   /* Set cv_next to NULL */
   ck_mem->ck_next = NULL;
 
+  /* Modified for AMICI: not written to the scratch file */
+  ck_mem->ck_spilled = SUNFALSE;
+  ck_mem->ck_fileOffset = -1;
+
   /* Test if we need to allocate space for the last zn.
    * NOTE: zn(qmax) may be needed for a hot restart, if an order
    * increase is deemed necessary at the first step after a check point */
@@ -1949,6 +2001,211 @@ static void CVAckpntDelete(CkpntMem *ck_memPtr)
 
 }
 
+/*
+ * CVAckpntVectors
+ *
+ * Modified for AMICI:
+ * This routine returns the number of vectors stored at the check point
+ * ck_mem. If slots is not NULL, it is filled with the addresses of these
+ * vectors, and quad with flags whether they are quadrature vectors.
+ * The vectors are enumerated in the same way as in CVAckpntDelete.
+ */
+
+static int CVAckpntVectors(CkpntMem ck_mem, N_Vector **slots,
+                           booleantype *quad)
+{
+  int idx[L_MAX+1], nidx, ninit, j, is, n;
+
+  nidx = 0;
+  for (j=0; j<=ck_mem->ck_q; j++) idx[nidx++] = j;
+  if (ck_mem->ck_zqm != 0) idx[nidx++] = ck_mem->ck_zqm;
+
+  /* at the check point at t_initial, only the first element of the arrays
+     for quadratures and sensitivities was allocated */
+  ninit = (ck_mem->ck_next != NULL) ? nidx : 1;
+
+  n = 0;
+  for (j=0; j<nidx; j++) {
+    if (slots != NULL) {
+      slots[n] = &(ck_mem->ck_zn[idx[j]]);
+      quad[n] = SUNFALSE;
+    }
+    n++;
+  }
+  for (j=0; j<ninit; j++) {
+    if (ck_mem->ck_quadr) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_znQ[idx[j]]);
+        quad[n] = SUNTRUE;
+      }
+      n++;
+    }
+    for (is=0; ck_mem->ck_sensi && is<ck_mem->ck_Ns; is++) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_znS[idx[j]][is]);
+        quad[n] = SUNFALSE;
+      }
+      n++;
+    }
+    for (is=0; ck_mem->ck_quadr_sensi && is<ck_mem->ck_Ns; is++) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_znQS[idx[j]][is]);
+        quad[n] = SUNTRUE;
+      }
+      n++;
+    }
+  }
+
+  return(n);
+}
+
+/*
+ * CVAckpntSpill
+ *
+ * Modified for AMICI:
+ * This routine writes the vectors stored at the check point ck_mem to the
+ * scratch file, unless this was already done, and frees them.
+ */
+
+static int CVAckpntSpill(CVodeMem cv_mem, CkpntMem ck_mem)
+{
+  CVadjMem ca_mem;
+  N_Vector **slots;
+  booleantype *quad;
+  sunindextype len;
+  long int offset;
+  int n, i, flag;
+
+  if (ck_mem->ck_spilled) return(CV_SUCCESS);
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  n = CVAckpntVectors(ck_mem, NULL, NULL);
+  slots = (N_Vector **) malloc(n * sizeof(N_Vector *));
+  quad = (booleantype *) malloc(n * sizeof(booleantype));
+  if (slots == NULL || quad == NULL) {
+    free(slots); free(quad);
+    return(CV_MEM_FAIL);
+  }
+  CVAckpntVectors(ck_mem, slots, quad);
+
+  flag = CV_SUCCESS;
+
+  if (ck_mem->ck_fileOffset < 0) {
+    if (ca_mem->ca_ckpntFile == NULL) ca_mem->ca_ckpntFile = tmpfile();
+    if (ca_mem->ca_ckpntFile == NULL ||
+        fseek(ca_mem->ca_ckpntFile, ca_mem->ca_ckpntFileSize, SEEK_SET) != 0)
+      flag = CV_MEM_FAIL;
+
+    offset = ca_mem->ca_ckpntFileSize;
+    for (i=0; i<n && flag == CV_SUCCESS; i++) {
+      len = N_VGetLength(*slots[i]);
+      if (fwrite(N_VGetArrayPointer(*slots[i]), sizeof(realtype), len,
+                 ca_mem->ca_ckpntFile) != (size_t) len)
+        flag = CV_MEM_FAIL;
+      offset += len * sizeof(realtype);
+    }
+
+    if (flag == CV_SUCCESS) {
+      ck_mem->ck_fileOffset = ca_mem->ca_ckpntFileSize;
+      ca_mem->ca_ckpntFileSize = offset;
+    }
+  }
+
+  if (flag == CV_SUCCESS) {
+    for (i=0; i<n; i++) {
+      N_VDestroy(*slots[i]);
+      *slots[i] = NULL;
+    }
+    ck_mem->ck_spilled = SUNTRUE;
+  }
+
+  free(slots); free(quad);
+
+  return(flag);
+}
+
+/*
+ * CVAckpntLoad
+ *
+ * Modified for AMICI:
+ * This routine allocates the vectors of the check point ck_mem and reads
+ * them from the scratch file.
+ */
+
+static int CVAckpntLoad(CVodeMem cv_mem, CkpntMem ck_mem)
+{
+  CVadjMem ca_mem;
+  N_Vector **slots;
+  booleantype *quad;
+  sunindextype len;
+  int n, i, flag;
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  n = CVAckpntVectors(ck_mem, NULL, NULL);
+  slots = (N_Vector **) malloc(n * sizeof(N_Vector *));
+  quad = (booleantype *) malloc(n * sizeof(booleantype));
+  if (slots == NULL || quad == NULL) {
+    free(slots); free(quad);
+    return(CV_MEM_FAIL);
+  }
+  CVAckpntVectors(ck_mem, slots, quad);
+
+  flag = CV_SUCCESS;
+  if (fseek(ca_mem->ca_ckpntFile, ck_mem->ck_fileOffset, SEEK_SET) != 0)
+    flag = CV_MEM_FAIL;
+
+  for (i=0; i<n && flag == CV_SUCCESS; i++) {
+    *slots[i] = N_VClone(quad[i] ? cv_mem->cv_tempvQ : cv_mem->cv_tempv);
+    if (*slots[i] == NULL) {
+      flag = CV_MEM_FAIL;
+      break;
+    }
+    len = N_VGetLength(*slots[i]);
+    if (fread(N_VGetArrayPointer(*slots[i]), sizeof(realtype), len,
+              ca_mem->ca_ckpntFile) != (size_t) len)
+      flag = CV_MEM_FAIL;
+  }
+
+  /* vectors allocated so far are freed by CVAckpntDelete */
+  if (flag == CV_SUCCESS) ck_mem->ck_spilled = SUNFALSE;
+
+  free(slots); free(quad);
+
+  return(flag);
+}
+
+/*
+ * CVArecordTstop
+ *
+ * Modified for AMICI:
+ * This routine appends tstop to the list of stop times used in CVodeF,
+ * unless it is the same as the last one.
+ */
+
+static int CVArecordTstop(CVadjMem ca_mem, realtype tstop)
+{
+  realtype *tstops;
+  long int size;
+
+  if (ca_mem->ca_ntstops > 0 &&
+      ca_mem->ca_tstops[ca_mem->ca_ntstops-1] == tstop)
+    return(CV_SUCCESS);
+
+  if (ca_mem->ca_ntstops == ca_mem->ca_tstopsSize) {
+    size = (ca_mem->ca_tstopsSize > 0) ? 2*ca_mem->ca_tstopsSize : 16;
+    tstops = (realtype *) realloc(ca_mem->ca_tstops, size * sizeof(realtype));
+    if (tstops == NULL) return(CV_MEM_FAIL);
+    ca_mem->ca_tstops = tstops;
+    ca_mem->ca_tstopsSize = size;
+  }
+
+  ca_mem->ca_tstops[ca_mem->ca_ntstops++] = tstop;
+
+  return(CV_SUCCESS);
+}
+
 /*
  * =================================================================
  * PRIVATE FUNCTIONS FOR BACKWARD PROBLEMS
@@ -2010,7 +2267,7 @@ static int CVAdataStore(CVodeMem cv_mem, CkpntMem ck_mem)
   CVadjMem ca_mem;
   DtpntMem *dt_mem;
   realtype t;
-  long int i;
+  long int i, itstop;
   int flag, sign;
 
   ca_mem = cv_mem->cv_adj_mem;
@@ -2021,17 +2278,31 @@ static int CVAdataStore(CVodeMem cv_mem, CkpntMem ck_mem)
   if (flag != CV_SUCCESS)
     return(CV_REIFWD_FAIL);
 
+  /* Modified for AMICI:
+     the check point was copied to cv_mem and can be freed again */
+  if (ca_mem->ca_spillCkpnts && ck_mem != ca_mem->ck_mem) {
+    flag = CVAckpntSpill(cv_mem, ck_mem);
+    if (flag != CV_SUCCESS)
+      return(CV_REIFWD_FAIL);
+  }
+
   /* Set first structure in dt_mem[0] */
   dt_mem[0]->t = ck_mem->ck_t0;
   ca_mem->ca_IMstore(cv_mem, dt_mem[0]);
 
-  /* Decide whether TSTOP must be activated */
-  if (ca_mem->ca_tstopCVodeFcall) {
-    CVodeSetStopTime(cv_mem, ca_mem->ca_tstopCVodeF);
-  }
-
   sign = (ca_mem->ca_tfinal - ca_mem->ca_tinitial > ZERO) ? 1 : -1;
 
+  /* Modified for AMICI:
+   * Activate the stop time that was active at ck_t0 during the forward
+   * integration. Together with the updates below, this reproduces the steps
+   * taken by CVodeF if it was called with different stop times. */
+  itstop = 0;
+  while (itstop < ca_mem->ca_ntstops &&
+         sign*(ca_mem->ca_tstops[itstop] - ck_mem->ck_t0) <= ZERO)
+    itstop++;
+  if (itstop < ca_mem->ca_ntstops)
+    CVodeSetStopTime(cv_mem, ca_mem->ca_tstops[itstop]);
+
 
   /* Run CVode to set following structures in dt_mem[i] */
   i = 1;
@@ -2044,6 +2315,16 @@ static int CVAdataStore(CVodeMem cv_mem, CkpntMem ck_mem)
     flag = CVode(cv_mem, ck_mem->ck_t1, ca_mem->ca_ytmp, &t, CV_ONE_STEP);
     if (flag < 0) return(CV_FWD_FAIL);
 
+    /* Modified for AMICI:
+       activate the next stop time */
+    if (flag == CV_TSTOP_RETURN) {
+      while (itstop < ca_mem->ca_ntstops &&
+             sign*(ca_mem->ca_tstops[itstop] - t) <= ZERO)
+        itstop++;
+      if (itstop < ca_mem->ca_ntstops)
+        CVodeSetStopTime(cv_mem, ca_mem->ca_tstops[itstop]);
+    }
+
     dt_mem[i]->t = t;
     ca_mem->ca_IMstore(cv_mem, dt_mem[i]);
     i++;
@@ -2069,6 +2350,13 @@ static int CVAckpntGet(CVodeMem cv_mem, CkpntMem ck_mem)
 {
   int flag, j, is, qmax, retval;
 
+  /* Modified for AMICI:
+     read the check point from the scratch file */
+  if (ck_mem->ck_spilled) {
+    flag = CVAckpntLoad(cv_mem, ck_mem);
+    if (flag != CV_SUCCESS) return(flag);
+  }
+
   if (ck_mem->ck_next == NULL) {
 
     /* In this case, we just call the reinitialization routine,
@@ -76,6 +76,37 @@ int CVodeSetAdjNoSensi(void *cvode_mem)
   return(CV_SUCCESS);
 }
 
+/*
+ * Modified for AMICI:
+ * If spill is SUNTRUE, only the most recent check point is kept in memory,
+ * all others are written to a temporary scratch file and read back when
+ * the forward solution is recomputed from them.
+ */
+
+int CVodeSetAdjSpillCheckpoints(void *cvode_mem, booleantype spill)
+{
+  CVodeMem cv_mem;
+  CVadjMem ca_mem;
+
+  /* Check if cvode_mem exists */
+  if (cvode_mem == NULL) {
+    cvProcessError(NULL, CV_MEM_NULL, "CVODEA", "CVodeSetAdjSpillCheckpoints", MSGCV_NO_MEM);
+    return(CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem) cvode_mem;
+
+  /* Was ASA initialized? */
+  if (cv_mem->cv_adjMallocDone == SUNFALSE) {
+    cvProcessError(cv_mem, CV_NO_ADJ, "CVODEA", "CVodeSetAdjSpillCheckpoints", MSGCV_NO_ADJ);
+    return(CV_NO_ADJ);
+  }
+  ca_mem = cv_mem->cv_adj_mem;
+
+  ca_mem->ca_spillCkpnts = spill;
+
+  return(CV_SUCCESS);
+}
+
 /* 
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
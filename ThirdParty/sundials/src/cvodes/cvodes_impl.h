@@ -18,6 +18,7 @@
 #define _CVODES_IMPL_H
 
 #include <stdarg.h>
+#include <stdio.h>
 
 #include "cvodes/cvodes.h"
 
@@ -595,6 +596,12 @@ struct CkpntMemRec {
   /* Saved values */
   realtype ck_saved_tq5;
 
+  /* Modified for AMICI:
+     Were the vectors written to the scratch file and freed?
+     Offset of the vectors in the scratch file (-1 if not written yet) */
+  booleantype ck_spilled;
+  long int ck_fileOffset;
+
   /* Pointer to next structure in list */
   struct CkpntMemRec *ck_next;
 
@@ -737,6 +744,13 @@ struct CVadjMemRec {
   booleantype ca_tstopCVodeFcall;
   realtype ca_tstopCVodeF;
 
+  /* Modified for AMICI:
+     Stop times of all calls to CVodeF, to take the same steps when the
+     forward solution is recomputed from a check point */
+  realtype *ca_tstops;
+  long int ca_ntstops;
+  long int ca_tstopsSize;
+
   /* Flag if CVodeF was called in CV_NORMAL_MODE and encountered a
      root after tout */
   booleantype ca_rootret;
@@ -771,6 +785,13 @@ struct CVadjMemRec {
   /* address of the check point structure for which data is available */
   struct CkpntMemRec *ca_ckpntData;
 
+  /* Modified for AMICI:
+     Keep only the most recent check point in memory and write all others
+     to a scratch file? */
+  booleantype ca_spillCkpnts;
+  FILE *ca_ckpntFile;
+  long int ca_ckpntFileSize;
+
   /* ------------------
    * Interpolation data
    * ------------------ */
@@ -46,6 +46,11 @@ static CkpntMem IDAAckpntNew(IDAMem IDA_mem);
 static void IDAAckpntCopyVectors(IDAMem IDA_mem, CkpntMem ck_mem);
 static booleantype IDAAckpntAllocVectors(IDAMem IDA_mem, CkpntMem ck_mem);
 static void IDAAckpntDelete(CkpntMem *ck_memPtr);
+static int IDAAckpntVectors(CkpntMem ck_mem, N_Vector **slots,
+                            booleantype *quad);
+static int IDAAckpntSpill(IDAMem IDA_mem, CkpntMem ck_mem);
+static int IDAAckpntLoad(IDAMem IDA_mem, CkpntMem ck_mem);
+static int IDAArecordTstop(IDAadjMem IDAADJ_mem, realtype tstop);
 
 static void IDAAbckpbDelete(IDABMem *IDAB_memPtr);
 
@@ -136,6 +141,15 @@ int IDAAdjInit(void *ida_mem, long int steps, int interp)
   IDAADJ_mem->ia_nckpnts = 0;
   IDAADJ_mem->ia_ckpntData = NULL;
 
+  /* Modified for AMICI:
+     check points are kept in memory, no stop times recorded yet */
+  IDAADJ_mem->ia_spillCkpnts = SUNFALSE;
+  IDAADJ_mem->ia_ckpntFile = NULL;
+  IDAADJ_mem->ia_ckpntFileSize = 0;
+  IDAADJ_mem->ia_tstops = NULL;
+  IDAADJ_mem->ia_ntstops = 0;
+  IDAADJ_mem->ia_tstopsSize = 0;
+
 
   /* Initialization of interpolation data. */
   IDAADJ_mem->ia_interpType = interp;
@@ -240,6 +254,11 @@ int IDAAdjReInit(void *ida_mem)
   IDAADJ_mem->ia_nckpnts = 0;
   IDAADJ_mem->ia_ckpntData = NULL;
 
+  /* Modified for AMICI:
+     the scratch file is reused, recorded stop times are discarded */
+  IDAADJ_mem->ia_ckpntFileSize = 0;
+  IDAADJ_mem->ia_ntstops = 0;
+
   /* Flags for tracking the first calls to IDASolveF and IDASolveF. */
   IDAADJ_mem->ia_firstIDAFcall = SUNTRUE;
   IDAADJ_mem->ia_tstopIDAFcall = SUNFALSE;
@@ -273,6 +292,13 @@ void IDAAdjFree(void *ida_mem)
       IDAAckpntDelete(&(IDAADJ_mem->ck_mem));
     }
 
+    /* Modified for AMICI:
+       close the scratch file and free the recorded stop times */
+    if (IDAADJ_mem->ia_ckpntFile != NULL) fclose(IDAADJ_mem->ia_ckpntFile);
+    IDAADJ_mem->ia_ckpntFile = NULL;
+    free(IDAADJ_mem->ia_tstops);
+    IDAADJ_mem->ia_tstops = NULL;
+
     IDAAdataFree(IDA_mem);
 
     /* Free all backward problems. */
@@ -396,6 +422,13 @@ int IDASolveF(void *ida_mem, realtype tout, realtype *tret,
   if (IDA_mem->ida_tstopset) {
     IDAADJ_mem->ia_tstopIDAFcall = SUNTRUE;
     IDAADJ_mem->ia_tstopIDAF = IDA_mem->ida_tstop;
+
+    /* Modified for AMICI:
+       record all stop times, to reproduce the steps in IDAAdataStore */
+    if (IDAArecordTstop(IDAADJ_mem, IDA_mem->ida_tstop) != IDA_SUCCESS) {
+      IDAProcessError(IDA_mem, IDA_MEM_FAIL, "IDAA", "IDASolveF", MSG_MEM_FAIL);
+      return(IDA_MEM_FAIL);
+    }
   }
 
   /* On the first step:
@@ -517,6 +550,17 @@ int IDASolveF(void *ida_mem, realtype tout, realtype *tret,
 
       IDA_mem->ida_forceSetup = SUNTRUE;
 
+      /* Modified for AMICI:
+         keep only the new check point in memory */
+      if (IDAADJ_mem->ia_spillCkpnts) {
+        flag = IDAAckpntSpill(IDA_mem, tmp->ck_next);
+        if (flag != IDA_SUCCESS) {
+          IDAProcessError(IDA_mem, IDA_MEM_FAIL, "IDAA", "IDASolveF", MSG_MEM_FAIL);
+          flag = IDA_MEM_FAIL;
+          break;
+        }
+      }
+
       /* Reset i=0 and load dt_mem[0] */
       dt_mem[0]->t = IDAADJ_mem->ck_mem->ck_t0;
       IDAADJ_mem->ia_storePnt(IDA_mem, dt_mem[0]);
@@ -1728,6 +1772,10 @@ static CkpntMem IDAAckpntInit(IDAMem IDA_mem)
   /* Next in list */
   ck_mem->ck_next  = NULL;
 
+  /* Modified for AMICI: not written to the scratch file */
+  ck_mem->ck_spilled = SUNFALSE;
+  ck_mem->ck_fileOffset = -1;
+
   return(ck_mem);
 }
 
@@ -1794,6 +1842,10 @@ static CkpntMem IDAAckpntNew(IDAMem IDA_mem)
   /* Save phi* vectors from IDA_mem to ck_mem. */
   IDAAckpntCopyVectors(IDA_mem, ck_mem);
 
+  /* Modified for AMICI: not written to the scratch file */
+  ck_mem->ck_spilled = SUNFALSE;
+  ck_mem->ck_fileOffset = -1;
+
   return(ck_mem);
 }
 
@@ -1838,6 +1890,202 @@ static void IDAAckpntDelete(CkpntMem *ck_memPtr)
   }
 }
 
+/*
+ * IDAAckpntVectors
+ *
+ * Modified for AMICI:
+ * This routine returns the number of vectors stored at the check point
+ * ck_mem. If slots is not NULL, it is filled with the addresses of these
+ * vectors, and quad with flags whether they are quadrature vectors.
+ */
+
+static int IDAAckpntVectors(CkpntMem ck_mem, N_Vector **slots,
+                            booleantype *quad)
+{
+  int j, is, n;
+
+  n = 0;
+  for (j=0; j<ck_mem->ck_phi_alloc; j++) {
+    if (slots != NULL) {
+      slots[n] = &(ck_mem->ck_phi[j]);
+      quad[n] = SUNFALSE;
+    }
+    n++;
+    if (ck_mem->ck_quadr) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_phiQ[j]);
+        quad[n] = SUNTRUE;
+      }
+      n++;
+    }
+    for (is=0; ck_mem->ck_sensi && is<ck_mem->ck_Ns; is++) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_phiS[j][is]);
+        quad[n] = SUNFALSE;
+      }
+      n++;
+    }
+    for (is=0; ck_mem->ck_quadr_sensi && is<ck_mem->ck_Ns; is++) {
+      if (slots != NULL) {
+        slots[n] = &(ck_mem->ck_phiQS[j][is]);
+        quad[n] = SUNTRUE;
+      }
+      n++;
+    }
+  }
+
+  return(n);
+}
+
+/*
+ * IDAAckpntSpill
+ *
+ * Modified for AMICI:
+ * This routine writes the vectors stored at the check point ck_mem to the
+ * scratch file, unless this was already done, and frees them.
+ */
+
+static int IDAAckpntSpill(IDAMem IDA_mem, CkpntMem ck_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  N_Vector **slots;
+  booleantype *quad;
+  sunindextype len;
+  long int offset;
+  int n, i, flag;
+
+  if (ck_mem->ck_spilled) return(IDA_SUCCESS);
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  n = IDAAckpntVectors(ck_mem, NULL, NULL);
+  slots = (N_Vector **) malloc(n * sizeof(N_Vector *));
+  quad = (booleantype *) malloc(n * sizeof(booleantype));
+  if (slots == NULL || quad == NULL) {
+    free(slots); free(quad);
+    return(IDA_MEM_FAIL);
+  }
+  IDAAckpntVectors(ck_mem, slots, quad);
+
+  flag = IDA_SUCCESS;
+
+  if (ck_mem->ck_fileOffset < 0) {
+    if (IDAADJ_mem->ia_ckpntFile == NULL) IDAADJ_mem->ia_ckpntFile = tmpfile();
+    if (IDAADJ_mem->ia_ckpntFile == NULL ||
+        fseek(IDAADJ_mem->ia_ckpntFile, IDAADJ_mem->ia_ckpntFileSize,
+              SEEK_SET) != 0)
+      flag = IDA_MEM_FAIL;
+
+    offset = IDAADJ_mem->ia_ckpntFileSize;
+    for (i=0; i<n && flag == IDA_SUCCESS; i++) {
+      len = N_VGetLength(*slots[i]);
+      if (fwrite(N_VGetArrayPointer(*slots[i]), sizeof(realtype), len,
+                 IDAADJ_mem->ia_ckpntFile) != (size_t) len)
+        flag = IDA_MEM_FAIL;
+      offset += len * sizeof(realtype);
+    }
+
+    if (flag == IDA_SUCCESS) {
+      ck_mem->ck_fileOffset = IDAADJ_mem->ia_ckpntFileSize;
+      IDAADJ_mem->ia_ckpntFileSize = offset;
+    }
+  }
+
+  if (flag == IDA_SUCCESS) {
+    for (i=0; i<n; i++) {
+      N_VDestroy(*slots[i]);
+      *slots[i] = NULL;
+    }
+    ck_mem->ck_spilled = SUNTRUE;
+  }
+
+  free(slots); free(quad);
+
+  return(flag);
+}
+
+/*
+ * IDAAckpntLoad
+ *
+ * Modified for AMICI:
+ * This routine allocates the vectors of the check point ck_mem and reads
+ * them from the scratch file.
+ */
+
+static int IDAAckpntLoad(IDAMem IDA_mem, CkpntMem ck_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  N_Vector **slots;
+  booleantype *quad;
+  sunindextype len;
+  int n, i, flag;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  n = IDAAckpntVectors(ck_mem, NULL, NULL);
+  slots = (N_Vector **) malloc(n * sizeof(N_Vector *));
+  quad = (booleantype *) malloc(n * sizeof(booleantype));
+  if (slots == NULL || quad == NULL) {
+    free(slots); free(quad);
+    return(IDA_MEM_FAIL);
+  }
+  IDAAckpntVectors(ck_mem, slots, quad);
+
+  flag = IDA_SUCCESS;
+  if (fseek(IDAADJ_mem->ia_ckpntFile, ck_mem->ck_fileOffset, SEEK_SET) != 0)
+    flag = IDA_MEM_FAIL;
+
+  for (i=0; i<n && flag == IDA_SUCCESS; i++) {
+    *slots[i] = N_VClone(quad[i] ? IDA_mem->ida_eeQ : IDA_mem->ida_tempv1);
+    if (*slots[i] == NULL) {
+      flag = IDA_MEM_FAIL;
+      break;
+    }
+    len = N_VGetLength(*slots[i]);
+    if (fread(N_VGetArrayPointer(*slots[i]), sizeof(realtype), len,
+              IDAADJ_mem->ia_ckpntFile) != (size_t) len)
+      flag = IDA_MEM_FAIL;
+  }
+
+  /* vectors allocated so far are freed by IDAAckpntDelete */
+  if (flag == IDA_SUCCESS) ck_mem->ck_spilled = SUNFALSE;
+
+  free(slots); free(quad);
+
+  return(flag);
+}
+
+/*
+ * IDAArecordTstop
+ *
+ * Modified for AMICI:
+ * This routine appends tstop to the list of stop times used in IDASolveF,
+ * unless it is the same as the last one.
+ */
+
+static int IDAArecordTstop(IDAadjMem IDAADJ_mem, realtype tstop)
+{
+  realtype *tstops;
+  long int size;
+
+  if (IDAADJ_mem->ia_ntstops > 0 &&
+      IDAADJ_mem->ia_tstops[IDAADJ_mem->ia_ntstops-1] == tstop)
+    return(IDA_SUCCESS);
+
+  if (IDAADJ_mem->ia_ntstops == IDAADJ_mem->ia_tstopsSize) {
+    size = (IDAADJ_mem->ia_tstopsSize > 0) ? 2*IDAADJ_mem->ia_tstopsSize : 16;
+    tstops = (realtype *) realloc(IDAADJ_mem->ia_tstops,
+                                  size * sizeof(realtype));
+    if (tstops == NULL) return(IDA_MEM_FAIL);
+    IDAADJ_mem->ia_tstops = tstops;
+    IDAADJ_mem->ia_tstopsSize = size;
+  }
+
+  IDAADJ_mem->ia_tstops[IDAADJ_mem->ia_ntstops++] = tstop;
+
+  return(IDA_SUCCESS);
+}
+
 /*
  * IDAAckpntAllocVectors
  *
@@ -2065,7 +2313,7 @@ static int IDAAdataStore(IDAMem IDA_mem, CkpntMem ck_mem)
   IDAadjMem IDAADJ_mem;
   DtpntMem *dt_mem;
   realtype t;
-  long int i;
+  long int i, itstop;
   int flag, sign;
 
   IDAADJ_mem = IDA_mem->ida_adj_mem;
@@ -2076,17 +2324,31 @@ static int IDAAdataStore(IDAMem IDA_mem, CkpntMem ck_mem)
   if (flag != IDA_SUCCESS)
     return(IDA_REIFWD_FAIL);
 
+  /* Modified for AMICI:
+     the check point was copied to IDA_mem and can be freed again */
+  if (IDAADJ_mem->ia_spillCkpnts && ck_mem != IDAADJ_mem->ck_mem) {
+    flag = IDAAckpntSpill(IDA_mem, ck_mem);
+    if (flag != IDA_SUCCESS)
+      return(IDA_REIFWD_FAIL);
+  }
+
   /* Set first structure in dt_mem[0] */
   dt_mem[0]->t = ck_mem->ck_t0;
   IDAADJ_mem->ia_storePnt(IDA_mem, dt_mem[0]);
 
-  /* Decide whether TSTOP must be activated */
-  if (IDAADJ_mem->ia_tstopIDAFcall) {
-    IDASetStopTime(IDA_mem, IDAADJ_mem->ia_tstopIDAF);
-  }
-
   sign = (IDAADJ_mem->ia_tfinal - IDAADJ_mem->ia_tinitial > ZERO) ? 1 : -1;
 
+  /* Modified for AMICI:
+   * Activate the stop time that was active at ck_t0 during the forward
+   * integration. Together with the updates below, this reproduces the steps
+   * taken by IDASolveF if it was called with different stop times. */
+  itstop = 0;
+  while (itstop < IDAADJ_mem->ia_ntstops &&
+         sign*(IDAADJ_mem->ia_tstops[itstop] - ck_mem->ck_t0) <= ZERO)
+    itstop++;
+  if (itstop < IDAADJ_mem->ia_ntstops)
+    IDASetStopTime(IDA_mem, IDAADJ_mem->ia_tstops[itstop]);
+
   /* Run IDASolve in IDA_ONE_STEP mode to set following structures in dt_mem[i]. */
   i = 1;
   do {
@@ -2095,6 +2357,16 @@ static int IDAAdataStore(IDAMem IDA_mem, CkpntMem ck_mem)
                     IDAADJ_mem->ia_ypTmp, IDA_ONE_STEP);
     if (flag < 0) return(IDA_FWD_FAIL);
 
+    /* Modified for AMICI:
+       activate the next stop time */
+    if (flag == IDA_TSTOP_RETURN) {
+      while (itstop < IDAADJ_mem->ia_ntstops &&
+             sign*(IDAADJ_mem->ia_tstops[itstop] - t) <= ZERO)
+        itstop++;
+      if (itstop < IDAADJ_mem->ia_ntstops)
+        IDASetStopTime(IDA_mem, IDAADJ_mem->ia_tstops[itstop]);
+    }
+
     dt_mem[i]->t = t;
     IDAADJ_mem->ia_storePnt(IDA_mem, dt_mem[i]);
 
@@ -2120,6 +2392,13 @@ static int IDAAckpntGet(IDAMem IDA_mem, CkpntMem ck_mem)
 {
   int flag, j, is;
 
+  /* Modified for AMICI:
+     read the check point from the scratch file */
+  if (ck_mem->ck_spilled) {
+    flag = IDAAckpntLoad(IDA_mem, ck_mem);
+    if (flag != IDA_SUCCESS) return(flag);
+  }
+
   if (ck_mem->ck_next == NULL) {
 
     /* In this case, we just call the reinitialization routine,
@@ -79,6 +79,39 @@ int IDAAdjSetNoSensi(void *ida_mem)
   return(IDA_SUCCESS);
 }
 
+/*
+ * IDAAdjSetSpillCheckpoints
+ *
+ * Modified for AMICI:
+ * If spill is SUNTRUE, only the most recent check point is kept in memory,
+ * all others are written to a temporary scratch file and read back when
+ * the forward solution is recomputed from them.
+ */
+
+int IDAAdjSetSpillCheckpoints(void *ida_mem, booleantype spill)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL) {
+    IDAProcessError(NULL, IDA_MEM_NULL, "IDAA", "IDAAdjSetSpillCheckpoints", MSGAM_NULL_IDAMEM);
+    return IDA_MEM_NULL;
+  }
+  IDA_mem = (IDAMem) ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE) {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, "IDAA", "IDAAdjSetSpillCheckpoints",  MSGAM_NO_ADJ);
+    return(IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  IDAADJ_mem->ia_spillCkpnts = spill;
+
+  return(IDA_SUCCESS);
+}
+
 /* 
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
@@ -19,6 +19,7 @@
 #define _IDAS_IMPL_H
 
 #include <stdarg.h>
+#include <stdio.h>
 
 #include "idas/idas.h"
 
@@ -598,6 +599,12 @@ struct CkpntMemRec {
   /* How many phi, phiS, phiQ and phiQS were allocated? */
   int          ck_phi_alloc;
 
+  /* Modified for AMICI:
+     Were the vectors written to the scratch file and freed?
+     Offset of the vectors in the scratch file (-1 if not written yet) */
+  booleantype  ck_spilled;
+  long int     ck_fileOffset;
+
   /* Pointer to next structure in list */
   struct CkpntMemRec *ck_next;
 };
@@ -725,6 +732,13 @@ struct IDAadjMemRec {
   booleantype ia_tstopIDAFcall;
   realtype ia_tstopIDAF;
 
+  /* Modified for AMICI:
+     Stop times of all calls to IDASolveF, to take the same steps when the
+     forward solution is recomputed from a check point */
+  realtype *ia_tstops;
+  long int ia_ntstops;
+  long int ia_tstopsSize;
+
   /* Flag if IDASolveF was called in IDA_NORMAL_MODE and encountered
      a root after tout */
   booleantype ia_rootret;
@@ -756,6 +770,13 @@ struct IDAadjMemRec {
   /* address of the check point structure for which data is available */
   struct CkpntMemRec *ia_ckpntData;
 
+  /* Modified for AMICI:
+     Keep only the most recent check point in memory and write all others
+     to a scratch file? */
+  booleantype ia_spillCkpnts;
+  FILE *ia_ckpntFile;
+  long int ia_ckpntFileSize;
+
   /* Number of checkpoints. */
   int ia_nckpnts;
 
@@ -2,6 +2,8 @@
 
 include(CMakeFindDependencyMacro)
 
+find_dependency(Threads)
+
 include("${CMAKE_CURRENT_LIST_DIR}/AmiciTargets.cmake")
 
 check_required_components(Amici)
@@ -291,6 +291,16 @@ class AbstractModel {
                        const realtype *p, const realtype *k, const realtype *h,
                        const realtype *tcl, const realtype *sx, int ip, int ie);
 
+    /**
+     * @brief Model-specific implementation of ftrigger_times
+     * @param trigger_times trigger times of the time-triggered events
+     * (see Model::getTimeTriggeredEvents)
+     * @param p parameter vector
+     * @param k constant vector
+     */
+    virtual void ftrigger_times(realtype *trigger_times, const realtype *p,
+                                const realtype *k);
+
     /**
      * @brief Model-specific implementation of fy
      * @param y model output at current timepoint
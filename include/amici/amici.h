@@ -10,8 +10,71 @@
 #include "amici/solver.h"
 #include "amici/symbolic_functions.h"
 
+#include <functional>
+#include <map>
+#include <mutex>
+
 namespace amici {
 
+class PreequilibrationCache;
+
+/**
+ * @brief Per-thread load statistics of the most recent call to
+ * AmiciApplication::runAmiciSimulations.
+ *
+ * The utilization of thread `i` is `busy_time[i] / wall_time`.
+ */
+struct ThreadUtilization {
+    /** number of simulations run by each thread */
+    std::vector<int> num_simulations;
+
+    /** accumulated wall time spent in simulations, per thread [ms] */
+    std::vector<double> busy_time;
+
+    /** wall time of the whole batch [ms] */
+    double wall_time = 0.0;
+
+    /** indices of the conditions in the order in which they were scheduled */
+    std::vector<int> order;
+};
+
+/**
+ * @brief Objective function and its derivatives summed over all conditions
+ * of a call to AmiciApplication::runAmiciSimulationsAggregated.
+ *
+ * The sums are formed per thread and then across threads, so the order of
+ * summation (and thus round-off) depends on the scheduling.
+ */
+struct AggregatedReturnData {
+    /** number of parameters w.r.t. which sensitivities were computed */
+    int nplist = 0;
+
+    /** summed log-likelihood, NaN if any condition failed */
+    realtype llh = 0.0;
+
+    /** summed chi2 value, NaN if any condition failed */
+    realtype chi2 = 0.0;
+
+    /** summed log-likelihood sensitivities (shape `nplist`), empty if no
+     * sensitivities were computed */
+    std::vector<realtype> sllh;
+
+    /** summed Fisher information matrix (shape `nplist` x `nplist`,
+     * row-major), empty if it was not computed */
+    std::vector<realtype> FIM;
+
+    /** simulation status per condition (shape `nconditions`), empty if only
+     * failures were requested. Conditions skipped after a failure with
+     * `failfast` have status AMICI_NOT_RUN. */
+    std::vector<int> status;
+
+    /** indices of failed and skipped conditions, in ascending order */
+    std::vector<int> failed_conditions;
+
+    /** status of the conditions in failed_conditions */
+    std::vector<int> failed_status;
+};
+
 /*!
  * @brief Prints a specified error message associated with the specified
  * identifier
@@ -63,6 +126,16 @@ class AmiciApplication {
     /**
      * @brief Same as runAmiciSimulation, but for multiple ExpData instances.
      *
+     * Conditions are handed out to threads dynamically, longest first. The
+     * cost of a condition is estimated from the CPU times reported in the
+     * ReturnData of previous calls on this context. Conditions are
+     * identified by ExpData::id or, if no id is set, by their fixed
+     * parameters, timepoints, initial states and parameter list. Conditions
+     * without recorded cost are scheduled first.
+     *
+     * Conditions with identical preequilibration settings share a single
+     * preequilibration.
+     *
      * @param solver Solver instance
      * @param edatas experimental data objects
      * @param model model specification object
@@ -75,6 +148,42 @@ class AmiciApplication {
                         const std::vector<ExpData *> &edatas,
                         Model const &model, bool failfast, int num_threads);
 
+    /**
+     * @brief Same as runAmiciSimulations, but only returns llh, chi2, sllh
+     * and FIM summed over all conditions, together with the simulation
+     * status.
+     *
+     * The per-condition ReturnData are reduced and discarded in the worker
+     * threads. All conditions must use the parameter list and parameter
+     * scaling of the model, otherwise an AmiException is thrown.
+     *
+     * @param solver Solver instance
+     * @param edatas experimental data objects
+     * @param model model specification object
+     * @param failfast flag to allow early termination
+     * @param num_threads number of threads for parallel execution
+     * @param failures_only only report the status of failed conditions
+     * @return aggregated results
+     */
+    AggregatedReturnData
+    runAmiciSimulationsAggregated(Solver const &solver,
+                                  const std::vector<ExpData *> &edatas,
+                                  Model const &model, bool failfast,
+                                  int num_threads, bool failures_only = false);
+
+    /**
+     * @brief Get per-thread load statistics of the last call to
+     * runAmiciSimulations
+     * @return thread utilization
+     */
+    ThreadUtilization getThreadUtilization() const;
+
+    /**
+     * @brief Forget the condition costs recorded by previous calls to
+     * runAmiciSimulations
+     */
+    void resetSimulationCosts();
+
     /** Function to process warnings */
     outputFunctionType warning = printWarnMsgIdAndTxt;
 
@@ -106,6 +215,51 @@ class AmiciApplication {
      * AMICI_SUCCESS otherwise
      */
     int checkFinite(gsl::span<const realtype> array, const char *fun);
+
+  private:
+    /**
+     * @brief runAmiciSimulation, reusing preequilibrations across conditions.
+     *
+     * @param solver Solver instance
+     * @param edata pointer to experimental data object
+     * @param model model specification object
+     * @param rethrow rethrow integration exceptions?
+     * @param preeq_cache preequilibration cache, may be nullptr
+     * @return rdata pointer to return data object
+     */
+    std::unique_ptr<ReturnData>
+    runAmiciSimulation(Solver &solver, const ExpData *edata, Model &model,
+                       bool rethrow, PreequilibrationCache *preeq_cache);
+
+    /**
+     * @brief Schedules and runs the conditions of runAmiciSimulations and
+     * runAmiciSimulationsAggregated.
+     *
+     * @param solver Solver instance
+     * @param edatas experimental data objects
+     * @param model model specification object
+     * @param failfast flag to allow early termination
+     * @param num_threads number of threads for parallel execution
+     * @param process callback receiving the condition index, the thread
+     * index and the return data of each condition, called from the thread
+     * that ran the simulation
+     */
+    void runAmiciSimulations(
+        Solver const &solver, const std::vector<ExpData *> &edatas,
+        Model const &model, bool failfast, int num_threads,
+        std::function<void(int, int, std::unique_ptr<ReturnData>)> const
+            &process);
+
+    /** estimated cost [ms] per condition key from previous
+     * runAmiciSimulations calls */
+    std::map<std::string, double> simulation_costs_;
+
+    /** load statistics of the last runAmiciSimulations call */
+    ThreadUtilization thread_utilization_;
+
+    /** guards simulation_costs_ and thread_utilization_, which are shared
+     * by concurrent calls to runAmiciSimulations */
+    mutable std::mutex mutex_;
 };
 
 /**
@@ -138,6 +292,33 @@ std::vector<std::unique_ptr<ReturnData>>
 runAmiciSimulations(Solver const &solver, const std::vector<ExpData *> &edatas,
                     Model const &model, bool failfast, int num_threads);
 
+/**
+ * @brief Same as runAmiciSimulations, but only returns the objective function
+ * and its derivatives summed over all conditions, see
+ * AmiciApplication::runAmiciSimulationsAggregated.
+ *
+ * @param solver Solver instance
+ * @param edatas experimental data objects
+ * @param model model specification object
+ * @param failfast flag to allow early termination
+ * @param num_threads number of threads for parallel execution
+ * @param failures_only only report the status of failed conditions
+ * @return aggregated results
+ */
+AggregatedReturnData
+runAmiciSimulationsAggregated(Solver const &solver,
+                              const std::vector<ExpData *> &edatas,
+                              Model const &model, bool failfast,
+                              int num_threads, bool failures_only = false);
+
+/**
+ * @brief Per-thread load statistics of the last call to runAmiciSimulations
+ * on the default context.
+ *
+ * @return thread utilization
+ */
+ThreadUtilization getThreadUtilization();
+
 } // namespace amici
 
 #endif /* amici_h */
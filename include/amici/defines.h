@@ -76,6 +76,7 @@ constexpr int AMICI_DAMPING_FACTOR_ERROR=    -86;
 constexpr int AMICI_SINGULAR_JACOBIAN=      -809;
 constexpr int AMICI_NOT_IMPLEMENTED=        -999;
 constexpr int AMICI_MAX_TIME_EXCEEDED  =   -1000;
+constexpr int AMICI_NOT_RUN=               -1001;
 constexpr int AMICI_SUCCESS=                   0;
 constexpr int AMICI_DATA_RETURN=               1;
 constexpr int AMICI_ROOT_RETURN=               2;
@@ -151,6 +152,14 @@ enum class LinearSolver {
     SuperLUMT   = 10,
 };
 
+/** preconditioners for the Krylov linear solvers */
+enum class PreconditionerType {
+    none        = 0,
+    jacobi      = 1,
+    blockJacobi = 2,
+    ILU         = 3,
+};
+
 /** CVODES/IDAS forward sensitivity computation method */
 enum class InternalSensitivityMethod {
     simultaneous = 1,
@@ -207,6 +216,13 @@ enum class NewtonDampingFactorMode {
     on = 1
 };
 
+/** Starting point for Newton's method in preequilibration */
+enum class SteadyStateWarmStartMode {
+    off = 0,
+    previous = 1,
+    firstOrder = 2
+};
+
 /** fixedParameter to be used in condition context */
 enum class FixedParameterContext {
     simulation = 0,
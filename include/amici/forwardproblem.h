@@ -36,6 +36,20 @@ struct SimulationState{
 };
 
 
+/**
+ * @brief Occurrence of a time-triggered event, see
+ * Model::getTimeTriggeredEvents
+ */
+struct ScheduledEvent {
+    /** trigger time */
+    realtype t;
+    /** event index */
+    int ie;
+    /** direction of the root function crossing (1: false -> true,
+     * -1: true -> false) */
+    int direction;
+};
+
 /**
  * @brief The ForwardProblem class groups all functions for solving the
  * forward problem.
@@ -208,6 +222,15 @@ class ForwardProblem {
         return it_;
     }
 
+    /**
+     * @brief Number of output timepoints at which the solution was
+     * interpolated
+     * @return number of interpolated outputs
+     */
+    int getNumInterpolatedOutputs() const {
+        return num_interpolated_outputs_;
+    }
+
     /**
      * @brief Returns final time point for which simulations are available
      * @return time point
@@ -235,14 +258,13 @@ class ForwardProblem {
     /**
      * @brief Retrieves the carbon copy of the simulation state variables at
      * the specified timepoint index
+     *
+     * State sensitivities are only available when computing forward
+     * sensitivities. Memory of `state` is reused if dimensions match.
      * @param it timepoint index
-     * @return state
+     * @param state state to write to
      */
-    const SimulationState &getSimulationStateTimepoint(int it) const {
-        if (model->getTimepoint(it) == initial_state_.t)
-            return getInitialSimulationState();
-        return timepoint_states_.find(model->getTimepoint(it))->second;
-    };
+    void getSimulationStateTimepoint(int it, SimulationState &state) const;
 
     /**
      * @brief Retrieves the carbon copy of the simulation state variables at
@@ -285,14 +307,45 @@ class ForwardProblem {
 
     void handlePresimulation();
 
+    /**
+     * @brief Integrate over all output timepoints without stopping at them,
+     * computing the outputs by interpolation (see
+     * Solver::setInterpolatedOutput)
+     */
+    void handleDataPointsInterpolated();
+
+    /**
+     * @brief Compute the occurrences of time-triggered events after the
+     * initial time and store them in event_schedule_
+     */
+    void initEventSchedule();
+
+    /**
+     * @brief Get the time until which the solver may integrate without
+     * passing a time-triggered event
+     *
+     * @param tout next output timepoint
+     * @return tout or the next scheduled event time, whichever comes first
+     */
+    realtype getNextStopTime(realtype tout) const;
+
+    /**
+     * @brief Fire all time-triggered events scheduled at or before the
+     * current time
+     */
+    void handleScheduledEvents();
+
     /**
      * @brief Execute everything necessary for the handling of events
      *
      * @param tlastroot pointer to the timepoint of the last event
      * @param seflag Secondary event flag
+     * @param scheduled flag indicating that the primary events were not
+     * found by the solver, but are time-triggered events already written to
+     * roots_found_
      */
 
-    void handleEvent(realtype *tlastroot,bool seflag);
+    void handleEvent(realtype *tlastroot, bool seflag, bool scheduled = false);
 
     /**
      * @brief Extract output information for events
@@ -403,8 +456,27 @@ class ForwardProblem {
      */
     std::vector<int> roots_found_;
 
-    /** simulation states history at timepoints  */
-    std::map<realtype, SimulationState> timepoint_states_;
+    /** state history at timepoints (dimension: nt x nx_solver, row-major) */
+    std::vector<realtype> timepoint_x_;
+
+    /** differential state history at timepoints
+     * (dimension: nt x nx_solver, row-major) */
+    std::vector<realtype> timepoint_dx_;
+
+    /** state sensitivity history at timepoints, only stored when computing
+     * forward sensitivities (dimension: nt x nplist x nx_solver, row-major) */
+    std::vector<realtype> timepoint_sx_;
+
+    /** distinct model states at timepoints, these only change at events */
+    std::vector<ModelState> timepoint_model_states_;
+
+    /** index into timepoint_model_states_ for every timepoint, -1 if no
+     * state was stored for the timepoint (dimension: nt) */
+    std::vector<int> timepoint_model_state_idxs_;
+
+    /** flag indicating that the model state changed since it was last
+     * appended to timepoint_model_states_ */
+    bool model_state_changed_ {true};
 
     /** simulation state history at events*/
     std::vector<SimulationState> event_states_;
@@ -446,6 +518,15 @@ class ForwardProblem {
     /** storage for last found root */
     realtype tlastroot_ {0.0};
 
+    /** occurrences of time-triggered events, sorted by time */
+    std::vector<ScheduledEvent> event_schedule_;
+
+    /** index of the next unhandled entry of event_schedule_ */
+    std::vector<ScheduledEvent>::size_type next_scheduled_event_ {0};
+
+    /** number of output timepoints at which the solution was interpolated */
+    int num_interpolated_outputs_ {0};
+
     /** flag to indicate whether solver was preeinitialized via preequilibration */
     bool preequilibrated_ {false};
 
@@ -110,6 +110,14 @@ void writeSlice(const std::vector<T> &s, gsl::span<T> b) {
  */
 void writeSlice(const AmiVector &s, gsl::span<realtype> b);
 
+/**
+ * @brief local helper function to write computed slice to provided buffer
+ * (AmiVectorArray/span)
+ * @param s computed value, written in column-major order
+ * @param b buffer to which values are to be written
+ */
+void writeSlice(const AmiVectorArray &s, gsl::span<realtype> b);
+
 
 /**
   * @brief Remove parameter scaling according to the parameter scaling in pscale
@@ -56,6 +56,11 @@ class Model : public AbstractModel, public ModelDimensions {
      * @param ndxdotdp_explicit Number of nonzero elements in `dxdotdp_explicit`
      * @param ndxdotdx_explicit Number of nonzero elements in `dxdotdx_explicit`
      * @param w_recursion_depth Recursion depth of fw
+     * @param time_triggered_events Indices of events whose root functions
+     * only depend on time and parameters (see ftrigger_times)
+     * @param state_sensitivity_structure For each parameter, the indices of
+     * the solver states with structurally nonzero sensitivities (empty if
+     * unknown)
      */
     Model(ModelDimensions const& model_dimensions,
           SimulationParameters simulation_parameters,
@@ -63,7 +68,10 @@ class Model : public AbstractModel, public ModelDimensions {
           std::vector<amici::realtype> idlist,
           std::vector<int> z2event, bool pythonGenerated = false,
           int ndxdotdp_explicit = 0, int ndxdotdx_explicit = 0,
-          int w_recursion_depth = 0);
+          int w_recursion_depth = 0,
+          std::vector<int> time_triggered_events = std::vector<int>(),
+          std::vector<std::vector<int>> state_sensitivity_structure =
+              std::vector<std::vector<int>>());
 
     /** Destructor. */
     ~Model() override = default;
@@ -203,6 +211,54 @@ class Model : public AbstractModel, public ModelDimensions {
      */
     void initHeaviside(const AmiVector &x, const AmiVector &dx);
 
+    /**
+     * @brief Get the indices of the events that only depend on time and
+     * parameters.
+     *
+     * The trigger times of these events are computed in advance
+     * (see getEventTriggerTimes) and they are excluded from root finding.
+     *
+     * @return event indices
+     */
+    std::vector<int> const &getTimeTriggeredEvents() const;
+
+    /**
+     * @brief Compute the trigger times of the time-triggered events for the
+     * current parameters.
+     *
+     * Events whose root function does not depend on time yield a
+     * non-finite trigger time.
+     *
+     * @return trigger times, ordered as getTimeTriggeredEvents()
+     */
+    std::vector<realtype> getEventTriggerTimes();
+
+    /**
+     * @brief Get the structure of the state sensitivities.
+     *
+     * For each model parameter, the indices of the solver states whose
+     * sensitivities w.r.t. this parameter are not structurally zero, i.e.
+     * that depend on the parameter through their initial values or the right
+     * hand side.
+     *
+     * @return sorted state indices per parameter, empty if the structure is
+     * not known
+     */
+    std::vector<std::vector<int>> const &getStateSensitivityStructure() const;
+
+    /**
+     * @brief Get the indices of the parameters in the parameter list whose
+     * state sensitivities are not structurally zero.
+     *
+     * State sensitivities w.r.t. all other parameters vanish at all times and
+     * do not need to be integrated. If the sensitivity structure is unknown or
+     * custom initial state sensitivities were set, all parameters are
+     * returned.
+     *
+     * @return indices into the parameter list, in ascending order
+     */
+    std::vector<int> getNonzeroStateSensitivityIndices() const;
+
     /**
      * @brief Get number of parameters wrt to which sensitivities are computed.
      * @return Length of sensitivity index vector
@@ -706,6 +762,76 @@ class Model : public AbstractModel, public ModelDimensions {
         return sigma_res_;
     }
 
+    /**
+     * @brief Set the scaling parameters that are treated as inner parameters.
+     *
+     * Inner parameters are not estimated by the optimizer, but are set to
+     * their optimal values given the simulated observables after each
+     * simulation with data (hierarchical optimization). llh, sllh, chi2,
+     * res, sres and FIM are then evaluated at these optimal values and
+     * the values are reported in ReturnData::inner_parameters.
+     *
+     * Observables with inner parameters must have the form
+     * \f$ y = c + s \cdot h + b \f$ with Gaussian noise on linear scale
+     * (ObservableScaling::lin) \f$ \sigma_y = \sigma \f$, where scaling \f$ s \f$, offset
+     * \f$ b \f$ and noise parameter \f$ \sigma \f$ do not affect the
+     * states, and other noise models do not depend on \f$ s \f$ or
+     * \f$ b \f$. Observables sharing a scaling or offset parameter must
+     * share all their inner parameters. Only supported without sensitivities
+     * or with first order forward sensitivities.
+     *
+     * @param idxs index of the scaling parameter for each observable, -1 for
+     * observables without inner scaling parameter (dimension: `nytrue`)
+     */
+    void setInnerScalingParameters(std::vector<int> const &idxs);
+
+    /**
+     * @brief Get the scaling parameters that are treated as inner parameters,
+     * see setInnerScalingParameters.
+     * @return index of the scaling parameter for each observable, -1 if none
+     */
+    std::vector<int> const &getInnerScalingParameters() const;
+
+    /**
+     * @brief Set the offset parameters that are treated as inner parameters,
+     * see setInnerScalingParameters.
+     * @param idxs index of the offset parameter for each observable, -1 for
+     * observables without inner offset parameter (dimension: `nytrue`)
+     */
+    void setInnerOffsetParameters(std::vector<int> const &idxs);
+
+    /**
+     * @brief Get the offset parameters that are treated as inner parameters,
+     * see setInnerScalingParameters.
+     * @return index of the offset parameter for each observable, -1 if none
+     */
+    std::vector<int> const &getInnerOffsetParameters() const;
+
+    /**
+     * @brief Set the noise parameters that are treated as inner parameters,
+     * see setInnerScalingParameters.
+     *
+     * Measurement standard deviations must not be provided in ExpData for
+     * observables with an inner noise parameter.
+     *
+     * @param idxs index of the noise parameter for each observable, -1 for
+     * observables without inner noise parameter (dimension: `nytrue`)
+     */
+    void setInnerSigmaParameters(std::vector<int> const &idxs);
+
+    /**
+     * @brief Get the noise parameters that are treated as inner parameters,
+     * see setInnerScalingParameters.
+     * @return index of the noise parameter for each observable, -1 if none
+     */
+    std::vector<int> const &getInnerSigmaParameters() const;
+
+    /**
+     * @brief Check whether any parameters are treated as inner parameters
+     * @return true if any observable has inner parameters
+     */
+    bool hasInnerParameters() const;
+
     /**
      * @brief Get the list of parameters for which sensitivities are computed.
      * @return List of parameter indices
@@ -1794,6 +1920,13 @@ class Model : public AbstractModel, public ModelDimensions {
     /** index indicating to which event an event output belongs */
     std::vector<int> z2event_;
 
+    /** indices of events that are triggered at times known in advance */
+    std::vector<int> time_triggered_events_;
+
+    /** indices of the solver states with structurally nonzero sensitivities
+     * for each parameter, empty if unknown */
+    std::vector<std::vector<int>> state_sensitivity_structure_;
+
     /** state initialization (size nx_solver) */
     std::vector<realtype> x0data_;
 
@@ -1828,6 +1961,23 @@ class Model : public AbstractModel, public ModelDimensions {
     /** offset to ensure positivity of sigma residuals, only has an effect when `sigma_res_` is `true`  */
     realtype min_sigma_ {50.0};
 
+    /** indices of inner scaling parameters per observable, -1 if none
+     * (dimension: `nytrue`) */
+    std::vector<int> inner_scaling_idxs_;
+
+    /** indices of inner offset parameters per observable, -1 if none
+     * (dimension: `nytrue`) */
+    std::vector<int> inner_offset_idxs_;
+
+    /** indices of inner noise parameters per observable, -1 if none
+     * (dimension: `nytrue`) */
+    std::vector<int> inner_sigma_idxs_;
+
+    /** Patterns of sparse matrix operations, computed once and shared
+     * between a model and all its clones */
+    std::shared_ptr<SparseOperationPatternCache> sparse_patterns_ {
+        std::make_shared<SparseOperationPatternCache>()};
+
   private:
     /** Sparse dwdp implicit temporary storage (shape `ndwdp`) */
     mutable std::vector<SUNMatrixWrapper> dwdp_hierarchical_;
@@ -1838,6 +1988,24 @@ class Model : public AbstractModel, public ModelDimensions {
     /** Sparse dwdx implicit temporary storage (shape `ndwdx`) */
     mutable std::vector<SUNMatrixWrapper> dwdx_hierarchical_;
 
+    /** Patterns of the products dwdw * dwdp_hierarchical_, taken from
+     * sparse_patterns_ on first use (shape `w_recursion_depth_`) */
+    std::vector<std::shared_ptr<const SparseOperationPattern>>
+        dwdp_multiply_patterns_;
+
+    /** Pattern of the sum of dwdp_hierarchical_, taken from
+     * sparse_patterns_ on first use */
+    std::shared_ptr<const SparseOperationPattern> dwdp_sum_pattern_;
+
+    /** Patterns of the products dwdw * dwdx_hierarchical_, taken from
+     * sparse_patterns_ on first use (shape `w_recursion_depth_`) */
+    std::vector<std::shared_ptr<const SparseOperationPattern>>
+        dwdx_multiply_patterns_;
+
+    /** Pattern of the sum of dwdx_hierarchical_, taken from
+     * sparse_patterns_ on first use */
+    std::shared_ptr<const SparseOperationPattern> dwdx_sum_pattern_;
+
     /** Recursion */
     int w_recursion_depth_ {0};
 
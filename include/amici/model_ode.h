@@ -40,6 +40,10 @@ class Model_ODE : public Model {
      * @param ndxdotdp_explicit number of nonzero elements dxdotdp_explicit
      * @param ndxdotdx_explicit number of nonzero elements dxdotdx_explicit
      * @param w_recursion_depth Recursion depth of fw
+     * @param time_triggered_events indices of events that only depend on
+     * time and parameters
+     * @param state_sensitivity_structure indices of the solver states with
+     * structurally nonzero sensitivities for each parameter
      */
     Model_ODE(ModelDimensions const& model_dimensions,
               SimulationParameters simulation_parameters,
@@ -47,10 +51,14 @@ class Model_ODE : public Model {
               std::vector<realtype> const &idlist,
               std::vector<int> const &z2event, const bool pythonGenerated=false,
               const int ndxdotdp_explicit=0, const int ndxdotdx_explicit=0,
-              const int w_recursion_depth=0)
+              const int w_recursion_depth=0,
+              std::vector<int> const &time_triggered_events={},
+              std::vector<std::vector<int>> const
+                  &state_sensitivity_structure={})
         : Model(model_dimensions, simulation_parameters,
                 o2mode, idlist, z2event, pythonGenerated,
-                ndxdotdp_explicit, ndxdotdx_explicit, w_recursion_depth) {}
+                ndxdotdp_explicit, ndxdotdx_explicit, w_recursion_depth,
+                time_triggered_events, state_sensitivity_structure) {}
 
     void fJ(realtype t, realtype cj, const AmiVector &x, const AmiVector &dx,
             const AmiVector &xdot, SUNMatrix J) override;
@@ -150,6 +158,23 @@ class Model_ODE : public Model {
      **/
     void fJv(const_N_Vector v, N_Vector Jv, realtype t, const_N_Vector x);
 
+    /**
+     * @brief Evaluates the Jacobian that is used by subsequent calls to
+     * fJv(const_N_Vector, N_Vector)
+     * @param t timepoint
+     * @param x Vector with the states
+     **/
+    void fJvSetup(realtype t, const_N_Vector x);
+
+    /**
+     * @brief Jacobian vector product with the Jacobian evaluated by the last
+     * call to fJvSetup
+     * @param v Vector with which the Jacobian is multiplied
+     * @param Jv Vector to which the Jacobian vector product will be
+     * written
+     **/
+    void fJv(const_N_Vector v, N_Vector Jv);
+
     /**
      * @brief Implementation of fJvB at the N_Vector level
      * @param t timepoint
@@ -161,6 +186,23 @@ class Model_ODE : public Model {
     void fJvB(const_N_Vector vB, N_Vector JvB, realtype t, const_N_Vector x,
               const_N_Vector xB);
 
+    /**
+     * @brief Evaluates the backward Jacobian that is used by subsequent calls
+     * to fJvB(const_N_Vector, N_Vector)
+     * @param t timepoint
+     * @param x Vector with the states
+     * @param xB Vector with the adjoint states
+     **/
+    void fJvSetupB(realtype t, const_N_Vector x, const_N_Vector xB);
+
+    /**
+     * @brief Jacobian vector product with the backward Jacobian evaluated by
+     * the last call to fJvSetupB
+     * @param vB Vector with which the Jacobian is multiplied
+     * @param JvB Vector to which the Jacobian vector product will be written
+     **/
+    void fJvB(const_N_Vector vB, N_Vector JvB);
+
     void froot(realtype t, const AmiVector &x, const AmiVector &dx,
                gsl::span<realtype> root) override;
 
@@ -257,9 +299,26 @@ class Model_ODE : public Model {
      * @param ip parameter index
      * @param sx Vector with the state sensitivities
      * @param sxdot Vector with the sensitivity right hand side
+     * @param update whether dxdotdp and the Jacobian need to be evaluated
+     * at (t, x), i.e. if this is the first sensitivity for this state
      */
     void fsxdot(realtype t, const_N_Vector x, int ip, const_N_Vector sx,
-                N_Vector sxdot);
+                N_Vector sxdot, bool update);
+
+    /**
+     * @brief Sensitivity right hand side for all parameters at once
+     *
+     * Computes `J * sx + dxdotdp` for all sensitivities with a single pass
+     * over the Jacobian.
+     * @param t timepoint
+     * @param x Vector with the states
+     * @param ips parameter indices of the sensitivities
+     * @param sx Vectors with the state sensitivities (dimension: `ips`)
+     * @param sxdot Vectors with the sensitivity right hand sides
+     * (dimension: `ips`)
+     */
+    void fsxdot(realtype t, const_N_Vector x, gsl::span<const int> ips,
+                gsl::span<const N_Vector> sx, gsl::span<N_Vector> sxdot);
 
     std::unique_ptr<Solver> getSolver() override;
 
@@ -448,6 +507,23 @@ class Model_ODE : public Model {
     void fdxdotdp(realtype t, const_N_Vector x);
 
     void fdxdotdp(realtype t, const AmiVector &x, const AmiVector &dx) override;
+
+  private:
+    /* Symbolic phases of the sparse matrix operations below, taken from
+     * Model::sparse_patterns_ on first use. They only depend on the model
+     * structure and are computed once for a model and all its clones. */
+
+    /** pattern of dxdotdw * dwdx */
+    std::shared_ptr<const SparseOperationPattern> dxdotdx_implicit_pattern_;
+
+    /** pattern of dxdotdx_explicit + dxdotdx_implicit */
+    std::shared_ptr<const SparseOperationPattern> J_pattern_;
+
+    /** pattern of dxdotdw * dwdp */
+    std::shared_ptr<const SparseOperationPattern> dxdotdp_implicit_pattern_;
+
+    /** pattern of dxdotdp_explicit + dxdotdp_implicit */
+    std::shared_ptr<const SparseOperationPattern> dxdotdp_full_pattern_;
 };
 } // namespace amici
 
@@ -67,6 +67,16 @@ struct ModelStateDerived {
     /** Sparse Backwards Jacobian (dimension: `amici::Model::nnz`) */
     SUNMatrixWrapper JB_;
 
+    /** Sparse Jacobian for Jacobian vector products of iterative linear
+     * solvers, kept from Model_ODE::fJvSetup until the end of the linear
+     * solve (dimension: `amici::Model::nnz`) */
+    SUNMatrixWrapper Jv_;
+
+    /** Sparse Backwards Jacobian for Jacobian vector products of iterative
+     * linear solvers, kept from Model_ODE::fJvSetupB until the end of the
+     * linear solve (dimension: `amici::Model::nnz`) */
+    SUNMatrixWrapper JvB_;
+
     /** Sparse dxdotdw temporary storage (dimension: `ndxdotdw`) */
     SUNMatrixWrapper dxdotdw_;
 
@@ -141,6 +151,18 @@ struct ModelStateDerived {
      */
     AmiVectorArray dxdotdp {0, 0};
 
+    /**
+     * Temporary storage of state sensitivities for the blocked sensitivity
+     * right hand side (dimension: `nx_solver` x `nplist`, row-major)
+     */
+    std::vector<realtype> sx_block_;
+
+    /**
+     * Temporary storage of the blocked sensitivity right hand side
+     * (dimension: `nx_solver` x `nplist`, row-major)
+     */
+    std::vector<realtype> sxdot_block_;
+
     /** Sparse observable derivative of data likelihood, only used if
      * `pythonGenerated` == `true` (dimension `nytrue`, `nJ` x `ny`, row-major)
      */
@@ -230,11 +252,6 @@ struct ModelStateDerived {
     /** temporary storage of w data across functions (dimension: nw) */
     std::vector<realtype> w_;
 
-    /** temporary storage for flattened sx,
-     * (dimension: `nx_solver` x `nplist`, row-major)
-     */
-    std::vector<realtype> sx_;
-
     /** temporary storage for `x_rdata` (dimension: `nx_rdata`) */
     std::vector<realtype> x_rdata_;
 
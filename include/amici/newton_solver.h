@@ -5,6 +5,7 @@
 #include "amici/defines.h"
 #include "amici/sundials_matrix_wrapper.h"
 #include "amici/sundials_linsol_wrapper.h"
+#include "amici/preconditioner.h"
 
 #include <memory>
 
@@ -46,6 +47,9 @@ class NewtonSolver {
     /**
      * @brief Computes the solution of one Newton iteration
      *
+     * If reuse_jacobian_ is set, the factorization of the previous call is
+     * reused, unless resetJacobian() was called in between.
+     *
      * @param ntry integer newton_try integer start number of Newton solver
      * (1 or 2)
      * @param nnewt integer number of current Newton step
@@ -54,13 +58,54 @@ class NewtonSolver {
      */
     void getStep(int ntry, int nnewt, AmiVector &delta);
 
+    /**
+     * @brief Enforces evaluation and factorization of the Jacobian in the
+     * next call to getStep
+     */
+    void resetJacobian() { jacobian_age_ = -1; }
+
+    /**
+     * @brief Number of calls to getStep since the Jacobian used by getStep
+     * was evaluated
+     *
+     * @return 0 if the last step was computed with a Jacobian evaluated at
+     * the current state, -1 if no Jacobian is available
+     */
+    int getJacobianAge() const { return jacobian_age_; }
+
+    /**
+     * @brief Accessor for the number of Jacobian evaluations
+     *
+     * @return number of Jacobian evaluations
+     */
+    int getNumJacobianEvaluations() const { return num_jac_evals_; }
+
+    /**
+     * @brief Accessor for the number of Jacobian factorizations
+     *
+     * @return number of Jacobian factorizations
+     */
+    int getNumFactorizations() const { return num_factorizations_; }
+
     /**
      * @brief Computes steady state sensitivities
      *
+     * Reuses the factorization of the Jacobian if it was computed at the
+     * current state.
+     *
      * @param sx pointer to state variable sensitivities
      */
     void computeNewtonSensis(AmiVectorArray &sx);
 
+    /**
+     * @brief Checks whether the linear solver holds a factorization of the
+     * Jacobian J (not JB) evaluated at the given state and the current time
+     *
+     * @param x state
+     * @return true if the factorization can be reused for x
+     */
+    bool isFactorizedAt(AmiVector const &x) const;
+
     /**
      * @brief Accessor for numlinsteps
      *
@@ -90,6 +135,14 @@ class NewtonSolver {
      */
     virtual void prepareLinearSystemB(int ntry, int nnewt) = 0;
 
+    /**
+     * @brief Writes the iteration matrix \f$ I - h J \f$ of an implicit
+     * Euler step with step size h and passes it to the linear solver
+     *
+     * @param h (pseudo-)time step size
+     */
+    virtual void prepareShiftedLinearSystem(realtype h);
+
     /**
      * @brief Solves the linear system for the Newton step
      *
@@ -98,6 +151,26 @@ class NewtonSolver {
      */
     virtual void solveLinearSystem(AmiVector &rhs) = 0;
 
+    /**
+     * @brief Solves the linear system for multiple right hand sides
+     *
+     * @param rhs containing the RHSs of the linear system, will be
+     * overwritten by the solutions to the linear system
+     */
+    virtual void solveLinearSystems(AmiVectorArray &rhs);
+
+    /**
+     * @brief Solves the transposed linear system \f$ J^T x = b \f$ at the
+     * current state. By default, this sets up and solves the linear system
+     * for \f$ JB = -J^T \f$. Linear solvers that support transposed solves
+     * instead use the factorization of J at the current state, which is
+     * shared with computeNewtonSensis.
+     *
+     * @param rhs containing the RHS of the linear system, will be
+     * overwritten by solution to the linear system
+     */
+    virtual void solveLinearSystemTransposed(AmiVector &rhs);
+
     virtual ~NewtonSolver() = default;
 
     /** maximum number of allowed linear steps per Newton step for steady state
@@ -113,6 +186,11 @@ class NewtonSolver {
     NewtonDampingFactorMode damping_factor_mode_ {NewtonDampingFactorMode::on};
     /** damping factor lower bound */
     realtype damping_factor_lower_bound {1e-8};
+    /** reuse the Jacobian factorization across Newton steps */
+    bool reuse_jacobian_ {false};
+    /** residual reduction per Newton step above which the Jacobian is
+     * reevaluated if reuse_jacobian_ is set */
+    realtype jacobian_reuse_contraction_ {0.5};
 
   protected:
     /** time variable */
@@ -131,6 +209,20 @@ class NewtonSolver {
     AmiVector xB_;
     /** current adjoint state time derivative (DAE) */
     AmiVector dxB_;
+    /** number of getStep calls since the last Jacobian evaluation, -1 if
+     * the Jacobian needs to be reevaluated */
+    int jacobian_age_ {-1};
+    /** number of Jacobian evaluations */
+    int num_jac_evals_ {0};
+    /** number of Jacobian factorizations */
+    int num_factorizations_ {0};
+    /** state at which the current factorization of J was computed */
+    AmiVector x_factorized_;
+    /** time at which the current factorization of J was computed */
+    realtype t_factorized_ {NAN};
+    /** flag indicating whether the linear solver holds a factorization of J
+     * at x_factorized_ */
+    bool factorized_ {false};
 };
 
 /**
@@ -186,6 +278,32 @@ class NewtonSolverDense : public NewtonSolver {
      */
     void prepareLinearSystemB(int ntry, int nnewt) override;
 
+    /**
+     * @brief Writes the iteration matrix \f$ I - h J \f$ of an implicit
+     * Euler step with step size h and passes it to the linear solver
+     *
+     * @param h (pseudo-)time step size
+     */
+    void prepareShiftedLinearSystem(realtype h) override;
+
+    /**
+     * @brief Solves the linear system for multiple right hand sides in a
+     * single blocked solve
+     *
+     * @param rhs containing the RHSs of the linear system, will be
+     * overwritten by the solutions to the linear system
+     */
+    void solveLinearSystems(AmiVectorArray &rhs) override;
+
+    /**
+     * @brief Solves the transposed linear system with the factorization
+     * of J at the current state, which is computed if not available yet
+     *
+     * @param rhs containing the RHS of the linear system, will be
+     * overwritten by solution to the linear system
+     */
+    void solveLinearSystemTransposed(AmiVector &rhs) override;
+
   private:
     /** temporary storage of Jacobian */
     SUNMatrixWrapper Jtmp_;
@@ -246,17 +364,61 @@ class NewtonSolverSparse : public NewtonSolver {
      */
     void prepareLinearSystemB(int ntry, int nnewt) override;
 
+    /**
+     * @brief Writes the iteration matrix \f$ I - h J \f$ of an implicit
+     * Euler step with step size h and passes it to the linear solver
+     *
+     * @param h (pseudo-)time step size
+     */
+    void prepareShiftedLinearSystem(realtype h) override;
+
+    /**
+     * @brief Solves the linear system for multiple right hand sides in a
+     * single blocked solve
+     *
+     * @param rhs containing the RHSs of the linear system, will be
+     * overwritten by the solutions to the linear system
+     */
+    void solveLinearSystems(AmiVectorArray &rhs) override;
+
+    /**
+     * @brief Solves the transposed linear system with the factorization
+     * of J at the current state, which is computed if not available yet
+     *
+     * @param rhs containing the RHS of the linear system, will be
+     * overwritten by solution to the linear system
+     */
+    void solveLinearSystemTransposed(AmiVector &rhs) override;
+
   private:
+    /**
+     * @brief Factorizes Jtmp_. The symbolic analysis is redone if the
+     * sparsity pattern differs from the previous factorization (J, JB or
+     * I - hJ).
+     */
+    void setupLinearSolver();
+
     /** temporary storage of Jacobian */
     SUNMatrixWrapper Jtmp_;
 
     /** sparse linear solver */
     SUNLinearSolver linsol_ {nullptr};
+
+    /** column pointers of the last factorized matrix */
+    std::vector<sunindextype> factorized_indexptrs_;
+
+    /** row indices of the last factorized matrix */
+    std::vector<sunindextype> factorized_indexvals_;
 };
 
 /**
  * @brief The NewtonSolverIterative provides access to the iterative linear
- * solver for the Newton method.
+ * solvers (BiCGStab or restarted GMRES) for the Newton method.
+ *
+ * The linear systems are right-preconditioned with the preconditioner
+ * selected via Solver::setPreconditionerType, computed from the sparse
+ * Jacobian. Without preconditioner, the systems are scaled by the absolute
+ * values of the Jacobian diagonal.
  */
 
 class NewtonSolverIterative : public NewtonSolver {
@@ -267,14 +429,22 @@ class NewtonSolverIterative : public NewtonSolver {
      * @param t pointer to time variable
      * @param x pointer to state variables
      * @param model pointer to the model object
+     * @param linsol_type Krylov method, LinearSolver::SPBCG or
+     * LinearSolver::SPGMR
+     * @param preconditioner_type preconditioner type
      */
-    NewtonSolverIterative(realtype *t, AmiVector *x, Model *model);
+    NewtonSolverIterative(
+        realtype *t, AmiVector *x, Model *model,
+        LinearSolver linsol_type = LinearSolver::SPBCG,
+        PreconditionerType preconditioner_type = PreconditionerType::none);
 
     ~NewtonSolverIterative() override = default;
 
     /**
      * @brief Solves the linear system for the Newton step by passing it to
-     * linsolveSPBCG
+     * linsolveSPBCG or linsolveSPGMR. If this fails with a reused
+     * preconditioner, the preconditioner is recomputed and the solve is
+     * repeated.
      *
      * @param rhs containing the RHS of the linear system, will be
      * overwritten by solution to the linear system
@@ -303,6 +473,14 @@ class NewtonSolverIterative : public NewtonSolver {
      */
     void prepareLinearSystemB(int ntry, int nnewt) override;
 
+    /**
+     * @brief Writes the iteration matrix \f$ I - h J \f$ of an implicit
+     * Euler step with step size h and passes it to the linear solver
+     *
+     * @param h (pseudo-)time step size
+     */
+    void prepareShiftedLinearSystem(realtype h) override;
+
     /**
      * Iterative linear solver created from SPILS BiCG-Stab.
      * Solves the linear system within each Newton step if iterative solver is
@@ -311,15 +489,91 @@ class NewtonSolverIterative : public NewtonSolver {
      * @param ntry integer newton_try integer start number of Newton solver
      * (1 or 2)
      * @param nnewt integer number of current Newton step
-     * @param ns_delta Newton step
+     * @param ns_delta containing the RHS of the linear system, will be
+     * overwritten by solution to the linear system
      */
     void linsolveSPBCG(int ntry, int nnewt, AmiVector &ns_delta);
 
+    /**
+     * Restarted GMRES.
+     * Solves the linear system within each Newton step if iterative solver is
+     * chosen.
+     *
+     * @param ntry integer newton_try integer start number of Newton solver
+     * (1 or 2)
+     * @param nnewt integer number of current Newton step
+     * @param ns_delta containing the RHS of the linear system, will be
+     * overwritten by solution to the linear system
+     */
+    void linsolveSPGMR(int ntry, int nnewt, AmiVector &ns_delta);
+
+    /** reuse the preconditioner across Newton steps, as long as the number
+     * of linear iterations does not grow too much */
+    bool reuse_preconditioner_ {false};
+
   private:
+    /**
+     * @brief Sets the matrix \f$ \alpha I + \beta J \f$ of the linear
+     * system, with J in ns_J_, and computes the preconditioner or the
+     * diagonal scaling for it
+     * @param alpha diagonal shift
+     * @param beta Jacobian scaling factor
+     * @param backward flag indicating whether ns_J_ holds JB
+     */
+    void setupLinearSystem(realtype alpha, realtype beta, bool backward);
+
+    /**
+     * @brief Computes the preconditioner from ns_J_ for the current linear
+     * system
+     */
+    void setupPreconditioner();
+
+    /**
+     * @brief Computes Av = (alpha I + beta J) v
+     * @param v vector
+     * @param Av result
+     */
+    void multiplyMatrix(AmiVector const &v, AmiVector &Av) const;
+
+    /**
+     * @brief Applies the preconditioner, z = P^{-1} r
+     * @param r vector
+     * @param z result
+     */
+    void applyPreconditioner(AmiVector const &r, AmiVector &z) const;
+
     /** number of tries  */
     int newton_try_ {0};
     /** number of iterations  */
     int i_newton_ {0};
+    /** Krylov method */
+    LinearSolver linsol_type_ {LinearSolver::SPBCG};
+    /** maximum dimension of the Krylov subspace before GMRES restarts */
+    int max_krylov_dim_ {20};
+    /** diagonal shift of the current linear system */
+    realtype alpha_ {0.0};
+    /** Jacobian scaling factor of the current linear system */
+    realtype beta_ {1.0};
+    /** flag indicating whether the current linear system is built from JB */
+    bool backward_ {false};
+    /** preconditioner, nullptr if the diagonal scaling is used */
+    std::unique_ptr<Preconditioner> preconditioner_;
+    /** flag indicating whether the preconditioner was computed */
+    bool preconditioner_valid_ {false};
+    /** diagonal shift the preconditioner was computed for */
+    realtype preconditioner_alpha_ {0.0};
+    /** Jacobian scaling factor the preconditioner was computed for */
+    realtype preconditioner_beta_ {0.0};
+    /** flag indicating whether the preconditioner was computed from JB */
+    bool preconditioner_backward_ {false};
+    /** flag indicating whether the preconditioner was computed from the
+     * current Jacobian */
+    bool preconditioner_current_ {false};
+    /** number of linear iterations of the first solve with the current
+     * preconditioner, -1 if not solved yet */
+    int preconditioner_lin_steps_ {-1};
+    /** number of linear iterations of the last solve */
+    int last_lin_steps_ {0};
     /** ???  */
     AmiVector ns_p_;
     /** ???  */
@@ -340,8 +594,18 @@ class NewtonSolverIterative : public NewtonSolver {
     AmiVector ns_tmp_;
     /** ???  */
     AmiVector ns_Jdiag_;
-    /** temporary storage of Jacobian */
+    /** temporary storage of the sparse Jacobian */
     SUNMatrixWrapper ns_J_;
+    /** orthonormal basis of the Krylov subspace (GMRES) */
+    std::vector<AmiVector> ns_V_;
+    /** Hessenberg matrix (GMRES), column-major */
+    std::vector<realtype> ns_H_;
+    /** cosines of the Givens rotations (GMRES) */
+    std::vector<realtype> ns_cs_;
+    /** sines of the Givens rotations (GMRES) */
+    std::vector<realtype> ns_sn_;
+    /** rotated residual vector (GMRES) */
+    std::vector<realtype> ns_g_;
 };
 
 
@@ -0,0 +1,168 @@
+#ifndef AMICI_PRECONDITIONER_H
+#define AMICI_PRECONDITIONER_H
+
+#include "amici/defines.h"
+#include "amici/sundials_matrix_wrapper.h"
+
+#include <gsl/gsl-lite.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace amici {
+
+/**
+ * @brief Base class for preconditioners of the Krylov linear solvers.
+ *
+ * A preconditioner approximates the iteration matrix
+ * \f$ M = \alpha I + \beta J \f$, where \f$ J \f$ is a sparse (CSC) Jacobian
+ * that is written to the matrix returned by getJacobian(). For the CVODES
+ * Newton iteration \f$ \alpha = 1 \f$ and \f$ \beta = -\gamma \f$.
+ */
+class Preconditioner {
+  public:
+    /**
+     * @brief Constructor
+     * @param n number of rows/columns of the Jacobian
+     * @param nnz number of nonzero entries of the Jacobian
+     */
+    Preconditioner(sunindextype n, sunindextype nnz);
+
+    virtual ~Preconditioner() = default;
+
+    /**
+     * @brief Create a preconditioner of the given type
+     * @param type preconditioner type
+     * @param n number of rows/columns of the Jacobian
+     * @param nnz number of nonzero entries of the Jacobian
+     * @return the preconditioner, nullptr for PreconditionerType::none
+     */
+    static std::unique_ptr<Preconditioner>
+    create(PreconditionerType type, sunindextype n, sunindextype nnz);
+
+    /**
+     * @brief Sparse Jacobian the preconditioner is computed from
+     * @return Jacobian
+     */
+    SUNMatrixWrapper &getJacobian();
+
+    /**
+     * @brief Compute the preconditioner for \f$ \alpha I + \beta J \f$
+     * @param alpha diagonal shift
+     * @param beta Jacobian scaling factor
+     * @return AMICI_SUCCESS, or AMICI_RECOVERABLE_ERROR if a zero pivot was
+     * encountered
+     */
+    virtual int setup(realtype alpha, realtype beta) = 0;
+
+    /**
+     * @brief Apply the preconditioner, i.e. solve \f$ P z = r \f$
+     * @param r right hand side
+     * @param z solution
+     */
+    virtual void solve(gsl::span<const realtype> r,
+                       gsl::span<realtype> z) const = 0;
+
+  protected:
+    /** dimension */
+    sunindextype n_;
+
+    /** Jacobian */
+    SUNMatrixWrapper J_;
+};
+
+/**
+ * @brief Diagonal (Jacobi) preconditioner
+ */
+class JacobiPreconditioner : public Preconditioner {
+  public:
+    /**
+     * @brief Constructor
+     * @param n number of rows/columns of the Jacobian
+     * @param nnz number of nonzero entries of the Jacobian
+     */
+    JacobiPreconditioner(sunindextype n, sunindextype nnz);
+
+    int setup(realtype alpha, realtype beta) override;
+
+    void solve(gsl::span<const realtype> r,
+               gsl::span<realtype> z) const override;
+
+  private:
+    /** inverse diagonal */
+    std::vector<realtype> inv_diag_;
+};
+
+/**
+ * @brief Block-Jacobi preconditioner
+ *
+ * Uses dense LU factorizations (with partial pivoting) of consecutive
+ * diagonal blocks of fixed size.
+ */
+class BlockJacobiPreconditioner : public Preconditioner {
+  public:
+    /**
+     * @brief Constructor
+     * @param n number of rows/columns of the Jacobian
+     * @param nnz number of nonzero entries of the Jacobian
+     * @param block_size size of the diagonal blocks
+     */
+    BlockJacobiPreconditioner(sunindextype n, sunindextype nnz,
+                              sunindextype block_size = 16);
+
+    int setup(realtype alpha, realtype beta) override;
+
+    void solve(gsl::span<const realtype> r,
+               gsl::span<realtype> z) const override;
+
+  private:
+    /** size of the diagonal blocks (the last one may be smaller) */
+    sunindextype block_size_;
+
+    /** row-major LU factors of the diagonal blocks */
+    std::vector<realtype> lu_;
+
+    /** row pivots of the diagonal blocks */
+    std::vector<sunindextype> pivots_;
+};
+
+/**
+ * @brief Incomplete LU factorization without fill-in (ILU(0))
+ *
+ * The factorization is computed on the sparsity pattern of the Jacobian,
+ * extended by the diagonal.
+ */
+class ILUPreconditioner : public Preconditioner {
+  public:
+    /**
+     * @brief Constructor
+     * @param n number of rows/columns of the Jacobian
+     * @param nnz number of nonzero entries of the Jacobian
+     */
+    ILUPreconditioner(sunindextype n, sunindextype nnz);
+
+    int setup(realtype alpha, realtype beta) override;
+
+    void solve(gsl::span<const realtype> r,
+               gsl::span<realtype> z) const override;
+
+  private:
+    /** row pointers of the CSR factors */
+    std::vector<sunindextype> row_ptrs_;
+
+    /** column indices of the CSR factors */
+    std::vector<sunindextype> col_idxs_;
+
+    /** position of the diagonal entry in each row */
+    std::vector<sunindextype> diag_idxs_;
+
+    /** values of L (unit diagonal not stored) and U */
+    std::vector<realtype> values_;
+
+    /** work array mapping column index to position in the current row */
+    std::vector<sunindextype> work_;
+};
+
+} // namespace amici
+
+#endif // AMICI_PRECONDITIONER_H
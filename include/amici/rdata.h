@@ -92,6 +92,16 @@ class ReturnData: public ModelDimensions {
                                   SteadystateProblem const *posteq,
                                   Model &model, Solver const &solver,
                                   ExpData const *edata);
+
+    /**
+     * @brief Check whether the inner parameters of the model (see
+     * Model::setInnerScalingParameters) can be computed analytically for the
+     * given data and sensitivity settings
+     * @param model model with inner parameters
+     * @param edata experimental data
+     */
+    void checkInnerParameters(Model const &model, ExpData const &edata) const;
+
     /**
      * @brief Arbitrary (not necessarily unique) identifier.
      */
@@ -225,7 +235,30 @@ class ReturnData: public ModelDimensions {
     /** computation time of backward solve [ms] */
     double cpu_timeB = 0.0;
 
-    /** flags indicating success of steady state solver (preequilibration) */
+    /** number of checkpoints stored during the forward solve (adjoint
+     * sensitivities) */
+    int numcheckpoints = 0;
+
+    /**
+     * number of right hand side evaluations required to recompute the forward
+     * solution from checkpoints during the backward solve
+     */
+    int numrecomputedrhsevals = 0;
+
+    /**
+     * number of output timepoints at which the solution was interpolated
+     * instead of stopping the integrator (see
+     * Solver::setInterpolatedOutput). Each of them would otherwise have
+     * required an integration step ending at that timepoint.
+     */
+    int numinterpolatedoutputs = 0;
+
+    /**
+     * flags indicating success of steady state solver (preequilibration)
+     * [newton, simulation, newton] (shape `3`). The second run of Newton's
+     * method starts from the result of pseudo-transient continuation, if
+     * enabled and converged, or otherwise of simulation.
+     */
     std::vector<SteadyStateStatus> preeq_status;
 
     /** computation time of the steady state solver [ms] (preequilibration) */
@@ -235,7 +268,10 @@ class ReturnData: public ModelDimensions {
      *  (preequilibration) */
     double preeq_cpu_timeB = 0.0;
 
-    /** flags indicating success of steady state solver  (postequilibration) */
+    /**
+     * flags indicating success of steady state solver (postequilibration)
+     * [newton, simulation, newton] (shape `3`), see preeq_status
+     */
     std::vector<SteadyStateStatus> posteq_status;
 
     /** computation time of the steady state solver [ms]  (postequilibration) */
@@ -247,7 +283,7 @@ class ReturnData: public ModelDimensions {
 
     /**
      * number of Newton steps for steady state problem (preequilibration)
-     * [newton, simulation, newton] (length = 3)
+     * [newton, simulation, newton] (shape `3`), see preeq_status
      */
     std::vector<int> preeq_numsteps;
 
@@ -265,8 +301,35 @@ class ReturnData: public ModelDimensions {
     int preeq_numstepsB = 0;
 
     /**
-     * number of Newton steps for steady state problem (preequilibration)
-     * [newton, simulation, newton] (shape `3`) (postequilibration)
+     * number of Jacobian evaluations of the Newton solver for the steady state
+     * problem, including sensitivities and the adjoint problem
+     * (preequilibration)
+     */
+    int preeq_numjacevals = 0;
+
+    /**
+     * number of Jacobian factorizations (preconditioner setups for iterative
+     * linear solvers) of the Newton solver for the steady state problem,
+     * including sensitivities and the adjoint problem (preequilibration)
+     */
+    int preeq_numfactorizations = 0;
+
+    /**
+     * number of accepted pseudo-transient continuation steps for steady state
+     * problem (preequilibration)
+     */
+    int preeq_ptc_numsteps = 0;
+
+    /**
+     * number of linear system solves (including rejected steps) of
+     * pseudo-transient continuation for steady state problem
+     * (preequilibration)
+     */
+    int preeq_ptc_numlinsolves = 0;
+
+    /**
+     * number of Newton steps for steady state problem (postequilibration)
+     * [newton, simulation, newton] (shape `3`), see preeq_status
      */
     std::vector<int> posteq_numsteps;
 
@@ -283,6 +346,33 @@ class ReturnData: public ModelDimensions {
      */
     int posteq_numstepsB = 0;
 
+    /**
+     * number of Jacobian evaluations of the Newton solver for the steady state
+     * problem, including sensitivities and the adjoint problem
+     * (postequilibration)
+     */
+    int posteq_numjacevals = 0;
+
+    /**
+     * number of Jacobian factorizations (preconditioner setups for iterative
+     * linear solvers) of the Newton solver for the steady state problem,
+     * including sensitivities and the adjoint problem (postequilibration)
+     */
+    int posteq_numfactorizations = 0;
+
+    /**
+     * number of accepted pseudo-transient continuation steps for steady state
+     * problem (postequilibration)
+     */
+    int posteq_ptc_numsteps = 0;
+
+    /**
+     * number of linear system solves (including rejected steps) of
+     * pseudo-transient continuation for steady state problem
+     * (postequilibration)
+     */
+    int posteq_ptc_numlinsolves = 0;
+
     /**
      * time when steadystate was reached via simulation (preequilibration)
      */
@@ -335,6 +425,16 @@ class ReturnData: public ModelDimensions {
      */
     std::vector<realtype> s2llh;
 
+    /**
+     * optimal values of the inner parameters (unscaled), NaN for parameters
+     * that are not inner parameters (shape `np`), empty if the model has no
+     * inner parameters, see Model::setInnerScalingParameters. Scaling
+     * parameters that cannot be determined from the data, because the
+     * scaled part of the observables is zero (or constant, if there is also
+     * an offset), keep their current value.
+     */
+    std::vector<realtype> inner_parameters;
+
     /** status code */
     int status = 0;
 
@@ -416,6 +516,9 @@ class ReturnData: public ModelDimensions {
      * (shape `ne`) */
     std::vector<int> nroots_;
 
+    /** model state with inner parameters applied */
+    ModelState inner_model_state_;
+
     /**
      * @brief initializes storage for likelihood reporting mode
      * @param quadratic_llh whether model defines a quadratic nllh and computing res, sres and FIM
@@ -471,6 +574,25 @@ class ReturnData: public ModelDimensions {
                                ExpData const *edata);
 
 
+    /**
+     * @brief Computes the optimal values of the inner parameters, which are
+     * applied to the model state by all subsequent calls to
+     * readSimulationState
+     * @param fwd forward problem
+     * @param posteq SteadystateProblem for postequilibration, may be nullptr
+     * @param model model that was used for forward simulation
+     * @param edata ExpData instance containing observable data
+     */
+    void fitInnerParameters(ForwardProblem const &fwd,
+                            SteadystateProblem const *posteq, Model &model,
+                            ExpData const &edata);
+
+    /**
+     * @brief Sets the inner parameters in the current model state
+     * @param model model that was used for forward simulation
+     */
+    void applyInnerParameters(Model &model);
+
     /**
      * @brief extracts results from backward problem
      * @param fwd forward problem
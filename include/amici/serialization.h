@@ -68,18 +68,26 @@ void serialize(Archive &ar, amici::Solver &s, const unsigned int /*version*/) {
     ar &s.ss_rtol_sensi_;
     ar &s.maxsteps_;
     ar &s.maxstepsB_;
+    ar &s.checkpoint_memory_budget_;
+    ar &s.checkpoint_spill_;
     ar &s.requires_preequilibration_;
     ar &s.newton_maxsteps_;
     ar &s.newton_maxlinsteps_;
     ar &s.newton_damping_factor_mode_;
     ar &s.newton_damping_factor_lower_bound_;
+    ar &s.newton_jacobian_reuse_;
+    ar &s.steady_state_ptc_;
+    ar &s.steady_state_concurrent_search_;
+    ar &s.steady_state_warm_start_mode_;
     ar &s.ism_;
     ar &s.sensi_meth_;
     ar &s.linsol_;
+    ar &s.preconditioner_type_;
     ar &s.interp_type_;
     ar &s.lmm_;
     ar &s.iter_;
     ar &s.stldet_;
+    ar &s.interpolated_output_;
     ar &s.ordering_;
     ar &s.cpu_time_;
     ar &s.cpu_timeB_;
@@ -125,6 +133,8 @@ void serialize(Archive &ar, amici::Model &m, const unsigned int /*version*/) {
     ar &m.simulation_parameters_;
     ar &m.o2mode;
     ar &m.z2event_;
+    ar &m.time_triggered_events_;
+    ar &m.state_sensitivity_structure_;
     ar &m.idlist;
     ar &m.state_.h;
     ar &m.state_.unscaledParameters;
@@ -137,6 +147,9 @@ void serialize(Archive &ar, amici::Model &m, const unsigned int /*version*/) {
     ar &m.pythonGenerated;
     ar &m.min_sigma_;
     ar &m.sigma_res_;
+    ar &m.inner_scaling_idxs_;
+    ar &m.inner_offset_idxs_;
+    ar &m.inner_sigma_idxs_;
 }
 
 
@@ -207,11 +220,18 @@ void serialize(Archive &ar, amici::ReturnData &r, const unsigned int /*version*/
     ar &r.order;
     ar &r.cpu_time;
     ar &r.cpu_timeB;
+    ar &r.numcheckpoints;
+    ar &r.numrecomputedrhsevals;
+    ar &r.numinterpolatedoutputs;
     ar &r.preeq_cpu_time;
     ar &r.preeq_cpu_timeB;
     ar &r.preeq_status;
     ar &r.preeq_numsteps;
     ar &r.preeq_numlinsteps;
+    ar &r.preeq_numjacevals;
+    ar &r.preeq_numfactorizations;
+    ar &r.preeq_ptc_numsteps;
+    ar &r.preeq_ptc_numlinsolves;
     ar &r.preeq_wrms;
     ar &r.preeq_t;
     ar &r.posteq_cpu_time;
@@ -219,6 +239,10 @@ void serialize(Archive &ar, amici::ReturnData &r, const unsigned int /*version*/
     ar &r.posteq_status;
     ar &r.posteq_numsteps;
     ar &r.posteq_numlinsteps;
+    ar &r.posteq_numjacevals;
+    ar &r.posteq_numfactorizations;
+    ar &r.posteq_ptc_numsteps;
+    ar &r.posteq_ptc_numlinsolves;
     ar &r.posteq_wrms;
     ar &r.posteq_t;
     ar &r.x0;
@@ -227,6 +251,7 @@ void serialize(Archive &ar, amici::ReturnData &r, const unsigned int /*version*/
     ar &r.chi2;
     ar &r.sllh;
     ar &r.s2llh;
+    ar &r.inner_parameters;
     ar &r.status;
 }
 
@@ -3,6 +3,7 @@
 
 #include "amici/amici.h"
 #include "amici/defines.h"
+#include "amici/preconditioner.h"
 #include "amici/sundials_linsol_wrapper.h"
 #include "amici/symbolic_functions.h"
 #include "amici/vector.h"
@@ -20,6 +21,7 @@ class BackwardProblem;
 class Model;
 class Solver;
 class AmiciApplication;
+class SteadyStateWarmStart;
 
 extern AmiciApplication defaultContext;
 } // namespace amici
@@ -54,7 +56,7 @@ class Solver {
     /**
      * @brief Default constructor
      */
-    Solver() = default;
+    Solver();
 
     /**
      * @brief Constructor
@@ -84,6 +86,15 @@ class Solver {
      */
     int run(realtype tout) const;
 
+    /**
+     * @brief makes a single step in the simulation, without integrating past
+     * the specified stop time
+     *
+     * @param tstop stop time
+     * @return status flag
+     */
+    int runOneStep(realtype tstop) const;
+
     /**
      * @brief makes a single step in the simulation
      *
@@ -281,6 +292,101 @@ class Solver {
      */
     void setNewtonDampingFactorLowerBound(double dampingFactorLowerBound);
 
+    /**
+     * @brief Get whether the Newton solver reuses the Jacobian factorization
+     * across iterations (modified Newton method)
+     * @return true if the factorization is reused
+     */
+    bool getNewtonJacobianReuse() const;
+
+    /**
+     * @brief Let the Newton solver reuse the Jacobian factorization across
+     * iterations and damping retries (modified Newton method). The Jacobian
+     * is only reevaluated if the residual decreases too slowly or a step is
+     * rejected. For the iterative linear solvers (LinearSolver::SPBCG,
+     * LinearSolver::SPGMR), the preconditioner is reused instead, until
+     * the number of linear iterations has doubled.
+     * @param reuse flag to turn Jacobian reuse on (true) or off (false)
+     */
+    void setNewtonJacobianReuse(bool reuse);
+
+    /**
+     * @brief Get whether pseudo-transient continuation is used to find a
+     * steady state if Newton's method fails
+     * @return true if pseudo-transient continuation is enabled
+     */
+    bool getSteadyStatePseudoTransientContinuation() const;
+
+    /**
+     * @brief Enable/disable pseudo-transient continuation for steady state
+     * computation.
+     *
+     * If enabled and Newton's method fails, the steady state is approached
+     * by implicit Euler steps with an adaptive pseudo-time step before
+     * switching back to Newton's method. Simulation is only used if this
+     * fails as well. The number of pseudo-time steps is limited by the
+     * maximum number of steps of the solver.
+     * @param ptc flag to turn pseudo-transient continuation on (true) or off
+     * (false)
+     */
+    void setSteadyStatePseudoTransientContinuation(bool ptc);
+
+    /**
+     * @brief Get whether Newton's method and simulation are run concurrently
+     * for preequilibration
+     * @return true if the concurrent steady state search is enabled
+     */
+    bool getSteadyStateConcurrentSearch() const;
+
+    /**
+     * @brief Enable/disable the concurrent steady state search for
+     * preequilibration.
+     *
+     * If enabled, Newton's method (followed by pseudo-transient continuation,
+     * if enabled) and simulation to steady state are started at the same
+     * time, the latter on copies of the model and solver. The first method
+     * that converges is used, the other one is stopped and reported as not
+     * run. Requires OpenMP support and an idle thread; within an OpenMP
+     * parallel region (e.g. runAmiciSimulations), nested parallelism needs
+     * to be enabled. Otherwise, both methods run one after the other.
+     * @param concurrent flag to turn the concurrent search on (true) or off
+     * (false)
+     */
+    void setSteadyStateConcurrentSearch(bool concurrent);
+
+    /**
+     * @brief Get the warm start mode for preequilibration
+     * @return warm start mode
+     */
+    SteadyStateWarmStartMode getSteadyStateWarmStartMode() const;
+
+    /**
+     * @brief Set the warm start mode for preequilibration.
+     *
+     * If enabled, the last steady state found during preequilibration for
+     * the same condition (fixed parameters, custom initial states and
+     * sensitivities, initial time and parameter list, but possibly different
+     * parameters) is used as starting point for Newton's
+     * method (`previous`), optionally updated to first order using the
+     * steady state sensitivities and the change in parameters (`firstOrder`).
+     * If Newton's method fails from this starting point, preequilibration
+     * proceeds as without warm start. The stored steady states are shared by
+     * all copies of this solver.
+     * @param mode warm start mode
+     */
+    void setSteadyStateWarmStartMode(SteadyStateWarmStartMode mode);
+
+    /**
+     * @brief Discard all steady states stored for warm starts
+     */
+    void resetSteadyStateWarmStart();
+
+    /**
+     * @brief Get the steady states stored for warm starts
+     * @return steady state store, shared by all copies of this solver
+     */
+    SteadyStateWarmStart &getSteadyStateWarmStart() const;
+
     /**
      * @brief Get sensitivity order
      * @return sensitivity order
@@ -499,6 +605,26 @@ class Solver {
      */
     bool timeExceeded() const;
 
+    /**
+     * @brief Count an evaluation of the forward right hand side. Used to
+     * track the recomputation overhead of adjoint checkpointing.
+     */
+    void countRhsEval() const;
+
+    /**
+     * @brief Number of checkpoints stored during the forward problem
+     * @return number of checkpoints
+     */
+    int getNumCheckpoints() const;
+
+    /**
+     * @brief Number of forward right hand side evaluations that were
+     * required during the backward problem to recompute the forward solution
+     * from checkpoints
+     * @return number of right hand side evaluations
+     */
+    long int getNumRecomputedRhsEvals() const;
+
     /**
      * @brief returns the maximum number of solver steps for the backward
      * problem
@@ -516,6 +642,55 @@ class Solver {
      */
     void setMaxStepsBackwardProblem(long int maxsteps);
 
+    /**
+     * @brief returns the memory budget for adjoint checkpoints
+     * @return memory budget in bytes, 0 if unlimited
+     */
+    long int getCheckpointMemoryBudget() const;
+
+    /**
+     * @brief sets the memory budget for the checkpoints and interpolation data
+     * stored during the forward problem for adjoint sensitivity analysis
+     *
+     * The forward solution is stored at a checkpoint every `nd` integration
+     * steps, and interpolation data is kept for the steps of one checkpoint
+     * interval. During the backward problem, the forward solution is
+     * recomputed from the checkpoints, one interval at a time. With a budget,
+     * `nd` is chosen as large as possible such that checkpoints and
+     * interpolation data for getMaxSteps() integration steps fit into the
+     * budget, which minimizes recomputation. The recomputation takes the same
+     * steps as the forward problem, including those ending at output
+     * timepoints, so results do not depend on the budget.
+     *
+     * @param budget memory budget in bytes (non-negative number)
+     *
+     * @note default behaviour (a single checkpoint interval spanning up to
+     * getMaxSteps() steps, no recomputation) can be restored by passing
+     * budget=0. The budget is ignored for models with events.
+     */
+    void setCheckpointMemoryBudget(long int budget);
+
+    /**
+     * @brief returns whether adjoint checkpoints are written to a scratch
+     * file
+     * @return spill flag
+     */
+    bool getCheckpointSpill() const;
+
+    /**
+     * @brief sets whether all but the most recent checkpoint of the forward
+     * problem are written to a temporary scratch file instead of being kept
+     * in memory
+     *
+     * Checkpoints are read back when the forward problem is recomputed from
+     * them during the backward problem. The checkpoint memory budget then
+     * only needs to hold two checkpoints and the interpolation data of one
+     * checkpoint interval, which allows for longer checkpoint intervals.
+     *
+     * @param spill spill flag
+     */
+    void setCheckpointSpill(bool spill);
+
     /**
      * @brief returns the linear system multistep method
      * @return linear system multistep method
@@ -584,6 +759,30 @@ class Solver {
      */
     void setStabilityLimitFlag(bool stldet);
 
+    /**
+     * @brief returns whether outputs are computed by interpolation
+     * @return interpolated output flag
+     */
+    bool getInterpolatedOutput() const;
+
+    /**
+     * @brief set whether outputs are computed by interpolation
+     *
+     * By default, the integrator is stopped at every output timepoint. With
+     * interpolated output, it is only stopped at the last output timepoint
+     * and at time-triggered events, and the solution at the output
+     * timepoints is computed from the interpolating polynomial of the
+     * integration step containing them (CVodeGetDky, CVodeGetSensDky). The
+     * interpolant has the order of the step (see ReturnData::order) and its
+     * error is of the same order as the local error controlled by the
+     * tolerances. No separate estimate of the interpolation error is
+     * computed. This saves integration steps for many closely spaced
+     * output timepoints, see ReturnData::numinterpolatedoutputs.
+     *
+     * @param interpolated_output interpolated output flag
+     */
+    void setInterpolatedOutput(bool interpolated_output);
+
     /**
      * @brief getLinearSolver
      * @return
@@ -596,6 +795,36 @@ class Solver {
      */
     void setLinearSolver(LinearSolver linsol);
 
+    /**
+     * @brief Get the preconditioner used with the iterative linear solvers
+     * (LinearSolver::SPGMR, LinearSolver::SPBCG, LinearSolver::SPTFQMR)
+     * @return preconditioner type
+     */
+    PreconditionerType getPreconditionerType() const;
+
+    /**
+     * @brief Set the preconditioner used with the iterative linear solvers
+     * (LinearSolver::SPGMR, LinearSolver::SPBCG, LinearSolver::SPTFQMR).
+     *
+     * Preconditioners are computed from the sparse Jacobian of the forward
+     * or backward problem, respectively, and are also used by the Newton
+     * solver for steady states. Currently only supported for ODE models.
+     * @param type preconditioner type
+     */
+    void setPreconditionerType(PreconditionerType type);
+
+    /**
+     * @brief Get the preconditioner of the forward problem
+     * @return preconditioner, nullptr if none is in use
+     */
+    Preconditioner *getPreconditioner() const;
+
+    /**
+     * @brief Get the preconditioner of the backward problem
+     * @return preconditioner, nullptr if none is in use
+     */
+    Preconditioner *getPreconditionerB() const;
+
     /**
      * @brief returns the internal sensitivity method
      * @return internal sensitivity method
@@ -757,6 +986,12 @@ class Solver {
      */
     realtype getCpuTimeB() const;
 
+    /**
+     * @brief Resets the CPU time counters for forward and backward solve,
+     * e.g. before reusing this instance for another simulation
+     */
+    void resetCpuTime() const;
+
     /**
      * @brief number of states with which the solver was initialized
      * @return x.getLength()
@@ -775,6 +1010,22 @@ class Solver {
      */
     int nquad() const;
 
+    /**
+     * @brief number of state sensitivities that are integrated, i.e. that
+     * are not structurally zero
+     * @return length of getIntegratedSensitivityIndices()
+     */
+    int nsens() const;
+
+    /**
+     * @brief Get the indices (into the parameter list) of the state
+     * sensitivities that are integrated (see
+     * Model::getNonzeroStateSensitivityIndices). The remaining state
+     * sensitivities keep their initial value of zero.
+     * @return indices
+     */
+    std::vector<int> const &getIntegratedSensitivityIndices() const;
+
     /**
      * @brief check if FSA is being computed
      * @return flag
@@ -1029,10 +1280,9 @@ class Solver {
     virtual void rootInit(int ne) const = 0;
 
     /**
-     * @brief Initalize non-linear solver for sensitivities
-     * @param model Model instance
+     * @brief Initalize non-linear solver for the integrated sensitivities
      */
-    void initializeNonLinearSolverSens(const Model *model) const;
+    void initializeNonLinearSolverSens() const;
 
     /**
      * @brief Set the dense Jacobian function
@@ -1082,6 +1332,23 @@ class Solver {
      */
     virtual void setJacTimesVecFnB(int which) const = 0;
 
+    /**
+     * @brief creates the preconditioner and sets the preconditioner
+     * functions for the iterative linear solvers
+     *
+     * @param model pointer to the model object
+     */
+    virtual void setPreconditionerFn(const Model *model) const = 0;
+
+    /**
+     * @brief creates the preconditioner and sets the preconditioner
+     * functions for the iterative linear solvers of the backward problem
+     *
+     * @param model pointer to the model object
+     * @param which identifier of the backwards problem
+     */
+    virtual void setPreconditionerFnB(const Model *model, int which) const = 0;
+
     /**
      * @brief sets the sparse Jacobian function for backward steady state case
      */
@@ -1270,6 +1537,14 @@ class Solver {
      */
     virtual void adjInit() const = 0;
 
+    /**
+     * @brief Computes the number of integration steps between two checkpoints
+     * of the forward problem, according to the checkpoint memory budget
+     * @param model pointer to the model instance
+     * @return number of integration steps
+     */
+    int computeStepsPerCheckpoint(const Model *model) const;
+
     /**
      * @brief initializes the quadratures
      * @param xQ0 vector with initial values for xQ
@@ -1488,6 +1763,16 @@ class Solver {
      */
     void resetMutableMemory(int nx, int nplist, int nquad) const;
 
+    /**
+     * @brief Get the N_Vectors of the integrated state sensitivities
+     * @param sx state sensitivities (dimension: nplist)
+     * @param nvecs storage for the N_Vectors, if only a subset of sx is
+     * integrated
+     * @return N_Vector array (dimension: nsens)
+     */
+    N_Vector *getIntegratedSensitivities(AmiVectorArray &sx,
+                                         std::vector<N_Vector> &nvecs) const;
+
     /**
      * @brief Retrieves the solver memory instance for the backward problem
      *
@@ -1569,6 +1854,13 @@ class Solver {
     /** maximum number of allowed integration steps */
     long int maxsteps_ {10000};
 
+    /** memory budget for adjoint checkpoints in bytes, 0 for unlimited */
+    long int checkpoint_memory_budget_ {0};
+
+    /** flag indicating whether adjoint checkpoints are written to a scratch
+     * file */
+    bool checkpoint_spill_ {false};
+
     /** Maximum wall-time for integration in seconds */
     std::chrono::duration<double, std::ratio<1>> maxtime_ {std::chrono::duration<double>::max()};
 
@@ -1581,6 +1873,14 @@ class Solver {
     /** linear solver for the backward problem */
     mutable std::unique_ptr<SUNLinSolWrapper> linear_solver_B_;
 
+    /** preconditioner for the iterative linear solver of the forward
+     * problem */
+    mutable std::unique_ptr<Preconditioner> preconditioner_;
+
+    /** preconditioner for the iterative linear solver of the backward
+     * problem */
+    mutable std::unique_ptr<Preconditioner> preconditioner_B_;
+
     /** non-linear solver for the forward problem */
     mutable std::unique_ptr<SUNNonLinSolWrapper> non_linear_solver_;
 
@@ -1657,6 +1957,18 @@ class Solver {
      */
     mutable AmiVectorArray sdx_ {0, 0};
 
+    /** indices (into the parameter list) of the integrated state
+     * sensitivities (dimension: nsens) */
+    mutable std::vector<int> sens_idxs_;
+
+    /** N_Vectors of the integrated state sensitivities, if they are a
+     * proper subset of sx_ (dimension: nsens) */
+    mutable std::vector<N_Vector> sx_nvecs_;
+
+    /** N_Vectors of the integrated state derivative sensitivities, if they
+     * are a proper subset of sdx_ (dimension: nsens) */
+    mutable std::vector<N_Vector> sdx_nvecs_;
+
     /** adjoint state interface variable (dimension: nx_solver) */
     mutable AmiVector xB_ {0};
 
@@ -1678,8 +1990,21 @@ class Solver {
     /** flag to force reInitPostProcessB before next call to solveB */
     mutable bool force_reinit_postprocess_B_ {false};
 
+    /** number of integration steps between two checkpoints in the forward
+     * problem */
+    mutable int steps_per_checkpoint_ {0};
+
   private:
 
+    /**
+     * @brief runs a forward simulation until the specified timepoint
+     *
+     * @param tout next timepoint
+     * @param itask task indicator, AMICI_NORMAL or AMICI_ONE_STEP
+     * @return status flag
+     */
+    int run(realtype tout, int itask) const;
+
     /**
      * @brief applies total number of steps for next solver call
      */
@@ -1700,6 +2025,9 @@ class Solver {
     /** flag controlling stability limit detection */
     booleantype stldet_ {true};
 
+    /** flag indicating whether outputs are computed by interpolation */
+    bool interpolated_output_ {false};
+
     /** state ordering */
     int ordering_ {static_cast<int>(SUNLinSolKLU::StateOrdering::AMD)};
 
@@ -1717,12 +2045,31 @@ class Solver {
     /** Lower bound of the damping factor. */
     realtype newton_damping_factor_lower_bound_ {1e-8};
 
+    /** Reuse of the Jacobian factorization in the Newton method */
+    bool newton_jacobian_reuse_ {false};
+
+    /** Use of pseudo-transient continuation for steady state computation */
+    bool steady_state_ptc_ {false};
+
+    /** Concurrent Newton's method and simulation for preequilibration */
+    bool steady_state_concurrent_search_ {false};
+
+    /** Warm start mode for preequilibration */
+    SteadyStateWarmStartMode steady_state_warm_start_mode_
+        {SteadyStateWarmStartMode::off};
+
+    /** steady states stored for warm starts, shared between copies */
+    std::shared_ptr<SteadyStateWarmStart> steady_state_warm_start_;
+
     /** Enable model preequilibration */
     bool requires_preequilibration_ {false};
 
     /** linear solver specification */
     LinearSolver linsol_ {LinearSolver::KLU};
 
+    /** preconditioner for the iterative linear solvers */
+    PreconditionerType preconditioner_type_ {PreconditionerType::none};
+
     /** absolute tolerances for integration */
     realtype atol_ {1e-16};
 
@@ -1796,6 +2143,13 @@ class Solver {
     /** number of checkpoints in the forward problem */
     mutable int ncheckPtr_ {0};
 
+    /** number of right hand side evaluations of the forward problem */
+    mutable long int num_rhs_evals_ {0};
+
+    /** number of right hand side evaluations of the forward problem during
+     * the backward problem */
+    mutable long int num_rhs_evals_recomputed_ {0};
+
     /** number of integration steps forward problem (dimension: nt) */
     mutable std::vector<int> ns_;
 
@@ -223,6 +223,10 @@ class IDASolver : public Solver {
 
     void setJacTimesVecFnB(int which) const override;
 
+    void setPreconditionerFn(const Model *model) const override;
+
+    void setPreconditionerFnB(const Model *model, int which) const override;
+
     void setSparseJacFn_ss() const override;
 };
 
@@ -2,6 +2,8 @@
 #define amici_spline_h
 #include <math.h>
 
+#include <vector>
+
 namespace amici {
 
 #ifndef EXHALE_DOXYGEN_SHOULD_SKIP_THIS
@@ -9,12 +11,67 @@ int spline(int n, int end1, int end2, double slope1, double slope2, double x[],
            double y[], double b[], double c[], double d[]);
 #endif
 
-double seval(int n, double u, double x[], double y[], double b[], double c[],
-             double d[]);
+double seval(int n, double u, const double x[], const double y[],
+             const double b[], const double c[], const double d[]);
 
 double sinteg(int n, double u, double x[], double y[], double b[], double c[],
               double d[]);
 
+/**
+ * @brief Cubic spline with precomputed coefficients.
+ *
+ * The coefficients are computed by spline() once on construction, evaluation
+ * only requires a binary search for the interval containing the evaluation
+ * point (see seval()). The last knot uses the default boundary condition.
+ */
+class CubicSpline {
+  public:
+    /**
+     * @brief Default constructor, creates an empty spline
+     */
+    CubicSpline() = default;
+
+    /**
+     * @brief Constructor
+     * @param nodes abscissas of the knots in strictly increasing order
+     * @param values ordinates of the knots
+     * @param fixed_slope if true, the slope at the first knot is specified,
+     * otherwise the default boundary condition is used
+     * @param slope slope at the first knot
+     */
+    CubicSpline(std::vector<double> nodes, std::vector<double> values,
+                bool fixed_slope, double slope);
+
+    /**
+     * @brief Evaluate the spline
+     * @param t evaluation point
+     * @return spline value at t
+     */
+    double evaluate(double t) const;
+
+    /**
+     * @brief Get the ordinates of the knots
+     * @return values
+     */
+    std::vector<double> const &getValues() const { return values_; }
+
+  private:
+    /** abscissas of the knots */
+    std::vector<double> nodes_;
+
+    /** ordinates of the knots */
+    std::vector<double> values_;
+
+    /** linear spline coefficients */
+    std::vector<double> b_;
+
+    /** quadratic spline coefficients */
+    std::vector<double> c_;
+
+    /** cubic spline coefficients */
+    std::vector<double> d_;
+};
+
 } // namespace amici
 
 #endif /* amici_spline_h */
@@ -9,8 +9,12 @@
 
 #include <nvector/nvector_serial.h>
 
+#include <atomic>
 #include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 
 namespace amici {
 
@@ -18,6 +22,41 @@ class ExpData;
 class Solver;
 class Model;
 
+/**
+ * @brief Owning pointer to the NewtonSolver of a SteadystateProblem.
+ *
+ * The Newton solver refers to the time and state of the problem that created
+ * it, so a copy starts without a solver and sets up its own one when needed.
+ */
+class NewtonSolverPtr : public std::unique_ptr<NewtonSolver> {
+  public:
+    NewtonSolverPtr() = default;
+
+    /**
+     * @brief Copy constructor, creates an empty pointer
+     */
+    NewtonSolverPtr(const NewtonSolverPtr & /*other*/) {}
+
+    /**
+     * @brief Copy assignment, releases the current solver
+     * @return this
+     */
+    NewtonSolverPtr &operator=(const NewtonSolverPtr & /*other*/) {
+        reset();
+        return *this;
+    }
+
+    /**
+     * @brief Takes ownership of a solver
+     * @param solver Newton solver
+     * @return this
+     */
+    NewtonSolverPtr &operator=(std::unique_ptr<NewtonSolver> &&solver) {
+        std::unique_ptr<NewtonSolver>::operator=(std::move(solver));
+        return *this;
+    }
+};
+
 /**
  * @brief The SteadystateProblem class solves a steady-state problem using
  * Newton's method and falls back to integration on failure.
@@ -32,6 +71,18 @@ class SteadystateProblem {
     explicit SteadystateProblem(const Solver &solver,
                                 const Model &model);
 
+    /**
+     * @brief Copy constructor. The Newton solver is not copied, a backward
+     * problem on the copy sets up its own one. Since the factorization of
+     * the Jacobian at the steady state is only computed for the sensitivities
+     * or the backward problem, this does not cause any additional
+     * factorizations.
+     * @param other object to copy from
+     */
+    SteadystateProblem(const SteadystateProblem &other) = default;
+
+    SteadystateProblem &operator=(const SteadystateProblem &other) = delete;
+
     /**
      * @brief Handles steady state computation in the forward case:
      * tries to determine the steady state of the ODE system and computes
@@ -54,6 +105,13 @@ class SteadystateProblem {
     void workSteadyStateBackwardProblem(Solver *solver, Model *model,
                                         const BackwardProblem *bwd);
 
+    /**
+     * @brief Resets the diagnostics on the work done in the forward problem
+     * (number of steps, Jacobian evaluations and factorizations, and run
+     * time), e.g. for results that were taken from a PreequilibrationCache
+     */
+    void resetDiagnostics();
+
     /**
      * @brief Handles the computation of the steady state, throws an
      * AmiException, if no steady state was found
@@ -76,6 +134,44 @@ class SteadystateProblem {
                                         Model *model,
                                         bool newton_retry);
 
+    /**
+     * @brief Tries to determine the steady state by using Newton's method,
+     * starting from the steady state stored in the solver's
+     * SteadyStateWarmStart. On failure, the initial state is restored.
+     * @param solver pointer to the solver object
+     * @param newtonSolver pointer to the newtonSolver solver object
+     * @param model pointer to the model object
+     */
+    void findSteadyStateFromWarmStart(const Solver *solver,
+                                      NewtonSolver *newtonSolver,
+                                      Model *model);
+
+    /**
+     * @brief Tries to determine the steady state by pseudo-transient
+     * continuation, followed by Newton's method. On failure, the initial
+     * state is restored.
+     * @param solver pointer to the solver object
+     * @param newtonSolver pointer to the newtonSolver solver object
+     * @param model pointer to the model object
+     */
+    void findSteadyStateByPseudoTransientContinuation(
+        const Solver *solver, NewtonSolver *newtonSolver, Model *model);
+
+    /**
+     * @brief Runs Newton's method (followed by pseudo-transient continuation,
+     * if enabled) and forward simulation concurrently, and keeps the result
+     * of the method that converges first. Simulation runs on a separate
+     * thread on copies of this problem and the model, and is stopped once
+     * Newton's method converged and vice versa.
+     * @param solver pointer to the solver object
+     * @param newtonSolver pointer to the newtonSolver solver object
+     * @param model pointer to the model object
+     * @param it integer with the index of the current time step
+     */
+    void findSteadyStateConcurrently(const Solver *solver,
+                                     NewtonSolver *newtonSolver,
+                                     Model *model, int it);
+
     /**
      * @brief Tries to determine the steady state by using forward simulation
      * @param solver pointer to the solver object
@@ -177,6 +273,16 @@ class SteadystateProblem {
     void applyNewtonsMethod(Model *model, NewtonSolver *newtonSolver,
                             bool newton_retry);
 
+    /**
+     * @brief Runs implicit Euler steps with adaptive pseudo-time step size
+     * until the residual is within the tolerances of the Newton solver
+     * @param solver pointer to the solver object
+     * @param model pointer to the model object
+     * @param newtonSolver pointer to the NewtonSolver object
+     */
+    void applyPseudoTransientContinuation(const Solver *solver, Model *model,
+                                          NewtonSolver *newtonSolver);
+
     /**
      * @brief Simulation is launched, if Newton solver or linear system solve fails
      * @param solver pointer to the solver object
@@ -313,6 +419,36 @@ class SteadystateProblem {
      */
     const std::vector<int> &getNumLinSteps() const { return numlinsteps_; }
 
+    /**
+     * @brief Accessor for the number of Jacobian evaluations of the Newton
+     * solver
+     * @return number of Jacobian evaluations
+     */
+    int getNumJacobianEvaluations() const { return num_jac_evals_; }
+
+    /**
+     * @brief Accessor for the number of Jacobian factorizations of the
+     * Newton solver
+     * @return number of Jacobian factorizations
+     */
+    int getNumFactorizations() const { return num_factorizations_; }
+
+    /**
+     * @brief Accessor for the number of accepted pseudo-transient
+     * continuation steps
+     * @return number of pseudo-transient continuation steps
+     */
+    int getNumPseudoTransientSteps() const { return num_ptc_steps_; }
+
+    /**
+     * @brief Accessor for the number of linear solves of pseudo-transient
+     * continuation
+     * @return number of linear solves
+     */
+    int getNumPseudoTransientLinearSolves() const {
+        return num_ptc_linsolves_;
+    }
+
     /**
      * @brief computes adjoint updates dJydx according to provided model and expdata
      * @param model Model instance
@@ -345,6 +481,13 @@ class SteadystateProblem {
     bool checkSteadyStateSuccess() const;
 
   private:
+    /**
+     * @brief Checks whether a concurrently running steady state search
+     * has already converged, such that this one can be stopped
+     * @return true if this search should be stopped
+     */
+    bool isCancelled() const;
+
     /** time variable for simulation steadystate finding */
     realtype t_;
     /** newton step */
@@ -397,6 +540,22 @@ class SteadystateProblem {
     /** stores information about employed number of backward steps */
     int numstepsB_ {0};
 
+    /** stores diagnostic information about employed number of Jacobian
+     * evaluations of the Newton solver */
+    int num_jac_evals_ {0};
+
+    /** stores diagnostic information about employed number of Jacobian
+     * factorizations of the Newton solver */
+    int num_factorizations_ {0};
+
+    /** stores diagnostic information about employed number of accepted
+     * pseudo-transient continuation steps */
+    int num_ptc_steps_ {0};
+
+    /** stores diagnostic information about employed number of linear solves
+     * of pseudo-transient continuation */
+    int num_ptc_linsolves_ {0};
+
     /** stores diagnostic information about runtime */
     double cpu_time_ {0.0};
 
@@ -406,10 +565,184 @@ class SteadystateProblem {
     /** flag indicating whether backward mode was run */
     bool hasQuadrature_ {false};
 
+    /** flag indicating whether Newton's method converged from a warm start */
+    bool warm_started_ {false};
+
+    /** flag shared with a concurrently running steady state search, set
+     * once either search converged, nullptr if there is none */
+    std::atomic<bool> const *search_finished_ {nullptr};
+
     /** stores diagnostic information about execution success of the different
-     * approaches [newton, simulation, newton] (length = 3)
+     * approaches [newton, simulation, newton] (length = 3). The second run of
+     * Newton's method starts from the result of pseudo-transient continuation,
+     * if enabled, or of simulation.
      */
     std::vector<SteadyStateStatus> steady_state_status_;
+
+    /** Newton solver of the forward problem, kept to reuse its factorization
+     * of the Jacobian at the steady state in the backward problem */
+    NewtonSolverPtr newton_solver_;
+};
+
+/**
+ * @brief The SteadyStateWarmStart class stores the last steady state found
+ * in preequilibration for each condition, to be used as starting point for
+ * Newton's method in subsequent preequilibrations
+ * (see Solver::setSteadyStateWarmStartMode).
+ *
+ * Conditions are identified by fixed parameters, custom initial states and
+ * sensitivities, initial time and parameter list of the model, but not by
+ * the parameters, which usually change between subsequent
+ * preequilibrations. It can be accessed from multiple threads concurrently.
+ */
+class SteadyStateWarmStart {
+  public:
+    /**
+     * @brief Writes the starting point for the current settings of model to x
+     * @param model Model instance, with preequilibration condition applied
+     * @param mode warm start mode
+     * @param x state vector, left untouched if no steady state is available
+     * @return true if a starting point was written to x
+     */
+    bool getStartingPoint(Model &model, SteadyStateWarmStartMode mode,
+                          AmiVector &x) const;
+
+    /**
+     * @brief Stores a steady state for the current settings of model
+     * @param model Model instance, with preequilibration condition applied
+     * @param x steady state
+     * @param sx steady state sensitivities, nullptr if not available
+     */
+    void store(Model &model, AmiVector const &x, AmiVectorArray const *sx);
+
+    /**
+     * @brief Discards all stored steady states
+     */
+    void clear();
+
+  private:
+    /**
+     * @brief Identifies a preequilibration condition
+     */
+    struct Key {
+        /** fixed parameters */
+        std::vector<realtype> fixed_parameters;
+        /** custom initial states */
+        std::vector<realtype> x0;
+        /** custom initial state sensitivities */
+        std::vector<realtype> sx0;
+        /** initial time */
+        realtype t0;
+        /** parameter list */
+        std::vector<int> plist;
+
+        /**
+         * @brief Strict weak ordering for use in std::map
+         * @param other other key
+         * @return true if this key is ordered before other
+         */
+        bool operator<(Key const &other) const;
+    };
+
+    /**
+     * @brief Returns the key for the current settings of model
+     * @param model Model instance, with preequilibration condition applied
+     * @return key
+     */
+    static Key getKey(Model &model);
+
+    /**
+     * @brief Steady state stored for a condition
+     */
+    struct Entry {
+        /** unscaled parameters for which x was obtained */
+        std::vector<realtype> parameters;
+        /** parameter list for which sx was obtained */
+        std::vector<int> plist;
+        /** steady state */
+        std::vector<realtype> x;
+        /** steady state sensitivities (nplist x nx_solver), may be empty */
+        std::vector<realtype> sx;
+    };
+
+    /** steady states by condition */
+    std::map<Key, Entry> entries_;
+
+    /** guards entries_ */
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief The PreequilibrationCache class shares preequilibration results
+ * between the conditions of a batch simulation.
+ *
+ * Entries are identified by everything that determines the outcome of the
+ * preequilibration: fixed parameters, parameters, parameter scaling, parameter
+ * list, custom initial states and sensitivities and initial time of the model,
+ * as well as the sensitivity settings of the solver. All other solver and
+ * model settings are assumed to be the same for all conditions sharing a
+ * cache. Only successful preequilibrations are stored. On a cache hit, the
+ * diagnostics on the forward work are reset, as no work was done for that
+ * condition. Adjoint preequilibration runs separately for every condition.
+ * The cache can be accessed from multiple threads concurrently.
+ */
+class PreequilibrationCache {
+  public:
+    /**
+     * @brief Returns the preequilibration for the current settings of model
+     * and solver. If it is not cached yet, it is computed by calling compute,
+     * while other threads requesting the same preequilibration wait for the
+     * result. On a cache hit, the model state is set to the one after
+     * preequilibration.
+     * @param solver Solver instance
+     * @param model Model instance, with preequilibration condition applied
+     * @param compute function performing the preequilibration
+     * @return preequilibration, owned by the caller
+     */
+    std::unique_ptr<SteadystateProblem> getPreequilibration(
+        Solver const &solver, Model &model,
+        std::function<std::unique_ptr<SteadystateProblem>()> const &compute);
+
+  private:
+    /**
+     * @brief Identifies a preequilibration condition
+     */
+    struct Key {
+        /** fixed parameters */
+        std::vector<realtype> fixed_parameters;
+        /** unscaled parameters */
+        std::vector<realtype> parameters;
+        /** parameter scaling */
+        std::vector<ParameterScaling> pscale;
+        /** parameter list */
+        std::vector<int> plist;
+        /** custom initial states */
+        std::vector<realtype> x0;
+        /** custom initial state sensitivities */
+        std::vector<realtype> sx0;
+        /** initial time */
+        realtype t0;
+        /** sensitivity order */
+        SensitivityOrder sensi;
+        /** sensitivity method */
+        SensitivityMethod sensi_meth;
+        /** sensitivity method for preequilibration */
+        SensitivityMethod sensi_meth_preeq;
+
+        /**
+         * @brief Strict weak ordering for use in std::map
+         * @param other other key
+         * @return true if this key is ordered before other
+         */
+        bool operator<(Key const &other) const;
+    };
+
+    /** results, nullptr if the preequilibration failed */
+    std::map<Key, std::shared_future<std::shared_ptr<const SteadystateProblem>>>
+        entries_;
+
+    /** guards entries_ */
+    mutable std::mutex mutex_;
 };
 
 } // namespace amici
@@ -9,6 +9,10 @@
 
 #include <vector>
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 
 #include <assert.h>
 
@@ -16,6 +20,80 @@
 
 namespace amici {
 
+/**
+ * @brief Symbolic phase of a sparse matrix operation.
+ *
+ * For fixed sparsity patterns of the operands, stores the sparsity pattern of
+ * the result of SUNMatrixWrapper::sparse_multiply, SUNMatrixWrapper::sparse_add
+ * or SUNMatrixWrapper::sparse_sum, together with the contributions of the
+ * operand entries to the result entries. Given the pattern, the numeric phase
+ * reduces to a sequence of multiply-adds on the data arrays.
+ */
+struct SparseOperationPattern {
+    /** number of nonzero entries of the operands */
+    std::vector<sunindextype> operand_nnz;
+
+    /** column pointers of the result */
+    std::vector<sunindextype> indexptrs;
+
+    /** row indices of the result */
+    std::vector<sunindextype> indexvals;
+
+    /** index of the result entry for each contribution */
+    std::vector<sunindextype> result_idxs;
+
+    /** products: index into the data of the left operand, sums: index of the
+     * operand, for each contribution */
+    std::vector<sunindextype> first_idxs;
+
+    /** products: index into the data of the right operand, sums: index into
+     * the data of the operand, for each contribution */
+    std::vector<sunindextype> second_idxs;
+};
+
+/**
+ * @brief Thread-safe store of SparseOperationPattern instances.
+ *
+ * A model and all its clones hold the same store, so every pattern is
+ * computed only once, even if the clones are used from different threads.
+ */
+class SparseOperationPatternCache {
+  public:
+    /**
+     * @brief Get the pattern stored under the given key, computing it if
+     * it is not stored yet.
+     * @param key identifier of the operation
+     * @param compute callable returning the SparseOperationPattern
+     * @return pattern
+     */
+    template <typename F>
+    std::shared_ptr<const SparseOperationPattern> get(std::string const &key,
+                                                      F compute) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &pattern = patterns_[key];
+        if (!pattern)
+            pattern = std::make_shared<const SparseOperationPattern>(compute());
+        return pattern;
+    }
+
+    /**
+     * @brief Number of stored patterns
+     * @return number of patterns
+     */
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return patterns_.size();
+    }
+
+  private:
+    /** guards patterns_ */
+    std::mutex mutex_;
+
+    /** stored patterns */
+    std::map<std::string, std::shared_ptr<const SparseOperationPattern>>
+        patterns_;
+};
+
 /**
  * @brief A RAII wrapper for SUNMatrix structs.
  *
@@ -346,6 +424,20 @@ class SUNMatrixWrapper {
     void multiply(gsl::span<realtype> c, gsl::span<const realtype> b,
                   const realtype alpha = 1.0) const;
 
+    /**
+     * @brief Perform matrix matrix multiplication C += alpha * A*B for dense,
+     * row-major B and C
+     *
+     * Each nonzero entry of A updates a contiguous row of C, so A is
+     * traversed only once for all columns of B.
+     * @param C output matrix (`rows()` x `ncols`), may already contain values
+     * @param B multiplication matrix (`columns()` x `ncols`)
+     * @param ncols number of columns of B and C
+     * @param alpha scalar coefficient
+     */
+    void multiply_block(gsl::span<realtype> C, gsl::span<const realtype> B,
+                        sunindextype ncols, realtype alpha = 1.0) const;
+
     /**
      * @brief Perform reordered matrix vector multiplication c += A[:,cols]*b
      * @param c output vector, may already contain values
@@ -379,6 +471,27 @@ class SUNMatrixWrapper {
     void sparse_multiply(SUNMatrixWrapper &C,
                          const SUNMatrixWrapper &B) const;
 
+    /**
+     * @brief Perform matrix matrix multiplication C = A * B for sparse A, B, C
+     * with precomputed sparsity pattern of C
+     * @param C output matrix
+     * @param B multiplication matrix
+     * @param pattern result of sparse_multiply_pattern(B)
+     * @note will overwrite existing data, indexptrs, indexvals for C,
+     * reallocates C only if its capacity is insufficient
+     */
+    void sparse_multiply(SUNMatrixWrapper &C, const SUNMatrixWrapper &B,
+                         const SparseOperationPattern &pattern) const;
+
+    /**
+     * @brief Symbolic phase of sparse_multiply, only depends on the sparsity
+     * patterns of A and B
+     * @param B multiplication matrix
+     * @return sparsity pattern of C = A * B
+     */
+    SparseOperationPattern
+    sparse_multiply_pattern(const SUNMatrixWrapper &B) const;
+
     /**
      * @brief Perform sparse matrix matrix addition C = alpha * A +  beta * B
      * @param A addition matrix
@@ -390,6 +503,21 @@ class SUNMatrixWrapper {
     void sparse_add(const SUNMatrixWrapper &A, realtype alpha,
                     const SUNMatrixWrapper &B, realtype beta);
 
+    /**
+     * @brief Perform sparse matrix matrix addition C = alpha * A +  beta * B
+     * with precomputed sparsity pattern of C
+     * @param A addition matrix
+     * @param alpha scalar A
+     * @param B addition matrix
+     * @param beta scalar B
+     * @param pattern result of sparse_sum_pattern({&A, &B})
+     * @note will overwrite existing data, indexptrs, indexvals for C,
+     * reallocates C only if its capacity is insufficient
+     */
+    void sparse_add(const SUNMatrixWrapper &A, realtype alpha,
+                    const SUNMatrixWrapper &B, realtype beta,
+                    const SparseOperationPattern &pattern);
+
     /**
      * @brief Perform matrix-matrix addition A = sum(mats(0)...mats(len(mats)))
      * @param mats vector of sparse matrices
@@ -397,6 +525,27 @@ class SUNMatrixWrapper {
      */
     void sparse_sum(const std::vector<SUNMatrixWrapper> &mats);
 
+    /**
+     * @brief Perform matrix-matrix addition A = sum(mats(0)...mats(len(mats)))
+     * with precomputed sparsity pattern of A
+     * @param mats vector of sparse matrices
+     * @param pattern result of sparse_sum_pattern for mats
+     * @note will overwrite existing data, indexptrs, indexvals for A,
+     * reallocates A only if its capacity is insufficient
+     */
+    void sparse_sum(const std::vector<SUNMatrixWrapper> &mats,
+                    const SparseOperationPattern &pattern);
+
+    /**
+     * @brief Symbolic phase of sparse_add and sparse_sum, only depends on the
+     * sparsity patterns of the summands
+     * @param mats sparse matrices to be summed up, nullptr or empty matrices
+     * are ignored
+     * @return sparsity pattern of the sum
+     */
+    static SparseOperationPattern
+    sparse_sum_pattern(const std::vector<const SUNMatrixWrapper *> &mats);
+
     /**
      * @brief Compute x = x + beta * A(:,k), where x is a dense vector and A(:,k) is sparse, and update
      * the sparsity pattern for C(:,j) if applicable
@@ -464,6 +613,13 @@ class SUNMatrixWrapper {
 
   private:
 
+    /**
+     * @brief Set sparsity pattern from the symbolic phase of a sparse matrix
+     * operation and set all entries to 0.0
+     * @param pattern sparsity pattern
+     */
+    void set_pattern(const SparseOperationPattern &pattern);
+
     /**
      * @brief SUNMatrix to which all methods are applied
      */
@@ -515,7 +671,8 @@ class SUNMatrixWrapper {
     sunindextype num_indexptrs_ {0};
 
     /**
-     * @brief call update_ptrs & update_size
+     * @brief call update_ptrs & update_size and update the cached number of
+     * nonzeros
      */
     void finish_init();
     /**
@@ -231,6 +231,20 @@ double DDspline(int id1, int id2, double t, int num, ...);
  */
 double DDspline_pos(int id1, int id2, double t, int num, ...);
 
+/**
+ * @brief Number of lookups of spline coefficients by the calling thread that
+ * were served from the spline cache
+ * @return number of cache hits
+ */
+long getSplineCacheHits();
+
+/**
+ * @brief Number of lookups of spline coefficients by the calling thread that
+ * required computing the coefficients
+ * @return number of cache misses
+ */
+long getSplineCacheMisses();
+
 } // namespace amici
 
 #endif /* amici_symbolic_functions_h */
@@ -20,7 +20,16 @@ inline const realtype* N_VGetArrayPointerConst(const_N_Vector x) {
     return N_VGetArrayPointer(const_cast<N_Vector>(x));
 }
 
-/** AmiVector class provides a generic interface to the NVector_Serial struct */
+class AmiVectorArray;
+
+/**
+ * @brief AmiVector class provides a generic interface to the NVector_Serial
+ * struct
+ *
+ * An AmiVector either owns its data, or is a view on one of the vectors of an
+ * AmiVectorArray (see AmiVectorArray::operator[]). Copies of views own their
+ * data, assigning to a view copies the data into the viewed storage.
+ */
 class AmiVector {
   public:
     /**
@@ -60,18 +69,26 @@ class AmiVector {
      * @brief copy constructor
      * @param vold vector from which the data will be copied
      */
-    AmiVector(const AmiVector &vold) : vec_(vold.vec_) {
+    AmiVector(const AmiVector &vold)
+        : vec_(vold.data(), vold.data() + vold.getLength()) {
         nvec_ =
-            N_VMake_Serial(static_cast<long int>(vold.vec_.size()), vec_.data());
+            N_VMake_Serial(static_cast<long int>(vec_.size()), vec_.data());
     }
 
     /**
      * @brief move constructor
+     *
+     * Moving a view creates another view on the same data.
      * @param other vector from which the data will be moved
      */
     AmiVector(AmiVector&& other) noexcept : nvec_(nullptr) {
-        vec_ = std::move(other.vec_);
-        synchroniseNVector();
+        if (other.is_view_) {
+            is_view_ = true;
+            nvec_ = N_VMake_Serial(other.getLength(), other.data());
+        } else {
+            vec_ = std::move(other.vec_);
+            synchroniseNVector();
+        }
     }
 
     /**
@@ -81,6 +98,8 @@ class AmiVector {
 
     /**
      * @brief copy assignment operator
+     *
+     * If this vector is a view, the dimensions must match.
      * @param other right hand side
      * @return left hand side
      */
@@ -115,14 +134,14 @@ class AmiVector {
      * vector.
      * @return iterator that points to the first element
      */
-    auto begin() { return vec_.begin(); }
+    realtype *begin() { return data(); }
 
     /**
      * @brief Returns an iterator that points to one element after the last
      * element of the vector.
      * @return iterator that points to one element after the last element
      */
-    auto end() { return vec_.end(); }
+    realtype *end() { return data() + getLength(); }
 
     /**
      * @brief data accessor
@@ -150,9 +169,9 @@ class AmiVector {
 
     /**
      * @brief Vector accessor
-     * @return Vector
+     * @return copy of the data
      */
-    std::vector<realtype> const &getVector() const;
+    std::vector<realtype> getVector() const;
 
     /**
      * @brief returns the length of the vector
@@ -210,22 +229,39 @@ class AmiVector {
     };
 
   private:
-    /** main data storage */
+    /**
+     * @brief Create a view on external data
+     * @param data data, must outlive this object
+     * @param length number of elements
+     */
+    AmiVector(realtype *data, long int length)
+        : nvec_(N_VMake_Serial(length, data)), is_view_(true) {}
+
+    /** main data storage, empty for views */
     std::vector<realtype> vec_;
 
-    /** N_Vector, will be synchronized such that it points to data in vec */
+    /** N_Vector, will be synchronized such that it points to data in vec,
+     * or to the viewed data */
     N_Vector nvec_ {nullptr};
 
+    /** whether this vector is a view on data owned by an AmiVectorArray */
+    bool is_view_ {false};
+
     /**
      * @brief reconstructs nvec such that data pointer points to vec data array
      */
     void synchroniseNVector();
+
+    friend AmiVectorArray;
 };
 
 /**
  * @brief AmiVectorArray class.
  *
- * Provides a generic interface to arrays of NVector_Serial structs
+ * Provides a generic interface to arrays of NVector_Serial structs. The data
+ * of all vectors is stored in a single contiguous buffer (column-major,
+ * length of vectors x number of vectors), the individual vectors are views
+ * on the respective columns.
  */
 class AmiVectorArray {
   public:
@@ -261,6 +297,20 @@ class AmiVectorArray {
      */
     AmiVectorArray &operator=(AmiVectorArray const &other);
 
+    /**
+     * @brief accessor to the data of all AmiVector elements
+     * @return contiguous data (column-major, length of vectors x number of
+     * vectors)
+     */
+    gsl::span<realtype> data();
+
+    /**
+     * @brief const accessor to the data of all AmiVector elements
+     * @return contiguous data (column-major, length of vectors x number of
+     * vectors)
+     */
+    gsl::span<const realtype> data() const;
+
     /**
      * @brief accessor to data of AmiVector elements
      * @param pos index of AmiVector
@@ -314,7 +364,7 @@ class AmiVectorArray {
     /**
      * @brief accessor to AmiVector elements
      * @param pos index of AmiVector
-     * @return AmiVector
+     * @return view on the data of the respective vector
      */
     AmiVector &operator[](int pos);
 
@@ -350,7 +400,20 @@ class AmiVectorArray {
     void copy(const AmiVectorArray &other);
 
   private:
-    /** main data storage */
+    /**
+     * @brief (re)creates the views on the columns of data_
+     * @param length_outer number of vectors
+     */
+    void createViews(long int length_outer);
+
+    /** length of the individual vectors */
+    long int length_inner_ {0};
+
+    /** main data storage (column-major, `length_inner_` x number of
+     * vectors) */
+    std::vector<realtype> data_;
+
+    /** views on the columns of data_ */
     std::vector<AmiVector> vec_array_;
 
     /**
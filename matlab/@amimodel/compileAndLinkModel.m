@@ -198,7 +198,7 @@ function [objectStrAmici] = compileAmiciBase(amiciRootPath, objectFolder, object
         'interface_matlab', 'misc', 'simulation_parameters', ...
         'solver', 'solver_cvodes', 'solver_idas', 'model_state', ...
         'model', 'model_ode', 'model_dae', 'returndata_matlab', ...
-        'forwardproblem', 'steadystateproblem', 'backwardproblem', 'newton_solver', ...
+        'forwardproblem', 'steadystateproblem', 'backwardproblem', 'newton_solver', 'preconditioner', ...
         'abstract_model', 'sundials_matrix_wrapper', 'sundials_linsol_wrapper', ...
         'vector'
     };
@@ -7,10 +7,24 @@ from sympy.printing.cxx import CXX11CodePrinter
 
 
 class AmiciCxxCodePrinter(CXX11CodePrinter):
-    """C++ code printer"""
+    """
+    C++ code printer
+
+    :ivar extract_cse:
+        Whether to extract common subexpressions of the equations assigned in
+        :meth:`_get_sym_lines_array` and :meth:`_get_sym_lines_symbols` into
+        temporary variables.
+
+    :ivar op_counts:
+        Number of operations required to evaluate the equations printed for
+        each variable, before and after common subexpression elimination.
+        Only collected if ``extract_cse`` is set.
+    """
 
-    def __init__(self):
+    def __init__(self, extract_cse: bool = False):
         super().__init__()
+        self.extract_cse: bool = extract_cse
+        self.op_counts: Dict[str, List[int]] = {}
 
     def doprint(self, expr: sp.Expr, assign_to: Optional[str] = None) -> str:
         try:
@@ -63,10 +77,13 @@ class AmiciCxxCodePrinter(CXX11CodePrinter):
         :return:
             C++ code as list of lines
         """
-        return [
+        cse_lines, reduced = self._get_cse_lines(
+            equations, variable, indent_level)
+        return cse_lines + [
             ' ' * indent_level + f'{variable}[{index}] = '
-                                 f'{self.doprint(math)};'
-            for index, math in enumerate(equations)
+                                 f'{self.doprint(reduced_math)};'
+            for index, (math, reduced_math) in enumerate(zip(equations,
+                                                             reduced))
             if math not in [0, 0.0]
         ]
 
@@ -95,13 +112,130 @@ class AmiciCxxCodePrinter(CXX11CodePrinter):
         :return:
             C++ code as list of lines
         """
+        replacements, reduced = self._get_cse(equations, variable)
+
+        # The equations may depend on symbols assigned before them (e.g. `w`
+        # is topologically sorted), so each temporary is declared right
+        # after the last assignment it depends on.
+        assigned = {str(sym): index for index, sym in enumerate(symbols)}
+        declared_after = {}
+        temporaries = {}
+        for sym, math in replacements:
+            position = max(
+                [assigned.get(str(dep), -1) for dep in math.free_symbols]
+                + [declared_after.get(dep, -1) for dep in math.free_symbols]
+                + [-1]
+            )
+            declared_after[sym] = position
+            temporaries.setdefault(position, []).append(
+                self._get_cse_line(sym, math, indent_level))
+
+        lines = temporaries.get(-1, [])
+        for index, (sym, math, reduced_math) in enumerate(
+                zip(symbols, equations, reduced)):
+            if math not in [0, 0.0]:
+                lines.append(
+                    f'{" " * indent_level}{sym} = '
+                    f'{self.doprint(reduced_math)};'
+                    f'  // {variable}[{index}]'.replace(
+                        '\n', '\n' + ' ' * indent_level)
+                )
+            lines.extend(temporaries.get(index, []))
+        return lines
+
+    def _get_cse_lines(
+            self,
+            equations: sp.Matrix,
+            variable: str,
+            indent_level: int
+    ) -> Tuple[List[str], List[sp.Expr]]:
+        """
+        Extract common subexpressions of ``equations`` into temporary
+        variables, if enabled via ``extract_cse``. The temporaries only
+        depend on the symbols in ``equations`` and can be declared before any
+        of the assignments.
+
+        :param equations:
+            vectors of symbolic expressions
+
+        :param variable:
+            name of the C++ array the equations are assigned to, used for
+            the operation count statistics in ``op_counts``
+
+        :param indent_level:
+            indentation level (number of leading blanks)
+
+        :return:
+            C++ code declaring the temporaries as list of lines, and the
+            equations expressed in terms of the temporaries
+        """
+        replacements, reduced = self._get_cse(equations, variable)
         return [
-            f'{" " * indent_level}{sym} = {self.doprint(math)};'
-            f'  // {variable}[{index}]'.replace('\n',
-                                                '\n' + ' ' * indent_level)
-            for index, (sym, math) in enumerate(zip(symbols, equations))
-            if math not in [0, 0.0]
-        ]
+            self._get_cse_line(sym, math, indent_level)
+            for sym, math in replacements
+        ], reduced
+
+    def _get_cse(
+            self,
+            equations: sp.Matrix,
+            variable: str
+    ) -> Tuple[List[Tuple[sp.Symbol, sp.Expr]], List[sp.Expr]]:
+        """
+        Extract common subexpressions of ``equations``, if enabled via
+        ``extract_cse``.
+
+        :param equations:
+            vectors of symbolic expressions
+
+        :param variable:
+            name of the C++ array the equations are assigned to, used for
+            the operation count statistics in ``op_counts``
+
+        :return:
+            temporaries and their definitions, in order of dependency, and
+            the equations expressed in terms of the temporaries
+        """
+        equations = list(equations)
+        if not self.extract_cse or not equations:
+            return [], equations
+
+        replacements, reduced = sp.cse(
+            equations,
+            symbols=sp.numbered_symbols(prefix='_amici_cse_', real=True),
+        )
+
+        ops_before = sum(sp.count_ops(math) for math in equations)
+        ops_after = sum(sp.count_ops(math) for _, math in replacements) \
+            + sum(sp.count_ops(math) for math in reduced)
+        counts = self.op_counts.setdefault(variable, [0, 0])
+        counts[0] += ops_before
+        counts[1] += ops_after
+
+        return replacements, reduced
+
+    def _get_cse_line(
+            self,
+            symbol: sp.Symbol,
+            math: sp.Expr,
+            indent_level: int
+    ) -> str:
+        """
+        Generate C++ code declaring a temporary for a common subexpression
+
+        :param symbol:
+            temporary
+
+        :param math:
+            common subexpression
+
+        :param indent_level:
+            indentation level (number of leading blanks)
+
+        :return:
+            C++ code
+        """
+        return f'{" " * indent_level}const realtype {symbol} = ' \
+               f'{self.doprint(math)};'
 
     def csc_matrix(
             self,
@@ -187,7 +321,8 @@ class AmiciCxxCodePrinter(CXX11CodePrinter):
 
 def get_switch_statement(condition: str, cases: Dict[int, List[str]],
                          indentation_level: Optional[int] = 0,
-                         indentation_step: Optional[str] = ' ' * 4):
+                         indentation_step: Optional[str] = ' ' * 4,
+                         scoped: Optional[bool] = False):
     """
     Generate code for switch statement
 
@@ -204,6 +339,10 @@ def get_switch_statement(condition: str, cases: Dict[int, List[str]],
     :param indentation_step:
         indentation whitespace per level
 
+    :param scoped:
+        whether to enclose the statements of each case in a block, as
+        required if they declare variables
+
     :return:
         Code for switch expression as list of strings
 
@@ -216,11 +355,13 @@ def get_switch_statement(condition: str, cases: Dict[int, List[str]],
     for expression, statements in cases.items():
         if statements:
             lines.append((indentation_level + 1) * indentation_step
-                         + f'case {expression}:')
+                         + f'case {expression}:' + (' {' if scoped else ''))
             for statement in statements:
                 lines.append((indentation_level + 2) * indentation_step
                              + statement)
             lines.append((indentation_level + 2) * indentation_step + 'break;')
+            if scoped:
+                lines.append((indentation_level + 1) * indentation_step + '}')
 
     if lines:
         lines.insert(0, indentation_level * indentation_step
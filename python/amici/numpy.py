@@ -16,9 +16,9 @@ class SwigPtrView(collections.abc.Mapping):
     """
     Interface class to expose std::vector<double> and scalar members of
     swig wrapped C++ objects as numpy array attributes and fields. This
-    class is memory efficient as copies of the underlying C++ objects is
-    only created when respective fields are accessed for the first time.
-    Cached copies are used for all subsequent calls.
+    class is memory efficient as array fields are exposed as views on the
+    buffers of the underlying C++ objects, without copying. The views keep
+    the C++ object alive and are cached for all subsequent calls.
 
     :ivar _swigptr: pointer to the c++ object
     :ivar _field_names: names of members that will be exposed as numpy arrays
@@ -32,9 +32,8 @@ class SwigPtrView(collections.abc.Mapping):
 
     def __getitem__(self, item: str) -> Union[np.ndarray, float]:
         """
-        Access to field names, copies data from C++ object into numpy
-        array, reshapes according to field dimensions and stores values in
-        cache.
+        Access to field names, creates a numpy view on the data of the C++
+        object with the respective field dimensions and stores it in cache.
 
         :param item: field name
         :return: value
@@ -54,9 +53,14 @@ class SwigPtrView(collections.abc.Mapping):
         if item not in self._field_names:
             self.__missing__(item)
 
-        value = field_as_numpy(
-            self._field_dimensions, item, self._swigptr
-        )
+        if item in self._field_dimensions:
+            value = self._swigptr._field_as_numpy(
+                item, self._field_dimensions[item], self._swigptr
+            )
+        else:
+            value = field_as_numpy(
+                self._field_dimensions, item, self._swigptr
+            )
         self._cache[item] = value
         return value
 
@@ -144,22 +148,28 @@ class SwigPtrView(collections.abc.Mapping):
 class ReturnDataView(SwigPtrView):
     """
     Interface class for C++ Return Data objects that avoids possibly costly
-    copies of member data.
+    copies of member data. Array fields are read-only views on the data of
+    the ReturnData instance, use ``numpy.array(rdata['x'])`` or similar to
+    obtain a modifiable copy.
     """
 
     _field_names = [
         'ts', 'x', 'x0', 'x_ss', 'sx', 'sx0', 'sx_ss', 'y', 'sigmay',
         'sy', 'ssigmay', 'z', 'rz', 'sigmaz', 'sz', 'srz',
-        'ssigmaz', 'sllh', 's2llh', 'J', 'xdot', 'status', 'llh',
-        'chi2', 'res', 'sres', 'FIM', 'w',
+        'ssigmaz', 'sllh', 's2llh', 'inner_parameters', 'J', 'xdot',
+        'status', 'llh', 'chi2', 'res', 'sres', 'FIM', 'w',
         'preeq_wrms', 'preeq_t', 'preeq_numlinsteps', 'preeq_numsteps',
-        'preeq_numstepsB', 'preeq_status', 'preeq_cpu_time',
-        'preeq_cpu_timeB', 'posteq_wrms', 'posteq_t', 'posteq_numlinsteps',
-        'posteq_numsteps', 'posteq_numstepsB', 'posteq_status',
+        'preeq_numstepsB', 'preeq_numjacevals', 'preeq_numfactorizations',
+        'preeq_ptc_numsteps', 'preeq_ptc_numlinsolves', 'preeq_status',
+        'preeq_cpu_time', 'preeq_cpu_timeB', 'posteq_wrms',
+        'posteq_t', 'posteq_numlinsteps', 'posteq_numsteps',
+        'posteq_numstepsB', 'posteq_numjacevals', 'posteq_numfactorizations',
+        'posteq_ptc_numsteps', 'posteq_ptc_numlinsolves', 'posteq_status',
         'posteq_cpu_time', 'posteq_cpu_timeB', 'numsteps', 'numrhsevals',
         'numerrtestfails', 'numnonlinsolvconvfails', 'order', 'cpu_time',
         'numstepsB', 'numrhsevalsB', 'numerrtestfailsB',
-        'numnonlinsolvconvfailsB', 'cpu_timeB'
+        'numnonlinsolvconvfailsB', 'cpu_timeB', 'numcheckpoints',
+        'numrecomputedrhsevals', 'numinterpolatedoutputs'
     ]
 
     def __init__(self, rdata: Union[ReturnDataPtr, ReturnData]):
@@ -197,6 +207,7 @@ class ReturnDataView(SwigPtrView):
             # objective function
             'sllh': [rdata.nplist],
             's2llh': [rdata.np, rdata.nplist],
+            'inner_parameters': [rdata.np],
 
             'res': [rdata.nt * rdata.nytrue *
                     (2 if rdata.sigma_res else 1)],
@@ -243,7 +254,9 @@ class ReturnDataView(SwigPtrView):
 class ExpDataView(SwigPtrView):
     """
     Interface class for C++ Exp Data objects that avoids possibly costly
-    copies of member data.
+    copies of member data. Array fields are copies of the data of the
+    ExpData instance, created on first access. Modifying them does not
+    change the ExpData instance.
     """
 
     _field_names = [
@@ -275,12 +288,8 @@ class ExpDataView(SwigPtrView):
             'fixedParametersPreequilibration': [
                 len(edata.fixedParametersPreequilibration)],
             'fixedParametersPresimulation': [
-                len(edata.fixedParametersPreequilibration)],
+                len(edata.fixedParametersPresimulation)],
         }
-        edata.observedData = edata.getObservedData()
-        edata.observedDataStdDev = edata.getObservedDataStdDev()
-        edata.observedEvents = edata.getObservedEvents()
-        edata.observedEventsStdDev = edata.getObservedEventsStdDev()
         super(ExpDataView, self).__init__(edata)
 
 
@@ -197,6 +197,10 @@ functions = {
         _FunctionInfo(generate_body=False),
     'drootdx':
         _FunctionInfo(generate_body=False),
+    'trigger_times':
+        _FunctionInfo(
+            'realtype *trigger_times, const realtype *p, const realtype *k'
+        ),
     'stau':
         _FunctionInfo(
             'realtype *stau, const realtype t, const realtype *x, '
@@ -1011,6 +1015,124 @@ class ODEModel:
         """
         return len(self.sym('h'))
 
+    def get_time_triggered_events(self) -> List[int]:
+        """
+        Indices of events that are triggered at times that can be computed
+        before the simulation (see :meth:`_get_trigger_time`). These events
+        are excluded from root finding during simulation.
+
+        :return:
+            list of event indices
+        """
+        return [
+            ie for ie, root in enumerate(self.eq('root'))
+            if self._get_trigger_time(root) is not None
+        ]
+
+    def _get_trigger_time(self, root: sp.Expr) -> Union[sp.Expr, None]:
+        """
+        Solve a root function for time, if it is linear in time and only
+        depends on parameters and constants otherwise.
+
+        :param root:
+            root function
+
+        :return:
+            trigger time, or ``None`` if the trigger time depends on the
+            model state
+        """
+        t = symbol_with_assumptions('t')
+        allowed = {t} | set(self.sym('p')) | set(self.sym('k'))
+        if not root.free_symbols <= allowed or t not in root.free_symbols:
+            return None
+
+        slope = root.diff(t)
+        if t in slope.free_symbols:
+            return None
+        offset = sp.expand(root - slope * t)
+        if t in offset.free_symbols:
+            return None
+        return -offset / slope
+
+    def get_state_sensitivity_structure(self) -> List[List[int]]:
+        """
+        Structurally nonzero state sensitivities. The sensitivity of a state
+        w.r.t. a parameter can only be nonzero if the parameter enters the
+        initial value or the right hand side of this state, or of a state it
+        depends on. Dependencies via expressions and conservation laws are
+        resolved.
+
+        :return:
+            for every parameter, the sorted indices of the solver states
+            with possibly nonzero sensitivities, or an empty list if the
+            model has events, as event assignments may introduce additional
+            dependencies
+        """
+        if self.num_events():
+            return []
+
+        x = list(self.sym('x'))
+        p = set(self.sym('p'))
+        tcl = list(self.sym('tcl'))
+        base = set(x) | p | set(tcl)
+        definitions = dict(zip(self.sym('w'), self.eq('w')))
+        definitions.update({
+            state.get_id(): state._conservation_law
+            for state in self._states
+            if state._conservation_law is not None
+        })
+        resolved = {}
+
+        def dependencies(expr: sp.Expr) -> Set[sp.Symbol]:
+            deps = set()
+            for symbol in expr.free_symbols:
+                if symbol in base:
+                    deps.add(symbol)
+                elif symbol in definitions:
+                    if symbol not in resolved:
+                        resolved[symbol] = dependencies(definitions[symbol])
+                    deps |= resolved[symbol]
+            return deps
+
+        x0_deps = {
+            state.get_id(): dependencies(x0) & p
+            for state, x0 in zip(self._states, self.eq('x0'))
+        }
+        # total abundances are computed from the initial states
+        tcl_deps = {
+            tc: (dependencies(total) & p).union(*(
+                x0_deps[symbol] for symbol in total.free_symbols
+                if symbol in x0_deps
+            ))
+            for tc, total in zip(tcl, self.eq('total_cl'))
+        }
+
+        x_idx = {symbol: ix for ix, symbol in enumerate(x)}
+        seeds = {par: {x_idx[symbol] for symbol in x if par in x0_deps[symbol]}
+                 for par in p}
+        dependents = [set() for _ in x]
+        for ix, xdot in enumerate(self.eq('xdot')):
+            for symbol in dependencies(xdot):
+                if symbol in x_idx:
+                    dependents[x_idx[symbol]].add(ix)
+                elif symbol in p:
+                    seeds[symbol].add(ix)
+                else:
+                    for par in tcl_deps[symbol]:
+                        seeds[par].add(ix)
+
+        structure = []
+        for par in self.sym('p'):
+            reached = set()
+            stack = list(seeds[par])
+            while stack:
+                ix = stack.pop()
+                if ix not in reached:
+                    reached.add(ix)
+                    stack.extend(dependents[ix] - reached)
+            structure.append(sorted(reached))
+        return structure
+
     def sym(self,
             name: str,
             stripped: Optional[bool] = False) -> sp.Matrix:
@@ -1557,6 +1679,12 @@ class ODEModel:
                 for ie in range(self.num_events())
             ]
 
+        elif name == 'trigger_times':
+            self._eqs[name] = sp.Matrix([
+                self._get_trigger_time(self.eq('root')[ie])
+                for ie in self.get_time_triggered_events()
+            ])
+
         elif name == 'stau':
             self._eqs[name] = [
                 -self.eq('sroot')[ie, :] / self.eq('drootdt_total')[ie]
@@ -2149,6 +2277,10 @@ class ODEExporter:
 
     :ivar generate_sensitivity_code:
         Specifies whether code for sensitivity computation is to be generated
+
+    :ivar cse:
+        Specifies whether common subexpressions are extracted into temporary
+        variables in the generated code
     """
 
     def __init__(
@@ -2160,7 +2292,8 @@ class ODEExporter:
             compiler: Optional[str] = None,
             allow_reinit_fixpar_initcond: Optional[bool] = True,
             generate_sensitivity_code: Optional[bool] = True,
-            model_name: Optional[str] = 'model'
+            model_name: Optional[str] = 'model',
+            cse: Optional[bool] = False
     ):
         """
         Generate AMICI C++ files for the ODE provided to the constructor.
@@ -2192,6 +2325,13 @@ class ODEExporter:
 
         :param model_name:
             name of the model to be used during code generation
+
+        :param cse:
+            if set to ``True``, common subexpressions within each generated
+            function are computed only once and stored in temporary
+            variables. The resulting reduction of the operation count is
+            logged per function and is available via
+            :meth:`ODEExporter.get_cse_report`.
         """
         set_log_level(logger, verbose)
 
@@ -2215,6 +2355,8 @@ class ODEExporter:
         self.allow_reinit_fixpar_initcond: bool = allow_reinit_fixpar_initcond
         self._build_hints = set()
         self.generate_sensitivity_code: bool = generate_sensitivity_code
+        self.cse: bool = cse
+        self.model._code_printer.extract_cse = cse
 
     @log_execution_time('generating cpp code', logger)
     def generate_model_code(self) -> None:
@@ -2229,6 +2371,29 @@ class ODEExporter:
             self._generate_c_code()
             self._generate_m_code()
 
+        if self.cse:
+            for function, (ops_before, ops_after) \
+                    in self.get_cse_report().items():
+                logger.info(f'CSE reduced the number of operations in '
+                            f'{function} from {ops_before} to {ops_after}.')
+
+    def get_cse_report(self) -> Dict[str, Tuple[int, int]]:
+        """
+        Get the number of operations required to evaluate each generated
+        function before and after common subexpression elimination.
+
+        Only available if the code was generated with ``cse=True``.
+
+        :return:
+            dict mapping function names to a tuple of operation counts
+            before and after common subexpression elimination
+        """
+        return {
+            function: tuple(counts)
+            for function, counts in
+            self.model._code_printer.op_counts.items()
+        }
+
     @log_execution_time('compiling cpp code', logger)
     def compile_model(self) -> None:
         """
@@ -2681,7 +2846,8 @@ class ODEExporter:
                             f'{self.model._code_printer.doprint(formula)};'
                         ])
                 cases[ipar] = expressions
-            lines.extend(get_switch_statement('ip', cases, 1))
+            lines.extend(get_switch_statement('ip', cases, 1,
+                                              scoped=self.cse))
 
         elif function == 'x0_fixedParameters':
             for index, formula in zip(
@@ -2703,7 +2869,8 @@ class ODEExporter:
                 for ie in range(self.model.num_events())
                 if not smart_is_zero_matrix(equations[ie])
             }
-            lines.extend(get_switch_statement('ie', cases, 1))
+            lines.extend(get_switch_statement('ie', cases, 1,
+                                              scoped=self.cse))
 
         elif function in event_sensi_functions:
             outer_cases = {}
@@ -2716,9 +2883,10 @@ class ODEExporter:
                     if not smart_is_zero_matrix(inner_equations[:, ipar])
                 }
                 inner_lines.extend(get_switch_statement(
-                    'ip', inner_cases, 0))
+                    'ip', inner_cases, 0, scoped=self.cse))
                 outer_cases[ie] = copy.copy(inner_lines)
-            lines.extend(get_switch_statement('ie', outer_cases, 1))
+            lines.extend(get_switch_statement('ie', outer_cases, 1,
+                                              scoped=self.cse))
 
         elif function in sensi_functions \
                 and equations.shape[1] == self.model.num_par():
@@ -2728,7 +2896,8 @@ class ODEExporter:
                 for ipar in range(self.model.num_par())
                 if not smart_is_zero_matrix(equations[:, ipar])
             }
-            lines.extend(get_switch_statement('ip', cases, 1))
+            lines.extend(get_switch_statement('ip', cases, 1,
+                                              scoped=self.cse))
         elif function in multiobs_functions:
             if function == 'dJydy':
                 cases = {
@@ -2744,7 +2913,8 @@ class ODEExporter:
                     for iobs in range(self.model.num_obs())
                     if not smart_is_zero_matrix(equations[:, iobs])
                 }
-            lines.extend(get_switch_statement('iy', cases, 1))
+            lines.extend(get_switch_statement('iy', cases, 1,
+                                              scoped=self.cse))
 
         elif function in self.model.sym_names() \
                 and function not in non_unique_id_symbols:
@@ -2877,6 +3047,13 @@ class ODEExporter:
             'AMICI_VERSION_STRING':  __version__,
             'AMICI_COMMIT_STRING': __commit__,
             'W_RECURSION_DEPTH': self.model._w_recursion_depth,
+            'TIME_TRIGGERED_EVENTS': ', '.join(
+                str(ie) for ie in self.model.get_time_triggered_events()
+            ),
+            'STATE_SENSITIVITY_STRUCTURE': ', '.join(
+                '{' + ', '.join(str(ix) for ix in ixs) + '}'
+                for ixs in self.model.get_state_sensitivity_structure()
+            ),
             'QUADRATIC_LLH': 'true'
                 if self.model._has_quadratic_nllh else 'false',
         }
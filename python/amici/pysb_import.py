@@ -51,6 +51,7 @@ def pysb2amici(
         # See https://github.com/AMICI-dev/AMICI/pull/1672
         cache_simplify: bool = False,
         generate_sensitivity_code: bool = True,
+        cse: bool = False,
 ):
     r"""
     Generate AMICI C++ files for the provided model.
@@ -124,6 +125,9 @@ def pysb2amici(
     :param generate_sensitivity_code:
         if set to ``False``, code for sensitivity computation will not be
         generated
+
+    :param cse:
+        see :class:`amici.ode_export.ODEExporter`
     """
     if observables is None:
         observables = []
@@ -150,7 +154,8 @@ def pysb2amici(
         verbose=verbose,
         assume_pow_positivity=assume_pow_positivity,
         compiler=compiler,
-        generate_sensitivity_code=generate_sensitivity_code
+        generate_sensitivity_code=generate_sensitivity_code,
+        cse=cse
     )
     exporter.generate_model_code()
 
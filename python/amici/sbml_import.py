@@ -222,6 +222,7 @@ class SbmlImporter:
                    cache_simplify: bool = False,
                    log_as_log10: bool = True,
                    generate_sensitivity_code: bool = True,
+                   cse: bool = False,
                    **kwargs) -> None:
         """
         Generate and compile AMICI C++ files for the model provided to the
@@ -306,6 +307,9 @@ class SbmlImporter:
             If ``False``, the code required for sensitivity computation will
             not be generated
 
+        :param cse:
+            see :class:`amici.ode_export.ODEExporter`
+
         """
         set_log_level(logger, verbose)
 
@@ -385,7 +389,8 @@ class SbmlImporter:
             assume_pow_positivity=assume_pow_positivity,
             compiler=compiler,
             allow_reinit_fixpar_initcond=allow_reinit_fixpar_initcond,
-            generate_sensitivity_code=generate_sensitivity_code
+            generate_sensitivity_code=generate_sensitivity_code,
+            cse=cse
         )
         exporter.generate_model_code()
 
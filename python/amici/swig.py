@@ -94,11 +94,13 @@ class TypeHintFixer(ast.NodeTransformer):
         'amici::Model const *': 'amici.Model',
         'amici::NewtonDampingFactorMode': 'amici.NewtonDampingFactorMode',
         'amici::NonlinearSolverIteration': 'amici.NonlinearSolverIteration',
+        'amici::PreconditionerType': 'amici.PreconditionerType',
         'amici::RDataReporting': 'amici.RDataReporting',
         'amici::SensitivityMethod': 'amici.SensitivityMethod',
         'amici::SensitivityOrder': 'amici.SensitivityOrder',
         'amici::Solver *': 'amici.Solver',
         'amici::SteadyStateSensitivityMode': 'amici.SteadyStateSensitivityMode',
+        'amici::SteadyStateWarmStartMode': 'amici.SteadyStateWarmStartMode',
         'amici::realtype': 'float',
         'DoubleVector': 'numpy.ndarray',
         'IntVector': 'List[int]',
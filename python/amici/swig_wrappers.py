@@ -1,12 +1,15 @@
 """Convenience wrappers for the swig interface"""
 import sys
+import threading
 from contextlib import contextmanager, suppress
 from typing import List, Optional, Union, Sequence, Dict, Any
+import numpy as np
 import amici.amici as amici_swig
 from . import numpy
 
 __all__ = [
-    'runAmiciSimulation', 'runAmiciSimulations', 'ExpData',
+    'runAmiciSimulation', 'runAmiciSimulations',
+    'runAmiciSimulationsAggregated', 'ExpData',
     'readSolverSettingsFromHDF5', 'writeSolverSettingsToHDF5',
     'set_model_settings', 'get_model_settings',
     'AmiciModel', 'AmiciSolver', 'AmiciExpData', 'AmiciReturnData',
@@ -26,15 +29,37 @@ except ModuleNotFoundError:
     sys_pipes = suppress
 
 
+# The C-level stdout redirection is process-wide. When simulations run
+# concurrently from several Python threads, it is set up by the first and torn
+# down by the last of them.
+_capture_lock = threading.Lock()
+_capture_users = 0
+_capture_pipes = None
+
+
 @contextmanager
 def _capture_cstdout():
     """Redirect C/C++ stdout to python stdout if python stdout is redirected,
     e.g. in ipython notebook"""
+    global _capture_users, _capture_pipes
+
     if sys.stdout == sys.__stdout__:
         yield
-    else:
-        with sys_pipes():
-            yield
+        return
+
+    with _capture_lock:
+        if _capture_users == 0:
+            _capture_pipes = sys_pipes()
+            _capture_pipes.__enter__()
+        _capture_users += 1
+    try:
+        yield
+    finally:
+        with _capture_lock:
+            _capture_users -= 1
+            if _capture_users == 0:
+                pipes, _capture_pipes = _capture_pipes, None
+                pipes.__exit__(None, None, None)
 
 
 def _get_ptr(
@@ -136,6 +161,59 @@ def runAmiciSimulations(
     return [numpy.ReturnDataView(r) for r in rdata_ptr_list]
 
 
+def runAmiciSimulationsAggregated(
+        model: AmiciModel,
+        solver: AmiciSolver,
+        edata_list: AmiciExpDataVector,
+        failfast: bool = True,
+        num_threads: int = 1,
+        failures_only: bool = False,
+) -> Dict[str, Any]:
+    """
+    Convenience wrapper for :py:func:`amici.amici.runAmiciSimulationsAggregated`
+
+    Same as :py:func:`runAmiciSimulations`, but only returns the objective
+    function value and its derivatives summed over all conditions. All
+    conditions must use the parameter list and parameter scaling of the
+    model.
+
+    :param model: Model instance
+    :param solver: Solver instance, must be generated from Model.getSolver()
+    :param edata_list: list of ExpData instances
+    :param failfast: returns as soon as an integration failure is encountered
+    :param num_threads: number of threads to use (only used if compiled
+        with openmp)
+    :param failures_only: only report the status of failed conditions
+
+    :returns: dictionary with the summed ``llh``, ``chi2``, ``sllh`` and
+        ``FIM`` (``None`` if not computed), the per-condition ``status``
+        (``None`` if ``failures_only``), and the indices and status of the
+        failed conditions (``failed_conditions``, ``failed_status``).
+        Conditions skipped due to ``failfast`` are reported as failed with
+        status ``AMICI_NOT_RUN``.
+    """
+    with _capture_cstdout():
+        edata_ptr_vector = amici_swig.ExpDataPtrVector(edata_list)
+        result = amici_swig.runAmiciSimulationsAggregated(
+            _get_ptr(solver),
+            edata_ptr_vector,
+            _get_ptr(model),
+            failfast,
+            num_threads,
+            failures_only
+        )
+    return {
+        'llh': result.llh,
+        'chi2': result.chi2,
+        'sllh': np.array(result.sllh) if len(result.sllh) else None,
+        'FIM': np.array(result.FIM).reshape(result.nplist, result.nplist)
+        if len(result.FIM) else None,
+        'status': None if failures_only else np.array(result.status),
+        'failed_conditions': np.array(result.failed_conditions, dtype=int),
+        'failed_status': np.array(result.failed_status, dtype=int),
+    }
+
+
 def readSolverSettingsFromHDF5(
         file: str,
         solver: AmiciSolver,
@@ -177,6 +255,9 @@ model_instance_settings = [
     'FixedParameters',
     'InitialStates',
     'InitialStateSensitivities',
+    'InnerOffsetParameters',
+    'InnerScalingParameters',
+    'InnerSigmaParameters',
     'MinimumSigmaResiduals',
     ('nMaxEvent', 'setNMaxEvent'),
     'Parameters',
@@ -2,6 +2,7 @@
 
 import os
 import random
+from concurrent.futures import ThreadPoolExecutor
 
 import amici
 import pytest
@@ -67,3 +68,36 @@ def test_solver_hdf5_roundtrip(sbml_example_presimulation_module):
                 getattr(new_solver, attr.replace('set', 'get'))()), attr
 
     os.remove(hdf5file)
+
+
+@pytest.mark.skipif(not amici.hdf5_enabled,
+                    reason='AMICI was compiled without HDF5')
+def test_concurrent_simulation_and_hdf5_io(sbml_example_presimulation_module,
+                                           tmp_path):
+    """Simulations and HDF5 I/O from multiple Python threads"""
+    model = sbml_example_presimulation_module.getModel()
+    model.setTimepoints([0, 1, 10])
+    solver = model.getSolver()
+    solver.setSensitivityOrder(amici.SensitivityOrder.first)
+    rdata_ref = amici.runAmiciSimulation(model, solver)
+
+    def simulate_and_write(i):
+        thread_model = model.clone()
+        thread_solver = solver.clone()
+        rdata = amici.runAmiciSimulation(thread_model, thread_solver)
+        hdf5file = str(tmp_path / f'thread_{i}.h5')
+        amici.writeSolverSettingsToHDF5(thread_solver, hdf5file, 'solver')
+        amici.writeReturnData(rdata['ptr'].get(), hdf5file, 'rdata')
+        new_solver = model.getSolver()
+        amici.readSolverSettingsFromHDF5(hdf5file, new_solver, 'solver')
+        return rdata, new_solver
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(simulate_and_write, range(16)))
+
+    for rdata, new_solver in results:
+        assert rdata['status'] == amici.AMICI_SUCCESS
+        assert rdata['x'] == pytest.approx(rdata_ref['x'])
+        assert rdata['sx'] == pytest.approx(rdata_ref['sx'])
+        assert new_solver.getSensitivityOrder() \
+            == amici.SensitivityOrder.first
@@ -2,6 +2,9 @@
 
 import sympy as sp
 from amici.cxxcodeprinter import AmiciCxxCodePrinter
+from amici.import_utils import symbol_with_assumptions
+from amici.ode_export import ODEModel
+from amici.ode_model import Constant, Event, Expression, Parameter, State
 
 
 def test_csc_matrix():
@@ -61,3 +64,110 @@ def test_csc_matrix_vector():
     assert sparse_list == sp.Matrix([[3]])
     assert symbol_list == ['da2_db_1']
     assert str(sparse_matrix) == 'Matrix([[0], [da2_db_1]])'
+
+
+def test_sym_lines_cse():
+    """Test extraction of common subexpressions"""
+    x, y, k = sp.symbols('x y k', real=True)
+    equations = sp.Matrix([k * x**2 * y**3 + sp.exp(k * x**2), 0,
+                           -k * x**2 * y**3])
+
+    printer = AmiciCxxCodePrinter(extract_cse=True)
+    lines = printer._get_sym_lines_array(equations, 'xdot', 0)
+
+    assert lines == [
+        'const realtype _amici_cse_0 = k*std::pow(x, 2);',
+        'const realtype _amici_cse_1 = _amici_cse_0*std::pow(y, 3);',
+        'xdot[0] = _amici_cse_1 + std::exp(_amici_cse_0);',
+        'xdot[2] = -_amici_cse_1;',
+    ]
+    ops_before, ops_after = printer.op_counts['xdot']
+    assert ops_after < ops_before
+
+    # no temporaries unless requested
+    assert AmiciCxxCodePrinter()._get_sym_lines_array(
+        equations, 'xdot', 0) == [
+        'xdot[0] = k*std::pow(x, 2)*std::pow(y, 3) + std::exp(k*std::pow(x, 2));',
+        'xdot[2] = -k*std::pow(x, 2)*std::pow(y, 3);',
+    ]
+
+
+def test_sym_lines_symbols_cse():
+    """Test that temporaries are declared after the symbols they use"""
+    x, y, k = sp.symbols('x y k', real=True)
+    w = sp.symbols('w0 w1 w2', real=True)
+    # w1 and w2 depend on w0, and share a subexpression that contains it
+    equations = sp.Matrix([k * x, 2 * w[0] * y + sp.exp(w[0] * y),
+                           3 * w[0] * y])
+
+    printer = AmiciCxxCodePrinter(extract_cse=True)
+    lines = printer._get_sym_lines_symbols(sp.Matrix(w), equations, 'w', 0)
+
+    assert lines == [
+        'w0 = k*x;  // w[0]',
+        'const realtype _amici_cse_0 = w0*y;',
+        'w1 = 2*_amici_cse_0 + std::exp(_amici_cse_0);  // w[1]',
+        'w2 = 3*_amici_cse_0;  // w[2]',
+    ]
+
+
+def test_time_triggered_events():
+    """Test detection of events with trigger times known before simulation"""
+    t = symbol_with_assumptions('t')
+    x1 = symbol_with_assumptions('x1')
+    p1, p2 = symbol_with_assumptions('p1'), symbol_with_assumptions('p2')
+    k1 = symbol_with_assumptions('k1')
+
+    ode = ODEModel(simplify=None)
+    ode.add_component(Parameter(p1, 'p1', 1.0))
+    ode.add_component(Parameter(p2, 'p2', 2.0))
+    ode.add_component(Constant(k1, 'k1', 3.0))
+    ode.add_component(State(x1, 'x1', sp.Float(1.0), -p1 * x1))
+    for ie, root in enumerate([
+        t - p1,             # time-triggered
+        p2 * (t - k1) + 1,  # time-triggered, parameter-dependent slope
+        x1 - p1,            # state-dependent
+        t ** 2 - p1,        # nonlinear in time
+        p1 - k1,            # independent of time
+    ]):
+        ode.add_component(Event(sp.Symbol(f'event_{ie}'), f'event_{ie}',
+                                root, sp.Matrix([0]), None))
+    ode.generate_basic_variables()
+
+    assert ode.get_time_triggered_events() == [0, 1]
+    assert sp.simplify(
+        ode.eq('trigger_times') - sp.Matrix([p1, k1 - 1 / p2])
+    ) == sp.zeros(2, 1)
+
+
+def test_state_sensitivity_structure():
+    """Test detection of structurally zero state sensitivities"""
+    x1, x2, x3, x4 = (symbol_with_assumptions(f'x{i}') for i in range(1, 5))
+    p1, p2, p3, p4 = (symbol_with_assumptions(f'p{i}') for i in range(1, 5))
+    w1 = symbol_with_assumptions('w1')
+    total = symbol_with_assumptions('total_x2')
+
+    def create_model(with_event):
+        ode = ODEModel(simplify=None)
+        for par in (p1, p2, p3, p4):
+            ode.add_component(Parameter(par, str(par), 1.0))
+        ode.add_component(State(x1, 'x1', p4, -p1 * x1 + x2))
+        ode.add_component(State(x2, 'x2', sp.Float(1.0), p1 * x1 - x2))
+        ode.add_component(State(x3, 'x3', sp.Float(0.0), w1 - x3))
+        ode.add_component(State(x4, 'x4', sp.Float(0.0), x3 - x4))
+        ode.add_component(Expression(w1, 'w1', p2 ** 2))
+        ode.add_conservation_law(x2, total, total - x1, x1 + x2)
+        if with_event:
+            ode.add_component(Event(sp.Symbol('event_0'), 'event_0', x1 - 0.5,
+                                    sp.Matrix([p3, 0, 0]), None))
+        ode.generate_basic_variables()
+        return ode
+
+    # solver states are x1, x3, x4; p3 enters no state, p4 enters the
+    # initial value of x1 and thus the total abundance
+    assert create_model(with_event=False).get_state_sensitivity_structure() \
+        == [[0], [1, 2], [], [0]]
+
+    # event assignments may introduce additional dependencies
+    assert create_model(with_event=True).get_state_sensitivity_structure() \
+        == []
@@ -375,3 +375,214 @@ def test_newton_solver_equilibration(preeq_fixture):
     rdata_spbcg = amici.runAmiciSimulation(model, solver, edata)
 
     assert rdata_spbcg['status'] == amici.AMICI_ERROR
+
+
+def test_steadystate_warm_start(preeq_fixture):
+    """Warm-started preequilibration yields the same results as cold start"""
+
+    model, solver, edata, edata_preeq, \
+        edata_presim, edata_sim, pscales, plists = preeq_fixture
+
+    edata.t_presim = 0.0
+    edata.fixedParametersPresimulation = ()
+    model.setSteadyStateSensitivityMode(
+        amici.SteadyStateSensitivityMode.newtonOnly)
+    solver.setNewtonMaxSteps(10)
+
+    p = np.asarray(model.getParameters())
+    warm_solver = solver.clone()
+
+    for mode in [amici.SteadyStateWarmStartMode.previous,
+                 amici.SteadyStateWarmStartMode.firstOrder]:
+        warm_solver.setSteadyStateWarmStartMode(mode)
+        warm_solver.resetSteadyStateWarmStart()
+
+        for scale in [1.0, 1.01, 1.02]:
+            model.setParameters(p * scale)
+            rdata_cold = amici.runAmiciSimulation(model, solver, edata)
+            rdata_warm = amici.runAmiciSimulation(model, warm_solver, edata)
+
+            assert rdata_cold['status'] == amici.AMICI_SUCCESS
+            assert rdata_warm['status'] == amici.AMICI_SUCCESS
+            for variable in ['llh', 'sllh', 'x_ss', 'sx_ss']:
+                assert np.isclose(
+                    rdata_cold[variable], rdata_warm[variable],
+                    1e-6, 1e-6
+                ).all(), variable
+
+        # after the first run, Newton's method starts close to the steady
+        # state
+        assert rdata_warm['preeq_numsteps'][0] \
+            <= rdata_cold['preeq_numsteps'][0]
+
+    model.setParameters(p)
+
+
+def test_newton_jacobian_reuse(preeq_fixture):
+    """Modified Newton's method yields the same steady state as the full
+    Newton method"""
+
+    model, solver, edata, edata_preeq, \
+        edata_presim, edata_sim, pscales, plists = preeq_fixture
+
+    edata.t_presim = 0.0
+    edata.fixedParametersPresimulation = ()
+    model.setSteadyStateSensitivityMode(
+        amici.SteadyStateSensitivityMode.newtonOnly)
+    solver.setNewtonMaxSteps(20)
+
+    reuse_solver = solver.clone()
+    reuse_solver.setNewtonJacobianReuse(True)
+
+    rdata_full = amici.runAmiciSimulation(model, solver, edata)
+    rdata_reuse = amici.runAmiciSimulation(model, reuse_solver, edata)
+
+    assert rdata_full['status'] == amici.AMICI_SUCCESS
+    assert rdata_reuse['status'] == amici.AMICI_SUCCESS
+    for variable in ['llh', 'sllh', 'x_ss', 'sx_ss']:
+        assert np.isclose(
+            rdata_full[variable], rdata_reuse[variable],
+            1e-6, 1e-6
+        ).all(), variable
+
+    assert 0 < rdata_reuse['preeq_numfactorizations'] \
+        <= rdata_full['preeq_numfactorizations']
+
+
+def test_pseudo_transient_continuation(preeq_fixture):
+    """Pseudo-transient continuation yields the same steady state as
+    simulation if Newton's method fails"""
+
+    model, solver, edata, edata_preeq, \
+        edata_presim, edata_sim, pscales, plists = preeq_fixture
+
+    edata.t_presim = 0.0
+    edata.fixedParametersPresimulation = ()
+    model.setSteadyStateSensitivityMode(
+        amici.SteadyStateSensitivityMode.newtonOnly)
+    # make the first run of Newton's method fail
+    solver.setNewtonMaxSteps(2)
+
+    ptc_solver = solver.clone()
+    ptc_solver.setSteadyStatePseudoTransientContinuation(True)
+
+    rdata_sim = amici.runAmiciSimulation(model, solver, edata)
+    rdata_ptc = amici.runAmiciSimulation(model, ptc_solver, edata)
+
+    assert rdata_sim['status'] == amici.AMICI_SUCCESS
+    assert rdata_ptc['status'] == amici.AMICI_SUCCESS
+    for variable in ['llh', 'sllh', 'x_ss', 'sx_ss']:
+        assert np.isclose(
+            rdata_sim[variable], rdata_ptc[variable],
+            1e-6, 1e-6
+        ).all(), variable
+
+    assert rdata_sim['preeq_ptc_numsteps'] == 0
+    if rdata_ptc['preeq_status'][0] != amici.SteadyStateStatus.success:
+        assert rdata_ptc['preeq_status'][2] == amici.SteadyStateStatus.success
+        assert rdata_ptc['preeq_numsteps'][1] == 0
+        assert 0 < rdata_ptc['preeq_ptc_numsteps'] \
+            <= rdata_ptc['preeq_ptc_numlinsolves']
+
+
+def test_newton_iterative_linear_solvers(preeq_fixture):
+    """Newton's method with preconditioned iterative linear solvers yields
+    the same steady state as with a direct linear solver"""
+
+    model, solver, edata, edata_preeq, \
+        edata_presim, edata_sim, pscales, plists = preeq_fixture
+
+    edata.t_presim = 0.0
+    edata.fixedParametersPresimulation = ()
+    solver.setSensitivityOrder(amici.SensitivityOrder.none)
+    solver.setNewtonMaxSteps(20)
+    solver.setNewtonMaxLinearSteps(100)
+
+    rdata_direct = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata_direct['status'] == amici.AMICI_SUCCESS
+
+    linear_solvers = [amici.LinearSolver.SPBCG, amici.LinearSolver.SPGMR]
+    preconditioners = [
+        amici.PreconditionerType.none, amici.PreconditionerType.jacobi,
+        amici.PreconditionerType.blockJacobi, amici.PreconditionerType.ILU
+    ]
+    rdatas = {}
+    for linsol, preconditioner, reuse in itertools.product(
+            linear_solvers, preconditioners, [False, True]):
+        iterative_solver = solver.clone()
+        iterative_solver.setLinearSolver(linsol)
+        iterative_solver.setPreconditionerType(preconditioner)
+        iterative_solver.setNewtonJacobianReuse(reuse)
+
+        rdata = amici.runAmiciSimulation(model, iterative_solver, edata)
+        rdatas[linsol, preconditioner, reuse] = rdata
+
+        assert rdata['status'] == amici.AMICI_SUCCESS
+        assert rdata['preeq_status'][0] == amici.SteadyStateStatus.success
+        for variable in ['llh', 'x_ss']:
+            assert np.isclose(
+                rdata_direct[variable], rdata[variable],
+                1e-6, 1e-6
+            ).all(), variable
+
+    for linsol in linear_solvers:
+        # (block-)incomplete factorizations need fewer linear iterations than
+        # the diagonal scaling that is applied without a preconditioner
+        numlinsteps_none = np.sum(
+            rdatas[linsol, amici.PreconditionerType.none, False][
+                'preeq_numlinsteps'])
+        for preconditioner in [amici.PreconditionerType.blockJacobi,
+                               amici.PreconditionerType.ILU]:
+            assert np.sum(rdatas[linsol, preconditioner, False][
+                'preeq_numlinsteps']) < numlinsteps_none, preconditioner
+
+        # reusing the preconditioner saves setups if more than one Newton
+        # step is needed
+        for preconditioner in preconditioners[1:]:
+            numfact = rdatas[linsol, preconditioner, False][
+                'preeq_numfactorizations']
+            numfact_reuse = rdatas[linsol, preconditioner, True][
+                'preeq_numfactorizations']
+            assert numfact_reuse >= 1, preconditioner
+            if numfact > 1:
+                assert numfact_reuse < numfact, preconditioner
+            else:
+                assert numfact_reuse == numfact, preconditioner
+
+
+def test_concurrent_steady_state_search(preeq_fixture):
+    """Running Newton's method and simulation concurrently yields the same
+    steady state as trying them one after the other"""
+
+    model, solver, edata, edata_preeq, \
+        edata_presim, edata_sim, pscales, plists = preeq_fixture
+
+    edata.t_presim = 0.0
+    edata.fixedParametersPresimulation = ()
+
+    for equil_meth, newton_steps in itertools.product(
+            [amici.SteadyStateSensitivityMode.newtonOnly,
+             amici.SteadyStateSensitivityMode.simulationFSA],
+            [0, 10]):
+        model.setSteadyStateSensitivityMode(equil_meth)
+        solver.setNewtonMaxSteps(newton_steps)
+
+        concurrent_solver = solver.clone()
+        concurrent_solver.setSteadyStateConcurrentSearch(True)
+
+        rdata_seq = amici.runAmiciSimulation(model, solver, edata)
+        rdata_conc = amici.runAmiciSimulation(model, concurrent_solver, edata)
+
+        assert rdata_seq['status'] == amici.AMICI_SUCCESS
+        assert rdata_conc['status'] == amici.AMICI_SUCCESS
+        for variable in ['llh', 'sllh', 'x_ss', 'sx_ss']:
+            assert np.isclose(
+                rdata_seq[variable], rdata_conc[variable],
+                1e-6, 1e-6
+            ).all(), variable
+
+        # exactly one of the methods provides the steady state
+        assert sum(
+            status == amici.SteadyStateStatus.success
+            for status in rdata_conc['preeq_status'][:2]
+        ) == 1
@@ -152,6 +152,154 @@ def test_sbml2amici_observable_dependent_error(observable_dependent_error_model)
     check_derivatives(model, solver, edata)
 
 
+def _inner_parameter_model(simple_sbml_model, noise_distribution):
+    sbml_doc, sbml_model = simple_sbml_model
+    sbml_model.getSpecies("S1").setInitialConcentration(1.0)
+    sbml_model.getParameter("p1").setValue(0.2)
+    rr = sbml_model.createRateRule()
+    rr.setVariable("S1")
+    rr.setMath(libsbml.parseL3Formula("-p1 * S1"))
+    for par_id, value in (('scaling', 1.0), ('offset', 0.0), ('noise', 1.0)):
+        par = sbml_model.createParameter()
+        par.setId(par_id)
+        par.setValue(value)
+
+    sbml_importer = SbmlImporter(sbml_source=sbml_model,
+                                 from_file=False)
+
+    with TemporaryDirectory() as tmpdir:
+        sbml_importer.sbml2amici(
+            model_name="test",
+            output_dir=tmpdir,
+            observables={'observable_s1': {'formula': 'scaling * S1 + offset'}},
+            sigmas={'observable_s1': 'noise'},
+            noise_distributions={'observable_s1': noise_distribution},
+        )
+        yield amici.import_model_module(module_name='test',
+                                        module_path=tmpdir)
+
+
+@pytest.fixture
+def inner_parameter_model(simple_sbml_model):
+    yield from _inner_parameter_model(simple_sbml_model, 'normal')
+
+
+@pytest.fixture
+def inner_parameter_model_log(simple_sbml_model):
+    yield from _inner_parameter_model(simple_sbml_model, 'log-normal')
+
+
+def test_inner_parameters(inner_parameter_model):
+    """Check analytically computed scaling, offset and noise parameters"""
+    model = inner_parameter_model.getModel()
+    model.setTimepoints(np.linspace(0, 10, 21))
+    solver = model.getSolver()
+    solver.setRelativeTolerance(1e-12)
+    solver.setAbsoluteTolerance(1e-12)
+    ids = model.getParameterIds()
+
+    rdata = amici.runAmiciSimulation(model, solver)
+    h = rdata.y[:, 0]
+    edata = amici.ExpData(rdata, 1.0, 0.0)
+    edata.setObservedData(2.0 * h + 0.5 + 0.1 * np.sin(np.arange(len(h))))
+    edata.setObservedDataStdDev(np.nan)
+    m = np.asarray(edata.getObservedData())
+
+    model.setInnerScalingParameters([ids.index('scaling')])
+    model.setInnerOffsetParameters([ids.index('offset')])
+    model.setInnerSigmaParameters([ids.index('noise')])
+    model.setParameterList([ids.index('p1')])
+    solver.setSensitivityOrder(amici.SensitivityOrder.first)
+    solver.setSensitivityMethod(amici.SensitivityMethod.forward)
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata.status == amici.AMICI_SUCCESS
+
+    scaling, offset = np.polyfit(h, m, 1)
+    noise = np.sqrt(np.mean((m - scaling * h - offset) ** 2))
+    inner_parameters = rdata.inner_parameters
+    assert np.isnan(inner_parameters[ids.index('p1')])
+    assert np.isclose(inner_parameters[ids.index('scaling')], scaling)
+    assert np.isclose(inner_parameters[ids.index('offset')], offset)
+    assert np.isclose(inner_parameters[ids.index('noise')], noise)
+
+    # same objective function and gradient as for the optimal values
+    # passed as ordinary parameters, where the inner parameters are at a
+    # stationary point
+    ref_model = inner_parameter_model.getModel()
+    ref_model.setTimepoints(model.getTimepoints())
+    ref_model.setParameterById({'scaling': scaling, 'offset': offset,
+                                'noise': noise})
+    rdata_ref = amici.runAmiciSimulation(ref_model, solver, edata)
+    assert np.isclose(rdata.llh, rdata_ref.llh)
+    assert np.isclose(rdata.sllh[0], rdata_ref.sllh[ids.index('p1')])
+    assert np.allclose(np.delete(rdata_ref.sllh, ids.index('p1')), 0.0,
+                       atol=1e-6)
+
+    # not supported for adjoint sensitivities
+    solver.setSensitivityMethod(amici.SensitivityMethod.adjoint)
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata.status == amici.AMICI_ERROR
+
+
+def test_inner_parameters_not_identifiable(inner_parameter_model):
+    """Scaling parameters that cannot be determined keep their value"""
+    model = inner_parameter_model.getModel()
+    model.setTimepoints(np.linspace(0, 10, 21))
+    ids = model.getParameterIds()
+    model.setParameterById({'p1': 0.0, 'scaling': 3.0})
+    solver = model.getSolver()
+    edata = amici.ExpData(model.get())
+    m = 2.0 + 0.1 * np.sin(np.arange(model.nt()))
+    edata.setObservedData(m)
+    edata.setObservedDataStdDev(np.nan)
+
+    # constant S1: scaling and offset are not identifiable, the offset is
+    # fitted for the current scaling
+    model.setInnerScalingParameters([ids.index('scaling')])
+    model.setInnerOffsetParameters([ids.index('offset')])
+    model.setInnerSigmaParameters([ids.index('noise')])
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata.status == amici.AMICI_SUCCESS
+    inner_parameters = rdata.inner_parameters
+    assert inner_parameters[ids.index('scaling')] == 3.0
+    assert np.isclose(inner_parameters[ids.index('offset')], np.mean(m) - 3.0)
+    assert np.isclose(inner_parameters[ids.index('noise')], np.std(m))
+    assert np.isfinite(rdata.llh)
+
+    # zero S1: scaling does not affect the observable
+    model.setInitialStates([0.0])
+    model.setInnerOffsetParameters([-1])
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata.status == amici.AMICI_SUCCESS
+    inner_parameters = rdata.inner_parameters
+    assert inner_parameters[ids.index('scaling')] == 3.0
+    assert np.isclose(inner_parameters[ids.index('noise')],
+                      np.sqrt(np.mean(m ** 2)))
+    assert np.isfinite(rdata.llh)
+
+
+def test_inner_parameters_log_scale(inner_parameter_model_log):
+    """Inner parameters are rejected for observables on log scale"""
+    model = inner_parameter_model_log.getModel()
+    model.setTimepoints(np.linspace(0, 10, 21))
+    ids = model.getParameterIds()
+    solver = model.getSolver()
+    edata = amici.ExpData(model.get())
+    edata.setObservedData(np.exp(-0.1 * np.arange(model.nt())))
+    edata.setObservedDataStdDev(np.nan)
+
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+    assert rdata.status == amici.AMICI_SUCCESS
+
+    for setter, par_id in (('setInnerScalingParameters', 'scaling'),
+                           ('setInnerOffsetParameters', 'offset'),
+                           ('setInnerSigmaParameters', 'noise')):
+        inner_model = model.clone()
+        getattr(inner_model, setter)([ids.index(par_id)])
+        rdata = amici.runAmiciSimulation(inner_model, solver, edata)
+        assert rdata.status == amici.AMICI_ERROR, setter
+
+
 @pytest.fixture
 def model_steadystate_module():
     sbml_file = os.path.join(os.path.dirname(__file__), '..',
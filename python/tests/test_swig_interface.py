@@ -7,6 +7,8 @@ import copy
 import numbers
 
 import amici
+import numpy as np
+import pytest
 
 
 def test_version_number(pysb_example_presimulation_module):
@@ -79,6 +81,18 @@ model_instance_settings0 = {
         tuple([1.0] + [0.0]*35),
         tuple([.1]*36),
     ],
+    'InnerOffsetParameters': [
+        (-1,),
+        (1,),
+    ],
+    'InnerScalingParameters': [
+        (-1,),
+        (0,),
+    ],
+    'InnerSigmaParameters': [
+        (-1,),
+        (2,),
+    ],
     'MinimumSigmaResiduals': [
         50.0,
         60.0,
@@ -269,6 +283,7 @@ def test_unhandled_settings(pysb_example_presimulation_module):
         'get',
         'getAmiciCommit',
         'getAmiciVersion',
+        'getEventTriggerTimes',
         'getExpressionIds',
         'getExpressionNames',
         'getFixedParameterById',
@@ -276,6 +291,7 @@ def test_unhandled_settings(pysb_example_presimulation_module):
         'getFixedParameterIds',
         'getFixedParameterNames',
         'getName',
+        'getNonzeroStateSensitivityIndices',
         'getObservableIds',
         'getObservableNames',
         'getObservableScaling',
@@ -288,7 +304,9 @@ def test_unhandled_settings(pysb_example_presimulation_module):
         'getStateNames',
         'getStateIdsSolver',
         'getStateNamesSolver',
+        'getStateSensitivityStructure',
         'getTimepoint',
+        'getTimeTriggeredEvents',
         'getUnscaledParameters',
         'setAllStatesNonNegative',
         'setFixedParameterById',
@@ -317,6 +335,110 @@ def test_unhandled_settings(pysb_example_presimulation_module):
             assert attribute in handled, attribute
 
 
+def test_numpy_views(pysb_example_presimulation_module):
+    """ReturnDataView does not copy the C++ buffers, ExpDataView does"""
+    model = pysb_example_presimulation_module.getModel()
+    model.setTimepoints([0, 1, 10])
+    solver = model.getSolver()
+    solver.setSensitivityOrder(amici.SensitivityOrder.first)
+    rdata = amici.runAmiciSimulation(model, solver)
+
+    sx = rdata['sx']
+    assert sx.shape == (rdata.nt, rdata.nplist, rdata.nx)
+    assert not sx.flags.writeable
+    assert not sx.flags.owndata
+    assert sx.base is rdata['ptr']
+    assert rdata['x'] is rdata['x']
+    with pytest.raises(ValueError):
+        sx[0, 0, 0] = 42.0
+
+    # the view keeps the ReturnData instance alive
+    x = rdata['x']
+    x_expected = np.array(x)
+    del rdata
+    assert np.array_equal(x, x_expected)
+
+    edata = amici.ExpData(model.get())
+    edata.setTimepoints([0, 1, 10])
+    edata.setObservedData(np.ones(3 * edata.nytrue()).tolist())
+    edata_view = amici.ExpDataView(edata)
+    observed_data = edata_view['observedData']
+    assert observed_data.shape == (edata.nt(), edata.nytrue())
+    observed_data[0, 0] = 42.0
+    assert edata.getObservedData()[0] == 1.0
+
+    # the copy stays valid when the buffers of the ExpData instance are
+    # reallocated
+    edata.setTimepoints(np.linspace(0, 10, 100))
+    edata.setObservedData(np.zeros(100 * edata.nytrue()).tolist())
+    assert observed_data[0, 0] == 42.0
+    assert np.all(observed_data[1:, :] == 1.0)
+
+
+def test_run_simulations_aggregated(pysb_example_presimulation_module):
+    """Aggregated results match the sum over individual simulations"""
+    model = pysb_example_presimulation_module.getModel()
+    model.setTimepoints([0, 1, 10])
+    solver = model.getSolver()
+    solver.setSensitivityOrder(amici.SensitivityOrder.first)
+    solver.setSensitivityMethod(amici.SensitivityMethod.forward)
+    rdata = amici.runAmiciSimulation(model, solver)
+    edatas = [amici.ExpData(rdata, sigma, 0.0) for sigma in (0.5, 1.0, 2.0)]
+
+    rdatas = amici.runAmiciSimulations(model, solver, edatas)
+    result = amici.runAmiciSimulationsAggregated(model, solver, edatas)
+
+    assert result['llh'] == pytest.approx(sum(r['llh'] for r in rdatas))
+    assert result['sllh'] == pytest.approx(sum(r['sllh'] for r in rdatas))
+    assert result['FIM'] == pytest.approx(sum(r['FIM'] for r in rdatas))
+    assert (result['status'] == 0).all()
+    assert len(result['failed_conditions']) == 0
+
+    solver.setMaxSteps(1)
+    result = amici.runAmiciSimulationsAggregated(
+        model, solver, edatas, failures_only=True)
+    assert np.isnan(result['llh'])
+    assert result['status'] is None
+    assert len(result['failed_conditions']) > 0
+    assert (result['failed_status'] < 0).all()
+
+    # with failfast, all conditions after the first failure are skipped
+    result = amici.runAmiciSimulationsAggregated(
+        model, solver, edatas, failfast=True, num_threads=1)
+    assert np.isnan(result['llh'])
+    assert result['failed_conditions'].tolist() == [0, 1, 2]
+    assert (result['status'] == result['failed_status']).all()
+    assert sum(result['status'] == amici.AMICI_NOT_RUN) == len(edatas) - 1
+
+    # sensitivities w.r.t. different parameters cannot be summed
+    edatas[1].plist = [0]
+    with pytest.raises(RuntimeError):
+        amici.runAmiciSimulationsAggregated(model, solver, edatas)
+
+
+def test_interpolated_output(pysb_example_presimulation_module):
+    """Interpolated outputs match outputs at integrator stops"""
+    model = pysb_example_presimulation_module.getModel()
+    model.setTimepoints(np.linspace(0, 60, 1000))
+    solver = model.getSolver()
+    solver.setSensitivityOrder(amici.SensitivityOrder.first)
+    solver.setSensitivityMethod(amici.SensitivityMethod.forward)
+    edata = amici.ExpData(amici.runAmiciSimulation(model, solver), 1.0, 0.0)
+    rdata_stop = amici.runAmiciSimulation(model, solver, edata)
+
+    solver.setInterpolatedOutput(True)
+    rdata = amici.runAmiciSimulation(model, solver, edata)
+
+    assert rdata_stop['status'] == amici.AMICI_SUCCESS
+    assert rdata['status'] == amici.AMICI_SUCCESS
+    assert rdata_stop['numinterpolatedoutputs'] == 0
+    assert rdata['numinterpolatedoutputs'] > 0
+    assert rdata['numsteps'][-1] < rdata_stop['numsteps'][-1]
+    for field in ['x', 'sx', 'y', 'sy', 'llh', 'sllh']:
+        assert rdata[field] == pytest.approx(
+            rdata_stop[field], rel=1e-4, abs=1e-8), field
+
+
 def is_callable_but_not_getter(obj, attr):
     if not callable(getattr(obj, attr)):
         return False
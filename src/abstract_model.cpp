@@ -89,6 +89,16 @@ AbstractModel::fstau(realtype* /*stau*/,
                        __func__);
 }
 
+void
+AbstractModel::ftrigger_times(realtype* /*trigger_times*/,
+                              const realtype* /*p*/,
+                              const realtype* /*k*/)
+{
+    throw AmiException("Requested functionality is not supported as %s is "
+                       "not implemented for this model!",
+                       __func__);
+}
+
 void
 AbstractModel::fy(realtype* /*y*/,
                   const realtype /*t*/,
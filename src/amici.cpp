@@ -13,14 +13,22 @@
 #include <cvodes/cvodes.h>           //return codes
 #include <sundials/sundials_types.h> //realtype
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 // ensure definitions are in sync
 static_assert(amici::AMICI_SUCCESS == CV_SUCCESS,
               "AMICI_SUCCESS != CV_SUCCESS");
@@ -47,7 +55,84 @@ namespace amici {
   * amici::runAmiciSimulation or instantiating Solver and Model without special
   * needs.
   */
-AmiciApplication defaultContext = AmiciApplication();
+AmiciApplication defaultContext;
+
+namespace {
+
+/**
+ * @brief Append the size and the raw contents of a vector to a key
+ * @param key key
+ * @param values vector
+ */
+template <typename T>
+void appendToKey(std::string& key, std::vector<T> const& values)
+{
+    auto const size = values.size();
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(reinterpret_cast<const char*>(values.data()),
+               size * sizeof(T));
+}
+
+/**
+ * @brief Key under which the cost of a condition is recorded across calls to
+ * AmiciApplication::runAmiciSimulations.
+ *
+ * Conditions are identified by their id or, if none is set, by the settings
+ * that do not change between the calls of a parameter estimation, i.e. the
+ * fixed parameters, timepoints, initial states and parameter list, but not
+ * the parameters or the data.
+ *
+ * @param edata experimental data (may be nullptr)
+ * @return key
+ */
+std::string conditionCostKey(const ExpData* edata)
+{
+    if (!edata)
+        return "";
+    if (!edata->id.empty())
+        return "id:" + edata->id;
+    std::string key = "#";
+    appendToKey(key, edata->fixedParameters);
+    appendToKey(key, edata->fixedParametersPreequilibration);
+    appendToKey(key, edata->fixedParametersPresimulation);
+    appendToKey(key, std::vector<realtype>{edata->t_presim, edata->tstart_});
+    appendToKey(key, edata->getTimepoints());
+    appendToKey(key, edata->x0);
+    appendToKey(key, edata->sx0);
+    appendToKey(key, edata->plist);
+    return key;
+}
+
+/**
+ * @brief Total CPU time [ms] spent on the simulation that produced rdata
+ * @param rdata return data
+ * @return CPU time
+ */
+double simulationCost(ReturnData const& rdata)
+{
+    return rdata.cpu_time + rdata.cpu_timeB + rdata.preeq_cpu_time +
+           rdata.preeq_cpu_timeB + rdata.posteq_cpu_time +
+           rdata.posteq_cpu_timeB;
+}
+
+/**
+ * @brief Number of threads used for a batch of simulations
+ * @param num_threads requested number of threads
+ * @return number of threads
+ */
+#if defined(_OPENMP)
+int maxThreads(int num_threads)
+{
+    return std::max(num_threads, 1);
+}
+#else
+int maxThreads(int /* num_threads */)
+{
+    return 1;
+}
+#endif
+
+} // namespace
 
 std::unique_ptr<ReturnData>
 runAmiciSimulation(Solver& solver,
@@ -98,11 +183,48 @@ runAmiciSimulations(const Solver& solver,
 #endif
 }
 
+AggregatedReturnData
+runAmiciSimulationsAggregated(const Solver& solver,
+                              const std::vector<ExpData*>& edatas,
+                              const Model& model,
+                              const bool failfast,
+#if defined(_OPENMP)
+                              int num_threads,
+#else
+                              int /* num_threads */,
+#endif
+                              bool failures_only)
+{
+#if defined(_OPENMP)
+    return defaultContext.runAmiciSimulationsAggregated(
+      solver, edatas, model, failfast, num_threads, failures_only);
+#else
+    return defaultContext.runAmiciSimulationsAggregated(
+      solver, edatas, model, failfast, 1, failures_only);
+#endif
+}
+
+ThreadUtilization
+getThreadUtilization()
+{
+    return defaultContext.getThreadUtilization();
+}
+
 std::unique_ptr<ReturnData>
 AmiciApplication::runAmiciSimulation(Solver& solver,
                                      const ExpData* edata,
                                      Model& model,
                                      bool rethrow)
+{
+    return runAmiciSimulation(solver, edata, model, rethrow, nullptr);
+}
+
+std::unique_ptr<ReturnData>
+AmiciApplication::runAmiciSimulation(Solver& solver,
+                                     const ExpData* edata,
+                                     Model& model,
+                                     bool rethrow,
+                                     PreequilibrationCache* preeq_cache)
 {
     solver.startTimer();
 
@@ -124,14 +246,26 @@ AmiciApplication::runAmiciSimulation(Solver& solver,
     bool bwd_success = true;
 
     try {
+        if (edata && model.hasInnerParameters())
+            rdata->checkInnerParameters(model, *edata);
+
         if (solver.getPreequilibration() ||
             (edata && !edata->fixedParametersPreequilibration.empty())) {
             ConditionContext cc2(
                 &model, edata, FixedParameterContext::preequilibration
             );
 
-            preeq = std::make_unique<SteadystateProblem>(solver, model);
-            preeq->workSteadyStateProblem(&solver, &model, -1);
+            auto preequilibrate = [&solver, &model]() {
+                auto preeq = std::make_unique<SteadystateProblem>(solver,
+                                                                  model);
+                preeq->workSteadyStateProblem(&solver, &model, -1);
+                return preeq;
+            };
+            if (preeq_cache)
+                preeq = preeq_cache->getPreequilibration(solver, model,
+                                                         preequilibrate);
+            else
+                preeq = preequilibrate();
         }
 
 
@@ -242,40 +376,221 @@ AmiciApplication::runAmiciSimulations(const Solver& solver,
                                       const std::vector<ExpData*>& edatas,
                                       const Model& model,
                                       bool failfast,
-#if defined(_OPENMP)
-                                      int num_threads
-#else
-                                      int /* num_threads */
-#endif
-
-)
+                                      int num_threads)
 {
     std::vector<std::unique_ptr<ReturnData>> results(edatas.size());
+    runAmiciSimulations(
+      solver, edatas, model, failfast, num_threads,
+      [&results](int i, int /* thread */, std::unique_ptr<ReturnData> rdata) {
+          results[i] = std::move(rdata);
+      });
+    return results;
+}
+
+AggregatedReturnData
+AmiciApplication::runAmiciSimulationsAggregated(
+  const Solver& solver,
+  const std::vector<ExpData*>& edatas,
+  const Model& model,
+  bool failfast,
+  int num_threads,
+  bool failures_only)
+{
+    auto const num_conditions = static_cast<int>(edatas.size());
+    /* the sums over conditions are only defined for a common parameter
+     * list and scaling */
+    for (int i = 0; i < num_conditions; ++i) {
+        if (!edatas[i])
+            continue;
+        if (!edatas[i]->plist.empty()
+            && edatas[i]->plist != model.getParameterList())
+            throw AmiException("Condition %d has a parameter list different "
+                               "from the model's, which is not supported "
+                               "for aggregated results.", i);
+        if (!edatas[i]->pscale.empty()
+            && edatas[i]->pscale != model.getParameterScale())
+            throw AmiException("Condition %d has a parameter scaling "
+                               "different from the model's, which is not "
+                               "supported for aggregated results.", i);
+    }
+
+    std::vector<int> status(edatas.size(), AMICI_SUCCESS);
+    // one accumulator per thread, so that no synchronization is required
+    std::vector<AggregatedReturnData> partials(maxThreads(num_threads));
+
+    runAmiciSimulations(
+      solver, edatas, model, failfast, num_threads,
+      [&status, &partials](
+        int i, int thread, std::unique_ptr<ReturnData> rdata) {
+          status[i] = rdata->status;
+          auto& partial = partials[thread];
+          partial.llh += rdata->llh;
+          partial.chi2 += rdata->chi2;
+          if (partial.sllh.size() < rdata->sllh.size())
+              partial.sllh.resize(rdata->sllh.size(), 0.0);
+          std::transform(rdata->sllh.begin(), rdata->sllh.end(),
+                         partial.sllh.begin(), partial.sllh.begin(),
+                         std::plus<realtype>());
+          if (partial.FIM.size() < rdata->FIM.size())
+              partial.FIM.resize(rdata->FIM.size(), 0.0);
+          std::transform(rdata->FIM.begin(), rdata->FIM.end(),
+                         partial.FIM.begin(), partial.FIM.begin(),
+                         std::plus<realtype>());
+      });
+
+    AggregatedReturnData result;
+    result.nplist = static_cast<int>(solver.getSensitivityOrder() >=
+                                             SensitivityOrder::first
+                                         ? model.nplist()
+                                         : 0);
+    for (auto const& partial : partials) {
+        result.llh += partial.llh;
+        result.chi2 += partial.chi2;
+        if (result.sllh.size() < partial.sllh.size())
+            result.sllh.resize(partial.sllh.size(), 0.0);
+        std::transform(partial.sllh.begin(), partial.sllh.end(),
+                       result.sllh.begin(), result.sllh.begin(),
+                       std::plus<realtype>());
+        if (result.FIM.size() < partial.FIM.size())
+            result.FIM.resize(partial.FIM.size(), 0.0);
+        std::transform(partial.FIM.begin(), partial.FIM.end(),
+                       result.FIM.begin(), result.FIM.begin(),
+                       std::plus<realtype>());
+    }
+
+    for (int i = 0; i < num_conditions; ++i) {
+        if (status[i] != AMICI_SUCCESS) {
+            result.failed_conditions.push_back(i);
+            result.failed_status.push_back(status[i]);
+        }
+    }
+    if (!failures_only)
+        result.status = std::move(status);
+
+    return result;
+}
+
+void
+AmiciApplication::runAmiciSimulations(
+  const Solver& solver,
+  const std::vector<ExpData*>& edatas,
+  const Model& model,
+  bool failfast,
+  int num_threads,
+  std::function<void(int, int, std::unique_ptr<ReturnData>)> const& process)
+{
+    auto const num_conditions = static_cast<int>(edatas.size());
     // is set to true if one simulation fails and we should skip the rest.
     // shared across threads.
     bool skipThrough = false;
+    // whether condition i was actually simulated
+    std::vector<char> simulated(edatas.size(), false);
+
+    /* longest processing time first: order conditions by decreasing cost as
+     * recorded in previous calls. Conditions for which we do not have any
+     * cost estimate yet are started first. */
+    std::vector<std::string> keys(edatas.size());
+    std::vector<double> costs(edatas.size());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int i = 0; i < num_conditions; ++i) {
+            keys[i] = conditionCostKey(edatas[i]);
+            auto cost = simulation_costs_.find(keys[i]);
+            costs[i] = cost == simulation_costs_.end()
+                           ? std::numeric_limits<double>::infinity()
+                           : cost->second;
+        }
+    }
+    std::vector<int> order(edatas.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&costs](int a, int b) {
+        return costs[a] > costs[b];
+    });
+
+    auto const max_threads = maxThreads(num_threads);
+    /* one Model/Solver pair per thread, created on first use and reused for
+     * all conditions handled by that thread. Between conditions, the model
+     * state is reset from the template model and the solver memory is
+     * reinitialized (not reallocated) in Solver::setup. */
+    std::vector<std::unique_ptr<Solver>> solvers(max_threads);
+    std::vector<std::unique_ptr<Model>> models(max_threads);
+    PreequilibrationCache preeq_cache;
+
+    ThreadUtilization thread_utilization;
+    thread_utilization.num_simulations.assign(max_threads, 0);
+    thread_utilization.busy_time.assign(max_threads, 0.0);
+    thread_utilization.order = order;
+    auto const batch_start = std::chrono::steady_clock::now();
 
 #if defined(_OPENMP)
-#pragma omp parallel for num_threads(num_threads)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1)
 #endif
-    for (int i = 0; i < (int)edatas.size(); ++i) {
-        auto mySolver = std::unique_ptr<Solver>(solver.clone());
-        auto myModel = std::unique_ptr<Model>(model.clone());
+    for (int j = 0; j < num_conditions; ++j) {
+        auto const i = order[j];
+        auto const start = std::chrono::steady_clock::now();
+#if defined(_OPENMP)
+        auto const thread = omp_get_thread_num();
+#else
+        auto const thread = 0;
+#endif
+
+        auto &mySolver = solvers[thread];
+        auto &myModel = models[thread];
+        if (!mySolver) {
+            mySolver = std::unique_ptr<Solver>(solver.clone());
+            myModel = std::unique_ptr<Model>(model.clone());
+        } else {
+            mySolver->resetCpuTime();
+            myModel->setModelState(model.getModelState());
+        }
 
         /* if we fail we need to write empty return datas for the python
          interface */
+        std::unique_ptr<ReturnData> rdata;
         if (skipThrough) {
             ConditionContext conditionContext(myModel.get(), edatas[i]);
-            results[i] =
-              std::unique_ptr<ReturnData>(new ReturnData(solver, model));
+            rdata = std::unique_ptr<ReturnData>(new ReturnData(solver, model));
+            rdata->status = AMICI_NOT_RUN;
         } else {
-            results[i] = runAmiciSimulation(*mySolver, edatas[i], *myModel);
+            rdata = runAmiciSimulation(*mySolver, edatas[i], *myModel,
+                                       false, &preeq_cache);
+            costs[i] = simulationCost(*rdata);
+            simulated[i] = true;
         }
 
-        skipThrough |= failfast && results[i]->status < 0;
+        skipThrough |= failfast && rdata->status < 0;
+        process(i, thread, std::move(rdata));
+
+        ++thread_utilization.num_simulations[thread];
+        thread_utilization.busy_time[thread] +=
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
     }
 
-    return results;
+    thread_utilization.wall_time =
+        std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - batch_start).count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_utilization_ = std::move(thread_utilization);
+    for (int i = 0; i < num_conditions; ++i) {
+        if (simulated[i])
+            simulation_costs_[keys[i]] = costs[i];
+    }
+}
+
+ThreadUtilization
+AmiciApplication::getThreadUtilization() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return thread_utilization_;
+}
+
+void
+AmiciApplication::resetSimulationCosts()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    simulation_costs_.clear();
 }
 
 void
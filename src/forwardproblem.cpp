@@ -96,29 +96,43 @@ void ForwardProblem::workForwardProblem() {
     /* store initial state and sensitivity*/
     initial_state_ = getSimulationState();
 
-    /* loop over timepoints */
-    for (it_ = 0; it_ < model->nt(); it_++) {
-        auto nextTimepoint = model->getTimepoint(it_);
+    /* preallocate timepoint state history */
+    timepoint_x_.assign(model->nt() * model->nx_solver, 0.0);
+    timepoint_dx_.assign(model->nt() * model->nx_solver, 0.0);
+    if (solver->computingFSA())
+        timepoint_sx_.assign(model->nt() * sx_.data().size(), 0.0);
+    timepoint_model_state_idxs_.assign(model->nt(), -1);
 
-        if (std::isinf(nextTimepoint))
-            break;
+    initEventSchedule();
 
-        if (nextTimepoint > model->t0()) {
-            // Solve for nextTimepoint
-            while (t_ < nextTimepoint) {
-                int status = solver->run(nextTimepoint);
-                solver->writeSolution(&t_, x_, dx_, sx_, dx_);
-                /* sx will be copied from solver on demand if sensitivities
-                 are computed */
-                if (status == AMICI_ILL_INPUT) {
-                    /* clustering of roots => turn off rootfinding */
-                    solver->turnOffRootFinding();
-                } else if (status == AMICI_ROOT_RETURN) {
-                    handleEvent(&tlastroot_, false);
+    /* loop over timepoints */
+    if (solver->getInterpolatedOutput())
+        handleDataPointsInterpolated();
+    else {
+        for (it_ = 0; it_ < model->nt(); it_++) {
+            auto nextTimepoint = model->getTimepoint(it_);
+
+            if (std::isinf(nextTimepoint))
+                break;
+
+            if (nextTimepoint > model->t0()) {
+                // Solve for nextTimepoint
+                while (t_ < nextTimepoint) {
+                    int status = solver->run(getNextStopTime(nextTimepoint));
+                    solver->writeSolution(&t_, x_, dx_, sx_, dx_);
+                    /* sx will be copied from solver on demand if sensitivities
+                     are computed */
+                    if (status == AMICI_ILL_INPUT) {
+                        /* clustering of roots => turn off rootfinding */
+                        solver->turnOffRootFinding();
+                    } else if (status == AMICI_ROOT_RETURN) {
+                        handleEvent(&tlastroot_, false);
+                    }
+                    handleScheduledEvents();
                 }
             }
+            handleDataPoint(it_);
         }
-        handleDataPoint(it_);
     }
 
     /* fill events */
@@ -138,7 +152,105 @@ void ForwardProblem::handlePresimulation()
 }
 
 
-void ForwardProblem::handleEvent(realtype *tlastroot, const bool seflag) {
+void ForwardProblem::handleDataPointsInterpolated() {
+    /* the integrator is only stopped at the last output timepoint and at
+     * time-triggered events */
+    auto tfinal = t_;
+    for (int it = 0; it < model->nt(); it++)
+        if (std::isfinite(model->getTimepoint(it)))
+            tfinal = std::max(tfinal, model->getTimepoint(it));
+
+    int status = AMICI_SUCCESS;
+    it_ = 0;
+    while (true) {
+        /* outputs within the last step need to be interpolated before
+         * events reinitialize the solver */
+        auto tstep = t_;
+        auto interpolated = false;
+        while (it_ < model->nt() && model->getTimepoint(it_) < tstep) {
+            auto t = model->getTimepoint(it_);
+            if (t > model->t0()) {
+                t_ = t;
+                x_.copy(solver->getState(t));
+                dx_.copy(solver->getDerivativeState(t));
+                sx_.copy(solver->getStateSensitivity(t));
+                ++num_interpolated_outputs_;
+                interpolated = true;
+            }
+            handleDataPoint(it_++);
+        }
+        /* restore the solution at the end of the step */
+        if (interpolated)
+            solver->writeSolution(&t_, x_, dx_, sx_, dx_);
+
+        if (status == AMICI_ILL_INPUT) {
+            /* clustering of roots => turn off rootfinding */
+            solver->turnOffRootFinding();
+        } else if (status == AMICI_ROOT_RETURN) {
+            handleEvent(&tlastroot_, false);
+        }
+        handleScheduledEvents();
+
+        /* outputs at the end of the step, after events */
+        while (it_ < model->nt() && model->getTimepoint(it_) == t_)
+            handleDataPoint(it_++);
+
+        if (it_ == model->nt() || std::isinf(model->getTimepoint(it_)))
+            break;
+
+        status = solver->runOneStep(getNextStopTime(tfinal));
+        solver->writeSolution(&t_, x_, dx_, sx_, dx_);
+    }
+}
+
+void ForwardProblem::initEventSchedule() {
+    event_schedule_.clear();
+    next_scheduled_event_ = 0;
+
+    auto const &events = model->getTimeTriggeredEvents();
+    if (events.empty())
+        return;
+
+    auto trigger_times = model->getEventTriggerTimes();
+    model->froot(t_, x_, dx_, rootvals_);
+    for (std::vector<int>::size_type i = 0; i < events.size(); ++i) {
+        auto ie = events[i];
+        /* events at the initial time are covered by the initialization of
+         * the Heaviside variables */
+        if (!std::isfinite(trigger_times[i]) || trigger_times[i] <= t_)
+            continue;
+        event_schedule_.push_back(
+            {trigger_times[i], ie, rootvals_.at(ie) < 0 ? 1 : -1});
+    }
+    std::stable_sort(event_schedule_.begin(), event_schedule_.end(),
+                     [](ScheduledEvent const &a, ScheduledEvent const &b) {
+                         return a.t < b.t;
+                     });
+}
+
+realtype ForwardProblem::getNextStopTime(realtype tout) const {
+    if (next_scheduled_event_ < event_schedule_.size())
+        return std::min(tout, event_schedule_[next_scheduled_event_].t);
+    return tout;
+}
+
+void ForwardProblem::handleScheduledEvents() {
+    if (next_scheduled_event_ >= event_schedule_.size()
+        || t_ < event_schedule_[next_scheduled_event_].t)
+        return;
+
+    /* simultaneous events are fired together */
+    std::fill(roots_found_.begin(), roots_found_.end(), 0);
+    while (next_scheduled_event_ < event_schedule_.size()
+           && event_schedule_[next_scheduled_event_].t <= t_) {
+        auto const &event = event_schedule_[next_scheduled_event_++];
+        roots_found_.at(event.ie) = event.direction;
+    }
+    handleEvent(&tlastroot_, false, true);
+}
+
+void ForwardProblem::handleEvent(realtype *tlastroot, const bool seflag,
+                                 const bool scheduled) {
     /* store Heaviside information at event occurrence */
     model->froot(t_, x_, dx_, rootvals_);
 
@@ -146,14 +258,14 @@ void ForwardProblem::handleEvent(realtype *tlastroot, const bool seflag) {
     discs_.push_back(t_);
 
     /* extract and store which events occurred */
-    if (!seflag) {
+    if (!seflag && !scheduled) {
         solver->getRootInfo(roots_found_.data());
     }
     root_idx_.push_back(roots_found_);
 
     rval_tmp_ = rootvals_;
 
-    if (!seflag) {
+    if (!seflag && !scheduled) {
         /* only check this in the first event fired, otherwise this will always
          * be true */
         if (t_ == *tlastroot) {
@@ -198,6 +310,7 @@ void ForwardProblem::handleEvent(realtype *tlastroot, const bool seflag) {
     }
 
     model->updateHeaviside(roots_found_);
+    model_state_changed_ = true;
 
     applyEventBolus();
 
@@ -296,11 +409,26 @@ void ForwardProblem::storeEvent() {
     }
 }
 
-void ForwardProblem::handleDataPoint(int /*it*/) {
+void ForwardProblem::handleDataPoint(int it) {
     /* We only store the simulation state if it's not the initial state, as the
        initial state is stored anyway and we want to avoid storing it twice */
-    if (t_ != model->t0() && timepoint_states_.count(t_) == 0)
-        timepoint_states_[t_] = getSimulationState();
+    if (t_ != model->t0()) {
+        if (model_state_changed_) {
+            timepoint_model_states_.push_back(model->getModelState());
+            model_state_changed_ = false;
+        }
+        timepoint_model_state_idxs_.at(it) =
+            static_cast<int>(timepoint_model_states_.size()) - 1;
+
+        auto nx = model->nx_solver;
+        std::copy_n(x_.data(), nx, timepoint_x_.begin() + it * nx);
+        std::copy_n(dx_.data(), nx, timepoint_dx_.begin() + it * nx);
+        if (!timepoint_sx_.empty()) {
+            auto nsx = sx_.data().size();
+            std::copy(sx_.data().begin(), sx_.data().end(),
+                      timepoint_sx_.begin() + it * nsx);
+        }
+    }
     /* store diagnosis information for debugging */
     solver->storeDiagnosis();
 }
@@ -321,16 +449,50 @@ void ForwardProblem::applyEventSensiBolusFSA() {
 
 void ForwardProblem::getAdjointUpdates(Model &model,
                                        const ExpData &edata) {
+    SimulationState state;
     for (int it = 0; it < model.nt(); it++) {
         if (std::isinf(model.getTimepoint(it)))
             return;
+        getSimulationStateTimepoint(it, state);
         model.getAdjointStateObservableUpdate(
-            slice(dJydx_, it, model.nx_solver * model.nJ), it,
-            getSimulationStateTimepoint(it).x, edata
+            slice(dJydx_, it, model.nx_solver * model.nJ), it, state.x, edata
         );
     }
 }
 
+void ForwardProblem::getSimulationStateTimepoint(int it,
+                                                 SimulationState &state) const {
+    if (model->getTimepoint(it) == initial_state_.t) {
+        state = initial_state_;
+        return;
+    }
+
+    auto imodel_state = timepoint_model_state_idxs_.at(it);
+    if (imodel_state < 0)
+        throw AmiException("No simulation state available for timepoint "
+                           "index %d", it);
+
+    auto nx = model->nx_solver;
+    state.t = model->getTimepoint(it);
+    if (state.x.getLength() != nx)
+        state.x = AmiVector(nx);
+    std::copy_n(timepoint_x_.begin() + it * nx, nx, state.x.data());
+    if (state.dx.getLength() != nx)
+        state.dx = AmiVector(nx);
+    std::copy_n(timepoint_dx_.begin() + it * nx, nx, state.dx.data());
+    if (!timepoint_sx_.empty()) {
+        if (state.sx.getLength() != sx_.getLength()
+            || state.sx.data().size() != sx_.data().size())
+            state.sx = AmiVectorArray(nx, sx_.getLength());
+        auto nsx = sx_.data().size();
+        std::copy_n(timepoint_sx_.begin() + it * nsx, nsx,
+                    state.sx.data().begin());
+    } else {
+        state.sx = AmiVectorArray();
+    }
+    state.state = timepoint_model_states_.at(imodel_state);
+}
+
 SimulationState ForwardProblem::getSimulationState() const {
     auto state = SimulationState();
     state.t = t_;
@@ -24,11 +24,21 @@
 #endif
 #include <unistd.h>
 #include <cmath>
+#include <mutex>
 
 
 namespace amici {
 namespace hdf5 {
 
+/**
+ * @brief Serializes file access through the filename-based entry points.
+ *
+ * The HDF5 library is not guaranteed to be built thread-safe, but these
+ * functions may be called concurrently from Python threads, which do not hold
+ * the GIL during HDF5 I/O.
+ */
+static std::mutex hdf5_mutex;
+
 /**
  * @brief assertMeasurementDimensionsCompatible
  * @param m
@@ -106,6 +116,7 @@ void createGroup(H5::H5File const& file,
 std::unique_ptr<ExpData> readSimulationExpData(std::string const& hdf5Filename,
                                                std::string const& hdf5Root,
                                                Model const& model) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     H5::H5File file(hdf5Filename.c_str(), H5F_ACC_RDONLY);
 
     hsize_t m, n;
@@ -267,6 +278,10 @@ void writeReturnData(const ReturnData &rdata, H5::H5File const& file, const std:
     if (!rdata.sllh.empty())
         createAndWriteDouble1DDataset(file, hdf5Location + "/sllh", rdata.sllh);
 
+    if (!rdata.inner_parameters.empty())
+        createAndWriteDouble1DDataset(file, hdf5Location + "/inner_parameters",
+                                      rdata.inner_parameters);
+
     if (!rdata.res.empty())
         createAndWriteDouble1DDataset(file, hdf5Location + "/res", rdata.res);
     if (!rdata.sres.empty())
@@ -407,6 +422,20 @@ void writeReturnDataDiagnosis(const ReturnData &rdata,
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "preeq_numstepsB", &rdata.preeq_numstepsB, 1);
 
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "preeq_numjacevals", &rdata.preeq_numjacevals, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "preeq_numfactorizations",
+                          &rdata.preeq_numfactorizations, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "preeq_ptc_numsteps", &rdata.preeq_ptc_numsteps, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "preeq_ptc_numlinsolves",
+                          &rdata.preeq_ptc_numlinsolves, 1);
+
     H5LTset_attribute_double(file.getId(), hdf5Location.c_str(),
                              "preeq_cpu_time", &rdata.preeq_cpu_time, 1);
 
@@ -439,6 +468,20 @@ void writeReturnDataDiagnosis(const ReturnData &rdata,
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "posteq_numstepsB", &rdata.posteq_numstepsB, 1);
 
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "posteq_numjacevals", &rdata.posteq_numjacevals, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "posteq_numfactorizations",
+                          &rdata.posteq_numfactorizations, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "posteq_ptc_numsteps", &rdata.posteq_ptc_numsteps, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "posteq_ptc_numlinsolves",
+                          &rdata.posteq_ptc_numlinsolves, 1);
+
     H5LTset_attribute_double(file.getId(), hdf5Location.c_str(),
                              "posteq_cpu_time", &rdata.posteq_cpu_time, 1);
 
@@ -457,6 +500,17 @@ void writeReturnDataDiagnosis(const ReturnData &rdata,
     H5LTset_attribute_double(file.getId(), hdf5Location.c_str(),
                              "cpu_timeB", &rdata.cpu_timeB, 1);
 
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "numcheckpoints", &rdata.numcheckpoints, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "numrecomputedrhsevals",
+                          &rdata.numrecomputedrhsevals, 1);
+
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "numinterpolatedoutputs",
+                          &rdata.numinterpolatedoutputs, 1);
+
     if (!rdata.J.empty())
         createAndWriteDouble2DDataset(file, hdf5Location + "/J", rdata.J,
                                       rdata.nx, rdata.nx);
@@ -467,6 +521,7 @@ void writeReturnDataDiagnosis(const ReturnData &rdata,
 void writeReturnData(ReturnData const& rdata,
                      std::string const& hdf5Filename,
                      std::string const& hdf5Location) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     auto file = createOrOpenForWriting(hdf5Filename);
 
     writeReturnData(rdata, file, hdf5Location);
@@ -613,6 +668,7 @@ bool attributeExists(H5::H5Object const& object,
 void writeSolverSettingsToHDF5(Solver const& solver,
                               std::string const& hdf5Filename,
                               std::string const& hdf5Location) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     auto file = createOrOpenForWriting(hdf5Filename);
 
     writeSolverSettingsToHDF5(solver, file, hdf5Location);
@@ -687,6 +743,14 @@ void writeSolverSettingsToHDF5(Solver const& solver,
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "maxstepsB", &ibuffer, 1);
 
+    dbuffer = static_cast<double>(solver.getCheckpointMemoryBudget());
+    H5LTset_attribute_double(file.getId(), hdf5Location.c_str(),
+                             "checkpoint_memory_budget", &dbuffer, 1);
+
+    ibuffer = static_cast<int>(solver.getCheckpointSpill());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "checkpoint_spill", &ibuffer, 1);
+
     ibuffer = static_cast<int>(solver.getLinearMultistepMethod());
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "lmm", &ibuffer, 1);
@@ -699,6 +763,10 @@ void writeSolverSettingsToHDF5(Solver const& solver,
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "stldet", &ibuffer, 1);
 
+    ibuffer = static_cast<int>(solver.getInterpolatedOutput());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "interpolated_output", &ibuffer, 1);
+
     ibuffer = static_cast<int>(solver.getStateOrdering());
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "ordering", &ibuffer, 1);
@@ -735,14 +803,35 @@ void writeSolverSettingsToHDF5(Solver const& solver,
     H5LTset_attribute_double(file.getId(), hdf5Location.c_str(),
                              "newton_damping_factor_lower_bound", &dbuffer, 1);
 
+    ibuffer = static_cast<int>(solver.getNewtonJacobianReuse());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "newton_jacobian_reuse", &ibuffer, 1);
+
+    ibuffer = static_cast<int>(
+        solver.getSteadyStatePseudoTransientContinuation());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "steady_state_ptc", &ibuffer, 1);
+
+    ibuffer = static_cast<int>(solver.getSteadyStateConcurrentSearch());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "steady_state_concurrent_search", &ibuffer, 1);
+
     ibuffer = static_cast<int>(solver.getNewtonMaxLinearSteps());
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "newton_maxlinsteps", &ibuffer, 1);
 
+    ibuffer = static_cast<int>(solver.getSteadyStateWarmStartMode());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "steady_state_warm_start_mode", &ibuffer, 1);
+
     ibuffer = static_cast<int>(solver.getLinearSolver());
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "linsol", &ibuffer, 1);
 
+    ibuffer = static_cast<int>(solver.getPreconditionerType());
+    H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
+                          "preconditioner", &ibuffer, 1);
+
     ibuffer = static_cast<int>(solver.getInternalSensitivityMethod());
     H5LTset_attribute_int(file.getId(), hdf5Location.c_str(),
                           "ism", &ibuffer, 1);
@@ -833,6 +922,17 @@ void readSolverSettingsFromHDF5(H5::H5File const& file, Solver &solver,
                     getIntScalarAttribute(file, datasetPath, "maxstepsB"));
     }
 
+    if(attributeExists(file, datasetPath, "checkpoint_memory_budget")) {
+        solver.setCheckpointMemoryBudget(static_cast<long int>(
+            getDoubleScalarAttribute(file, datasetPath,
+                                     "checkpoint_memory_budget")));
+    }
+
+    if(attributeExists(file, datasetPath, "checkpoint_spill")) {
+        solver.setCheckpointSpill(
+            getIntScalarAttribute(file, datasetPath, "checkpoint_spill"));
+    }
+
     if(attributeExists(file, datasetPath, "lmm")) {
         solver.setLinearMultistepMethod(
                     static_cast<LinearMultistepMethod>(
@@ -850,6 +950,12 @@ void readSolverSettingsFromHDF5(H5::H5File const& file, Solver &solver,
                     getIntScalarAttribute(file, datasetPath, "stldet"));
     }
 
+    if(attributeExists(file, datasetPath, "interpolated_output")) {
+        solver.setInterpolatedOutput(
+                    getIntScalarAttribute(file, datasetPath,
+                                          "interpolated_output"));
+    }
+
     if(attributeExists(file, datasetPath, "ordering")) {
         solver.setStateOrdering(
                     getIntScalarAttribute(file, datasetPath, "ordering"));
@@ -901,18 +1007,48 @@ void readSolverSettingsFromHDF5(H5::H5File const& file, Solver &solver,
                     getDoubleScalarAttribute(file, datasetPath, "newton_damping_factor_lower_bound"));
     }
 
+    if(attributeExists(file, datasetPath, "newton_jacobian_reuse")) {
+        solver.setNewtonJacobianReuse(
+                    getIntScalarAttribute(file, datasetPath, "newton_jacobian_reuse"));
+    }
+
+    if(attributeExists(file, datasetPath, "steady_state_ptc")) {
+        solver.setSteadyStatePseudoTransientContinuation(
+                    getIntScalarAttribute(file, datasetPath, "steady_state_ptc"));
+    }
+
+    if(attributeExists(file, datasetPath, "steady_state_concurrent_search")) {
+        solver.setSteadyStateConcurrentSearch(
+                    getIntScalarAttribute(file, datasetPath,
+                                          "steady_state_concurrent_search"));
+    }
+
     if(attributeExists(file, datasetPath, "newton_maxlinsteps")) {
         solver.setNewtonMaxLinearSteps(
                     getIntScalarAttribute(file, datasetPath,
                                           "newton_maxlinsteps"));
     }
 
+    if(attributeExists(file, datasetPath, "steady_state_warm_start_mode")) {
+        solver.setSteadyStateWarmStartMode(
+                    static_cast<SteadyStateWarmStartMode>(
+                        getIntScalarAttribute(file, datasetPath,
+                                              "steady_state_warm_start_mode")));
+    }
+
     if(attributeExists(file, datasetPath, "linsol")) {
         solver.setLinearSolver(
                     static_cast<LinearSolver>(
                         getIntScalarAttribute(file, datasetPath, "linsol")));
     }
 
+    if(attributeExists(file, datasetPath, "preconditioner")) {
+        solver.setPreconditionerType(
+                    static_cast<PreconditionerType>(
+                        getIntScalarAttribute(file, datasetPath,
+                                              "preconditioner")));
+    }
+
     if(attributeExists(file, datasetPath, "ism")) {
         solver.setInternalSensitivityMethod(
                     static_cast<InternalSensitivityMethod>(
@@ -928,6 +1064,7 @@ void readSolverSettingsFromHDF5(H5::H5File const& file, Solver &solver,
 
 void readSolverSettingsFromHDF5(const std::string &hdffile, Solver &solver,
                                 const std::string &datasetPath) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     H5::H5File file(hdffile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
 
     readSolverSettingsFromHDF5(file, solver, datasetPath);
@@ -935,6 +1072,7 @@ void readSolverSettingsFromHDF5(const std::string &hdffile, Solver &solver,
 
 void readModelDataFromHDF5(const std::string &hdffile, Model &model,
                            const std::string &datasetPath) {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     H5::H5File file(hdffile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
 
     readModelDataFromHDF5(file, model, datasetPath);
@@ -1045,6 +1183,7 @@ bool locationExists(const H5::H5File &file, const std::string &location)
 
 bool locationExists(const std::string &filename, const std::string &location)
 {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
     H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
     return locationExists(file, location);
 }
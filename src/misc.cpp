@@ -22,7 +22,11 @@
 namespace amici {
 
 void writeSlice(const AmiVector &s, gsl::span<realtype> b) {
-    writeSlice(s.getVector(), b);
+    writeSlice(gsl::make_span(s.data(), s.getLength()), b);
+};
+
+void writeSlice(const AmiVectorArray &s, gsl::span<realtype> b) {
+    writeSlice(s.data(), b);
 };
 
 double getUnscaledParameter(double scaledParameter, ParameterScaling scaling)
@@ -95,20 +95,41 @@ static int setValueByIdRegex(std::vector<std::string> const &ids,
     }
 }
 
+/**
+ * @brief local helper function to collect pointers to matrices
+ * @param mats matrices
+ * @return pointers to the elements of mats
+ */
+static std::vector<const SUNMatrixWrapper *>
+pointers(std::vector<SUNMatrixWrapper> const &mats) {
+    std::vector<const SUNMatrixWrapper *> ptrs;
+    ptrs.reserve(mats.size());
+    for (auto const &mat : mats)
+        ptrs.push_back(&mat);
+    return ptrs;
+}
+
 Model::Model(ModelDimensions const & model_dimensions,
              SimulationParameters simulation_parameters,
              SecondOrderMode o2mode, std::vector<realtype> idlist, std::vector<int> z2event,
              const bool pythonGenerated, const int ndxdotdp_explicit,
-             const int ndxdotdx_explicit, const int w_recursion_depth)
+             const int ndxdotdx_explicit, const int w_recursion_depth,
+             std::vector<int> time_triggered_events,
+             std::vector<std::vector<int>> state_sensitivity_structure)
     : ModelDimensions(model_dimensions), pythonGenerated(pythonGenerated),
       o2mode(o2mode), idlist(std::move(idlist)),
       derived_state_(model_dimensions),
       z2event_(std::move(z2event)),
+      time_triggered_events_(std::move(time_triggered_events)),
+      state_sensitivity_structure_(std::move(state_sensitivity_structure)),
       state_is_non_negative_(nx_solver, false),
       w_recursion_depth_(w_recursion_depth),
       simulation_parameters_(std::move(simulation_parameters)) {
     Expects(model_dimensions.np == static_cast<int>(simulation_parameters_.parameters.size()));
     Expects(model_dimensions.nk == static_cast<int>(simulation_parameters_.fixedParameters.size()));
+    Expects(state_sensitivity_structure_.empty()
+            || model_dimensions.np
+                   == static_cast<int>(state_sensitivity_structure_.size()));
 
     simulation_parameters.pscale = std::vector<ParameterScaling>(model_dimensions.np, ParameterScaling::none);
 
@@ -121,6 +142,10 @@ Model::Model(ModelDimensions const & model_dimensions,
     state_.fixedParameters = simulation_parameters_.fixedParameters;
     state_.plist = simulation_parameters_.plist;
 
+    inner_scaling_idxs_.assign(nytrue, -1);
+    inner_offset_idxs_.assign(nytrue, -1);
+    inner_sigma_idxs_.assign(nytrue, -1);
+
     /* If Matlab wrapped: dxdotdp is a full AmiVector,
        if Python wrapped: dxdotdp_explicit and dxdotdp_implicit are CSC matrices
      */
@@ -139,6 +164,8 @@ Model::Model(ModelDimensions const & model_dimensions,
             dwdx_hierarchical_.emplace_back(
                 SUNMatrixWrapper(nw, nx_solver, irec * ndwdw + ndwdx, CSC_MAT));
         }
+        dwdp_multiply_patterns_.resize(w_recursion_depth_);
+        dwdx_multiply_patterns_.resize(w_recursion_depth_);
         assert(static_cast<int>(dwdp_hierarchical_.size()) ==
                w_recursion_depth_ + 1);
         assert(static_cast<int>(dwdx_hierarchical_.size()) ==
@@ -178,6 +205,9 @@ bool operator==(const Model &a, const Model &b) {
             == static_cast<ModelDimensions const&>(b))
             && (a.o2mode == b.o2mode) &&
            (a.z2event_ == b.z2event_) && (a.idlist == b.idlist) &&
+           (a.time_triggered_events_ == b.time_triggered_events_) &&
+           (a.state_sensitivity_structure_
+            == b.state_sensitivity_structure_) &&
            (a.state_.h == b.state_.h) &&
            (a.state_.unscaledParameters == b.state_.unscaledParameters) &&
            (a.simulation_parameters_ == b.simulation_parameters_) &&
@@ -187,7 +217,10 @@ bool operator==(const Model &a, const Model &b) {
            (a.nmaxevent_ == b.nmaxevent_) &&
            (a.state_is_non_negative_ == b.state_is_non_negative_) &&
            (a.sigma_res_ == b.sigma_res_) &&
-           (a.min_sigma_ == b.min_sigma_);
+           (a.min_sigma_ == b.min_sigma_) &&
+           (a.inner_scaling_idxs_ == b.inner_scaling_idxs_) &&
+           (a.inner_offset_idxs_ == b.inner_offset_idxs_) &&
+           (a.inner_sigma_idxs_ == b.inner_sigma_idxs_);
 }
 
 bool operator==(const ModelDimensions &a, const ModelDimensions &b) {
@@ -277,6 +310,35 @@ void Model::initHeaviside(AmiVector const &x, AmiVector const &dx) {
     }
 }
 
+std::vector<int> const &Model::getTimeTriggeredEvents() const {
+    return time_triggered_events_;
+}
+
+std::vector<std::vector<int>> const &
+Model::getStateSensitivityStructure() const {
+    return state_sensitivity_structure_;
+}
+
+std::vector<int> Model::getNonzeroStateSensitivityIndices() const {
+    std::vector<int> idxs;
+    idxs.reserve(nplist());
+    for (int ip = 0; ip < nplist(); ++ip) {
+        if (state_sensitivity_structure_.empty()
+            || hasCustomInitialStateSensitivities()
+            || !state_sensitivity_structure_.at(plist(ip)).empty())
+            idxs.push_back(ip);
+    }
+    return idxs;
+}
+
+std::vector<realtype> Model::getEventTriggerTimes() {
+    std::vector<realtype> trigger_times(time_triggered_events_.size(), 0.0);
+    if (!trigger_times.empty())
+        ftrigger_times(trigger_times.data(), state_.unscaledParameters.data(),
+                       state_.fixedParameters.data());
+    return trigger_times;
+}
+
 int Model::nplist() const { return static_cast<int>(state_.plist.size()); }
 
 int Model::np() const { return static_cast<int>(static_cast<ModelDimensions const&>(*this).np); }
@@ -636,6 +698,60 @@ void Model::setAllStatesNonNegative() {
     setStateIsNonNegative(std::vector<bool>(nx_solver, true));
 }
 
+/**
+ * @brief Check indices of inner parameters
+ * @param idxs parameter index per observable, -1 if none
+ * @param nytrue number of observables
+ * @param np number of parameters
+ */
+static void checkInnerParameterIndices(std::vector<int> const &idxs,
+                                       int nytrue, int np) {
+    if (static_cast<int>(idxs.size()) != nytrue)
+        throw AmiException("Dimension of inner parameter indices (%d) does "
+                           "not agree with number of observables (%d)",
+                           static_cast<int>(idxs.size()), nytrue);
+    for (auto idx : idxs)
+        if (idx < -1 || idx >= np)
+            throw AmiException("Invalid inner parameter index %d", idx);
+}
+
+void Model::setInnerScalingParameters(std::vector<int> const &idxs) {
+    checkInnerParameterIndices(idxs, nytrue, np());
+    inner_scaling_idxs_ = idxs;
+}
+
+std::vector<int> const &Model::getInnerScalingParameters() const {
+    return inner_scaling_idxs_;
+}
+
+void Model::setInnerOffsetParameters(std::vector<int> const &idxs) {
+    checkInnerParameterIndices(idxs, nytrue, np());
+    inner_offset_idxs_ = idxs;
+}
+
+std::vector<int> const &Model::getInnerOffsetParameters() const {
+    return inner_offset_idxs_;
+}
+
+void Model::setInnerSigmaParameters(std::vector<int> const &idxs) {
+    checkInnerParameterIndices(idxs, nytrue, np());
+    inner_sigma_idxs_ = idxs;
+}
+
+std::vector<int> const &Model::getInnerSigmaParameters() const {
+    return inner_sigma_idxs_;
+}
+
+bool Model::hasInnerParameters() const {
+    auto is_set = [](int idx) { return idx >= 0; };
+    return std::any_of(inner_scaling_idxs_.begin(), inner_scaling_idxs_.end(),
+                       is_set)
+           || std::any_of(inner_offset_idxs_.begin(), inner_offset_idxs_.end(),
+                          is_set)
+           || std::any_of(inner_sigma_idxs_.begin(), inner_sigma_idxs_.end(),
+                          is_set);
+}
+
 const std::vector<int> &Model::getParameterList() const { return state_.plist; }
 
 int Model::plist(int pos) const { return state_.plist.at(pos); }
@@ -822,9 +938,6 @@ void Model::getObservableSensitivity(gsl::span<realtype> sy, const realtype t,
     fdydx(t, x);
     fdydp(t, x);
 
-    derived_state_.sx_.resize(nx_solver * nplist());
-    sx.flatten_to_vector(derived_state_.sx_);
-
     // compute sy = 1.0*dydx*sx + 1.0*sy
     // dydx A[ny,nx_solver] * sx B[nx_solver,nplist] = sy C[ny,nplist]
     //        M  K                 K  N                     M  N
@@ -832,7 +945,7 @@ void Model::getObservableSensitivity(gsl::span<realtype> sy, const realtype t,
     amici_dgemm(BLASLayout::colMajor, BLASTranspose::noTrans,
                 BLASTranspose::noTrans, ny, nplist(), nx_solver, 1.0,
                 derived_state_.dydx_.data(), ny,
-                derived_state_.sx_.data(), nx_solver, 1.0,
+                sx.data().data(), nx_solver, 1.0,
                 derived_state_.dydp_.data(),
                 ny);
 
@@ -907,14 +1020,12 @@ void Model::addObservableObjectiveSensitivity(std::vector<realtype> &sllh,
     // Compute dJydx*sx for current 'it'
     // dJydx        rdata->nt x nJ        x nx_solver
     // sx           rdata->nt x nx_solver x nplist()
-    derived_state_.sx_.resize(nx_solver * nplist());
-    sx.flatten_to_vector(derived_state_.sx_);
 
     // C := alpha*op(A)*op(B) + beta*C,
     amici_dgemm(BLASLayout::colMajor, BLASTranspose::noTrans,
                 BLASTranspose::noTrans, nJ, nplist(), nx_solver, 1.0,
                 derived_state_.dJydx_.data(), nJ,
-                derived_state_.sx_.data(), nx_solver, 1.0,
+                sx.data().data(), nx_solver, 1.0,
                 derived_state_.dJydp_.data(),
                 nJ);
 
@@ -1056,13 +1167,12 @@ void Model::addEventObjectiveSensitivity(std::vector<realtype> &sllh,
     // Compute dJzdx*sx for current 'ie'
     // dJzdx        rdata->nt x nJ        x nx_solver
     // sx           rdata->nt x nx_solver x nplist()
-    sx.flatten_to_vector(derived_state_.sx_);
 
     // C := alpha*op(A)*op(B) + beta*C,
     amici_dgemm(BLASLayout::colMajor, BLASTranspose::noTrans,
                 BLASTranspose::noTrans, nJ, nplist(), nx_solver, 1.0,
                 derived_state_.dJzdx_.data(), nJ,
-                derived_state_.sx_.data(), nx_solver, 1.0,
+                sx.data().data(), nx_solver, 1.0,
                 derived_state_.dJzdp_.data(),
                 nJ);
 
@@ -2096,10 +2206,24 @@ void Model::fdwdp(const realtype t, const realtype *x) {
 
         for (int irecursion = 1; irecursion <= w_recursion_depth_;
              irecursion++) {
+            auto &pattern = dwdp_multiply_patterns_.at(irecursion - 1);
+            if (!pattern)
+                pattern = sparse_patterns_->get(
+                    "dwdp_multiply_" + std::to_string(irecursion), [&]() {
+                        return dwdw_.sparse_multiply_pattern(
+                            dwdp_hierarchical_.at(irecursion - 1));
+                    });
             dwdw_.sparse_multiply(dwdp_hierarchical_.at(irecursion),
-                                  dwdp_hierarchical_.at(irecursion - 1));
+                                  dwdp_hierarchical_.at(irecursion - 1),
+                                  *pattern);
         }
-        derived_state_.dwdp_.sparse_sum(dwdp_hierarchical_);
+        if (!dwdp_sum_pattern_)
+            dwdp_sum_pattern_ = sparse_patterns_->get("dwdp_sum", [&]() {
+                return SUNMatrixWrapper::sparse_sum_pattern(
+                    pointers(dwdp_hierarchical_));
+            });
+        derived_state_.dwdp_.sparse_sum(dwdp_hierarchical_,
+                                        *dwdp_sum_pattern_);
 
     } else {
         if (!derived_state_.dwdp_.capacity())
@@ -2136,10 +2260,24 @@ void Model::fdwdx(const realtype t, const realtype *x) {
 
         for (int irecursion = 1; irecursion <= w_recursion_depth_;
              irecursion++) {
+            auto &pattern = dwdx_multiply_patterns_.at(irecursion - 1);
+            if (!pattern)
+                pattern = sparse_patterns_->get(
+                    "dwdx_multiply_" + std::to_string(irecursion), [&]() {
+                        return dwdw_.sparse_multiply_pattern(
+                            dwdx_hierarchical_.at(irecursion - 1));
+                    });
             dwdw_.sparse_multiply(dwdx_hierarchical_.at(irecursion),
-                                  dwdx_hierarchical_.at(irecursion - 1));
+                                  dwdx_hierarchical_.at(irecursion - 1),
+                                  *pattern);
         }
-        derived_state_.dwdx_.sparse_sum(dwdx_hierarchical_);
+        if (!dwdx_sum_pattern_)
+            dwdx_sum_pattern_ = sparse_patterns_->get("dwdx_sum", [&]() {
+                return SUNMatrixWrapper::sparse_sum_pattern(
+                    pointers(dwdx_hierarchical_));
+            });
+        derived_state_.dwdx_.sparse_sum(dwdx_hierarchical_,
+                                        *dwdx_sum_pattern_);
 
     } else {
         if (!derived_state_.dwdx_.capacity())
@@ -65,6 +65,7 @@ TPL_SX0_FIXEDPARAMETERS_DEF
 TPL_XDOT_DEF
 TPL_Y_DEF
 TPL_STAU_DEF
+TPL_TRIGGER_TIMES_DEF
 TPL_DELTAX_DEF
 TPL_DELTASX_DEF
 TPL_X_RDATA_DEF
@@ -128,7 +129,10 @@ class Model_TPL_MODELNAME : public amici::Model_ODE {
               true,                                        // pythonGenerated
               TPL_NDXDOTDP_EXPLICIT,                       // ndxdotdp_explicit
               TPL_NDXDOTDX_EXPLICIT,                       // ndxdotdx_explicit
-              TPL_W_RECURSION_DEPTH                        // w_recursion_depth
+              TPL_W_RECURSION_DEPTH,                       // w_recursion_depth
+              std::vector<int>{TPL_TIME_TRIGGERED_EVENTS}, // time_triggered_events
+              std::vector<std::vector<int>>{
+                  TPL_STATE_SENSITIVITY_STRUCTURE} // state_sensitivity_structure
           ) {}
 
     /**
@@ -430,6 +434,7 @@ class Model_TPL_MODELNAME : public amici::Model_ODE {
               const int ip) override {}
 
     TPL_STAU_IMPL
+    TPL_TRIGGER_TIMES_IMPL
     TPL_SX0_IMPL
     TPL_SX0_FIXEDPARAMETERS_IMPL
 
@@ -45,11 +45,24 @@ void Model_ODE::fJSparse(realtype t, const_N_Vector x, SUNMatrix J) {
         fdxdotdw(t, x_pos);
         /* Sparse matrix multiplication
          dxdotdx_implicit += dxdotdw * dwdx */
+        if (!dxdotdx_implicit_pattern_)
+            dxdotdx_implicit_pattern_ =
+                sparse_patterns_->get("dxdotdx_implicit", [&]() {
+                    return derived_state_.dxdotdw_.sparse_multiply_pattern(
+                        derived_state_.dwdx_);
+                });
         derived_state_.dxdotdw_.sparse_multiply(derived_state_.dxdotdx_implicit,
-                                                derived_state_.dwdx_);
-
+                                                derived_state_.dwdx_,
+                                                *dxdotdx_implicit_pattern_);
+
+        if (!J_pattern_)
+            J_pattern_ = sparse_patterns_->get("J", [&]() {
+                return SUNMatrixWrapper::sparse_sum_pattern(
+                    {&derived_state_.dxdotdx_explicit,
+                     &derived_state_.dxdotdx_implicit});
+            });
         JSparse.sparse_add(derived_state_.dxdotdx_explicit, 1.0,
-                           derived_state_.dxdotdx_implicit, 1.0);
+                           derived_state_.dxdotdx_implicit, 1.0, *J_pattern_);
     } else {
         fJSparse(static_cast<SUNMatrixContent_Sparse>(SM_CONTENT_S(J)), t,
                  N_VGetArrayPointerConst(x_pos),
@@ -67,10 +80,18 @@ void Model_ODE::fJv(const realtype t, const AmiVector &x,
 }
 
 void Model_ODE::fJv(const_N_Vector v, N_Vector Jv, realtype t, const_N_Vector x) {
+    fJvSetup(t, x);
+    fJv(v, Jv);
+}
+
+void Model_ODE::fJvSetup(realtype t, const_N_Vector x) {
+    fJSparse(t, x, derived_state_.Jv_.get());
+    derived_state_.Jv_.refresh();
+}
+
+void Model_ODE::fJv(const_N_Vector v, N_Vector Jv) {
     N_VConst(0.0, Jv);
-    fJSparse(t, x, derived_state_.J_.get());
-    derived_state_.J_.refresh();
-    derived_state_.J_.multiply(Jv, v);
+    derived_state_.Jv_.multiply(Jv, v);
 }
 
 void Model_ODE::froot(const realtype t, const AmiVector &x,
@@ -105,7 +126,7 @@ void Model_ODE::fJDiag(const realtype t, AmiVector &JDiag,
                        const realtype /*cj*/, const AmiVector &x,
                        const AmiVector & /*dx*/) {
     fJDiag(t, JDiag.getNVector(), x.getNVector());
-    if (checkFinite(JDiag.getVector(), "Jacobian") != AMICI_SUCCESS)
+    if (checkFinite(gsl::make_span(JDiag.getNVector()), "Jacobian") != AMICI_SUCCESS)
         throw AmiException("Evaluation of fJDiag failed!");
 }
 
@@ -143,12 +164,27 @@ void Model_ODE::fdxdotdp(const realtype t, const_N_Vector x) {
         fdxdotdw(t, x_pos);
         /* Sparse matrix multiplication
          dxdotdp_implicit += dxdotdw * dwdp */
+        if (!dxdotdp_implicit_pattern_)
+            dxdotdp_implicit_pattern_ =
+                sparse_patterns_->get("dxdotdp_implicit", [&]() {
+                    return derived_state_.dxdotdw_.sparse_multiply_pattern(
+                        derived_state_.dwdp_);
+                });
         derived_state_.dxdotdw_.sparse_multiply(derived_state_.dxdotdp_implicit,
-                                                derived_state_.dwdp_);
-
+                                                derived_state_.dwdp_,
+                                                *dxdotdp_implicit_pattern_);
+
+        if (!dxdotdp_full_pattern_)
+            dxdotdp_full_pattern_ =
+                sparse_patterns_->get("dxdotdp_full", [&]() {
+                    return SUNMatrixWrapper::sparse_sum_pattern(
+                        {&derived_state_.dxdotdp_explicit,
+                         &derived_state_.dxdotdp_implicit});
+                });
         derived_state_.dxdotdp_full.sparse_add(
                     derived_state_.dxdotdp_explicit, 1.0,
-                    derived_state_.dxdotdp_implicit, 1.0);
+                    derived_state_.dxdotdp_implicit, 1.0,
+                    *dxdotdp_full_pattern_);
     } else {
         // matlab generated
         for (int ip = 0; ip < nplist(); ip++) {
@@ -322,10 +358,18 @@ void Model_ODE::fJDiag(realtype t, N_Vector JDiag, const_N_Vector x) {
 
 void Model_ODE::fJvB(const_N_Vector vB, N_Vector JvB, realtype t, const_N_Vector x,
                      const_N_Vector xB) {
+    fJvSetupB(t, x, xB);
+    fJvB(vB, JvB);
+}
+
+void Model_ODE::fJvSetupB(realtype t, const_N_Vector x, const_N_Vector xB) {
+    fJSparseB(t, x, xB, nullptr, derived_state_.JvB_.get());
+    derived_state_.JvB_.refresh();
+}
+
+void Model_ODE::fJvB(const_N_Vector vB, N_Vector JvB) {
     N_VConst(0.0, JvB);
-    fJSparseB(t, x, xB, nullptr, derived_state_.JB_.get());
-    derived_state_.JB_.refresh();
-    derived_state_.JB_.multiply(JvB, vB);
+    derived_state_.JvB_.multiply(JvB, vB);
 }
 
 void Model_ODE::fxBdot(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot) {
@@ -403,15 +447,16 @@ void Model_ODE::fsxdot(const realtype t, const AmiVector &x,
                        const AmiVector & /*dx*/, const int ip,
                        const AmiVector &sx, const AmiVector & /*sdx*/,
                        AmiVector &sxdot) {
-    fsxdot(t, x.getNVector(), ip, sx.getNVector(), sxdot.getNVector());
+    fsxdot(t, x.getNVector(), ip, sx.getNVector(), sxdot.getNVector(),
+           ip == 0);
 }
 
 void Model_ODE::fsxdot(realtype t, const_N_Vector x, int ip, const_N_Vector sx,
-                       N_Vector sxdot) {
+                       N_Vector sxdot, bool update) {
 
     /* sxdot is just the total derivative d(xdot)dp,
      so we just call dxdotdp and copy the stuff over */
-    if (ip == 0) {
+    if (update) {
         // we only need to call this for the first parameter index will be
         // the same for all remaining
         fdxdotdp(t, x);
@@ -435,4 +480,48 @@ void Model_ODE::fsxdot(realtype t, const_N_Vector x, int ip, const_N_Vector sx,
     derived_state_.J_.multiply(sxdot, sx);
 }
 
+void Model_ODE::fsxdot(realtype t, const_N_Vector x,
+                       gsl::span<const int> ips,
+                       gsl::span<const N_Vector> sx,
+                       gsl::span<N_Vector> sxdot) {
+    fdxdotdp(t, x);
+    fJSparse(t, x, derived_state_.J_.get());
+    derived_state_.J_.refresh();
+
+    auto nsens = static_cast<int>(sx.size());
+    auto &sx_block = derived_state_.sx_block_;
+    auto &sxdot_block = derived_state_.sxdot_block_;
+    sx_block.resize(nx_solver * nsens);
+    sxdot_block.assign(nx_solver * nsens, 0.0);
+
+    /* gather sensitivities and parameter derivatives into row-major blocks,
+     such that each entry of J updates a contiguous row of sxdot_block */
+    for (int is = 0; is < nsens; ++is) {
+        auto sx_is = N_VGetArrayPointer(sx[is]);
+        for (int ix = 0; ix < nx_solver; ++ix)
+            sx_block[ix * nsens + is] = sx_is[ix];
+
+        auto ip = ips[is];
+        if (pythonGenerated) {
+            auto const &dxdotdp = derived_state_.dxdotdp_full;
+            for (auto idx = dxdotdp.get_indexptr(plist(ip));
+                 idx < dxdotdp.get_indexptr(plist(ip) + 1); ++idx)
+                sxdot_block[dxdotdp.get_indexval(idx) * nsens + is] =
+                    dxdotdp.get_data(idx);
+        } else {
+            for (int ix = 0; ix < nx_solver; ++ix)
+                sxdot_block[ix * nsens + is] =
+                    derived_state_.dxdotdp.at(ix, ip);
+        }
+    }
+
+    derived_state_.J_.multiply_block(sxdot_block, sx_block, nsens);
+
+    for (int is = 0; is < nsens; ++is) {
+        auto sxdot_is = N_VGetArrayPointer(sxdot[is]);
+        for (int ix = 0; ix < nx_solver; ++ix)
+            sxdot_is[ix] = sxdot_block[ix * nsens + is];
+    }
+}
+
 } // namespace amici
@@ -5,6 +5,8 @@ namespace amici {
 ModelStateDerived::ModelStateDerived(const ModelDimensions &dim)
     : J_(dim.nx_solver, dim.nx_solver, dim.nnz, CSC_MAT),
       JB_(dim.nx_solver, dim.nx_solver, dim.nnz, CSC_MAT),
+      Jv_(dim.nx_solver, dim.nx_solver, dim.nnz, CSC_MAT),
+      JvB_(dim.nx_solver, dim.nx_solver, dim.nnz, CSC_MAT),
       dxdotdw_(dim.nx_solver, dim.nw, dim.ndxdotdw, CSC_MAT),
       dx_rdatadx_solver(dim.nx_rdata, dim.nx_solver, dim.ndxrdatadxsolver,
                         CSC_MAT),
@@ -6,15 +6,26 @@
 #include "sunlinsol/sunlinsol_klu.h" // sparse solver
 #include "sunlinsol/sunlinsol_dense.h" // dense solver
 
+#include <algorithm>
 #include <cstring>
 #include <ctime>
 #include <cmath>
+#include <limits>
+
+#if defined(SUNDIALS_INT64_T)
+#define sun_klu_solve klu_l_solve
+#define sun_klu_tsolve klu_l_tsolve
+#else
+#define sun_klu_solve klu_solve
+#define sun_klu_tsolve klu_tsolve
+#endif
 
 namespace amici {
 
 NewtonSolver::NewtonSolver(realtype *t, AmiVector *x, Model *model)
     : t_(t), model_(model), xdot_(model->nx_solver), x_(x),
-      dx_(model->nx_solver), xB_(model->nx_solver), dxB_(model->nx_solver) {
+      dx_(model->nx_solver), xB_(model->nx_solver), dxB_(model->nx_solver),
+      x_factorized_(model->nx_solver) {
 }
 
 /* ------------------------------------------------------------------------- */
@@ -46,10 +57,10 @@ std::unique_ptr<NewtonSolver> NewtonSolver::getSolver(realtype *t, AmiVector *x,
 
     /* ITERATIVE SOLVERS */
     case LinearSolver::SPGMR:
-        throw NewtonFailure(AMICI_NOT_IMPLEMENTED, "getSolver");
-
     case LinearSolver::SPBCG:
-        solver.reset(new NewtonSolverIterative(t, x, model));
+        solver.reset(new NewtonSolverIterative(
+            t, x, model, simulationSolver.getLinearSolver(),
+            simulationSolver.getPreconditionerType()));
         break;
 
     case LinearSolver::SPTFQMR:
@@ -71,8 +82,15 @@ std::unique_ptr<NewtonSolver> NewtonSolver::getSolver(realtype *t, AmiVector *x,
     solver->damping_factor_mode_ = simulationSolver.getNewtonDampingFactorMode();
     solver->damping_factor_lower_bound =
         simulationSolver.getNewtonDampingFactorLowerBound();
-    if (simulationSolver.getLinearSolver() == LinearSolver::SPBCG)
+    if (auto iterative = dynamic_cast<NewtonSolverIterative *>(solver.get())) {
+        /* the iterative solver does not factorize the Jacobian, but may
+         * reuse the preconditioner */
+        iterative->reuse_preconditioner_ =
+            simulationSolver.getNewtonJacobianReuse();
         solver->num_lin_steps_.resize(simulationSolver.getNewtonMaxSteps(), 0);
+    } else {
+        solver->reuse_jacobian_ = simulationSolver.getNewtonJacobianReuse();
+    }
 
     return solver;
 }
@@ -80,7 +98,12 @@ std::unique_ptr<NewtonSolver> NewtonSolver::getSolver(realtype *t, AmiVector *x,
 /* ------------------------------------------------------------------------- */
 
 void NewtonSolver::getStep(int ntry, int nnewt, AmiVector &delta) {
-    prepareLinearSystem(ntry, nnewt);
+    if (!reuse_jacobian_ || jacobian_age_ < 0) {
+        prepareLinearSystem(ntry, nnewt);
+        jacobian_age_ = 0;
+    } else {
+        ++jacobian_age_;
+    }
 
     delta.minus();
     solveLinearSystem(delta);
@@ -89,7 +112,10 @@ void NewtonSolver::getStep(int ntry, int nnewt, AmiVector &delta) {
 /* ------------------------------------------------------------------------- */
 
 void NewtonSolver::computeNewtonSensis(AmiVectorArray &sx) {
-    prepareLinearSystem(0, -1);
+    if (!isFactorizedAt(*x_)) {
+        prepareLinearSystem(0, -1);
+        resetJacobian();
+    }
     model_->fdxdotdp(*t_, *x_, dx_);
 
     if (model_->pythonGenerated) {
@@ -98,17 +124,45 @@ void NewtonSolver::computeNewtonSensis(AmiVectorArray &sx) {
             model_->get_dxdotdp_full().scatter(model_->plist(ip), -1.0, nullptr,
                                                gsl::make_span(sx.getNVector(ip)),
                                                0, nullptr, 0);
-
-            solveLinearSystem(sx[ip]);
         }
     } else {
         for (int ip = 0; ip < model_->nplist(); ip++) {
             for (int ix = 0; ix < model_->nx_solver; ix++)
                 sx.at(ix,ip) = -model_->get_dxdotdp().at(ix, ip);
-
-            solveLinearSystem(sx[ip]);
         }
     }
+
+    solveLinearSystems(sx);
+}
+
+/* ------------------------------------------------------------------------- */
+
+bool NewtonSolver::isFactorizedAt(AmiVector const &x) const {
+    return factorized_ && *t_ == t_factorized_ &&
+           std::equal(x.data(), x.data() + x.getLength(),
+                      x_factorized_.data());
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolver::solveLinearSystems(AmiVectorArray &rhs) {
+    for (int i = 0; i < rhs.getLength(); i++)
+        solveLinearSystem(rhs[i]);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolver::prepareShiftedLinearSystem(realtype /*h*/) {
+    throw NewtonFailure(AMICI_NOT_IMPLEMENTED, "prepareShiftedLinearSystem");
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolver::solveLinearSystemTransposed(AmiVector &rhs) {
+    /* J^T = -JB */
+    prepareLinearSystemB(0, -1);
+    solveLinearSystem(rhs);
+    rhs.minus();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -129,9 +183,15 @@ NewtonSolverDense::NewtonSolverDense(realtype *t, AmiVector *x, Model *model)
 void NewtonSolverDense::prepareLinearSystem(int  /*ntry*/, int  /*nnewt*/) {
     model_->fJ(*t_, 0.0, *x_, dx_, xdot_, Jtmp_.get());
     Jtmp_.refresh();
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
     int status = SUNLinSolSetup_Dense(linsol_, Jtmp_.get());
     if(status != AMICI_SUCCESS)
         throw NewtonFailure(status, "SUNLinSolSetup_Dense");
+    x_factorized_.copy(*x_);
+    t_factorized_ = *t_;
+    factorized_ = true;
 }
 
 /* ------------------------------------------------------------------------- */
@@ -139,11 +199,31 @@ void NewtonSolverDense::prepareLinearSystem(int  /*ntry*/, int  /*nnewt*/) {
 void NewtonSolverDense::prepareLinearSystemB(int  /*ntry*/, int  /*nnewt*/) {
     model_->fJB(*t_, 0.0, *x_, dx_, xB_, dxB_, xdot_, Jtmp_.get());
     Jtmp_.refresh();
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
     int status = SUNLinSolSetup_Dense(linsol_, Jtmp_.get());
     if(status != AMICI_SUCCESS)
         throw NewtonFailure(status, "SUNLinSolSetup_Dense");
 }
 
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverDense::prepareShiftedLinearSystem(realtype h) {
+    model_->fJ(*t_, 0.0, *x_, dx_, xdot_, Jtmp_.get());
+    Jtmp_.refresh();
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
+    resetJacobian();
+    int status = SUNMatScaleAddI(-h, Jtmp_.get());
+    if(status != AMICI_SUCCESS)
+        throw NewtonFailure(status, "SUNMatScaleAddI");
+    status = SUNLinSolSetup_Dense(linsol_, Jtmp_.get());
+    if(status != AMICI_SUCCESS)
+        throw NewtonFailure(status, "SUNLinSolSetup_Dense");
+}
+
 
 /* ------------------------------------------------------------------------- */
 
@@ -160,6 +240,79 @@ void NewtonSolverDense::solveLinearSystem(AmiVector &rhs) {
 
 /* ------------------------------------------------------------------------- */
 
+void NewtonSolverDense::solveLinearSystems(AmiVectorArray &rhs) {
+    /* Same as denseGETRS, but each column of the factorization is applied to
+     all right hand sides before moving on to the next one */
+    auto n = model_->nx_solver;
+    auto nrhs = rhs.getLength();
+    auto a = SUNDenseMatrix_Cols(Jtmp_.get());
+    auto p = static_cast<SUNLinearSolverContent_Dense>(linsol_->content)
+                 ->pivots;
+
+    for (int irhs = 0; irhs < nrhs; irhs++) {
+        auto b = rhs.data(irhs);
+        for (int k = 0; k < n; k++)
+            if (p[k] != k)
+                std::swap(b[k], b[p[k]]);
+    }
+    /* L y = b */
+    for (int k = 0; k < n - 1; k++) {
+        auto col_k = a[k];
+        for (int irhs = 0; irhs < nrhs; irhs++) {
+            auto b = rhs.data(irhs);
+            auto bk = b[k];
+            for (int i = k + 1; i < n; i++)
+                b[i] -= col_k[i] * bk;
+        }
+    }
+    /* U x = y */
+    for (int k = n - 1; k >= 0; k--) {
+        auto col_k = a[k];
+        for (int irhs = 0; irhs < nrhs; irhs++) {
+            auto b = rhs.data(irhs);
+            b[k] /= col_k[k];
+            auto bk = b[k];
+            for (int i = 0; i < k; i++)
+                b[i] -= col_k[i] * bk;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverDense::solveLinearSystemTransposed(AmiVector &rhs) {
+    if (!isFactorizedAt(*x_)) {
+        prepareLinearSystem(0, -1);
+        resetJacobian();
+    }
+    /* P J = L U, hence J^T = U^T L^T P */
+    auto n = model_->nx_solver;
+    auto a = SUNDenseMatrix_Cols(Jtmp_.get());
+    auto p = static_cast<SUNLinearSolverContent_Dense>(linsol_->content)
+                 ->pivots;
+    auto b = rhs.data();
+
+    /* U^T z = b */
+    for (int k = 0; k < n; k++) {
+        auto col_k = a[k];
+        for (int i = 0; i < k; i++)
+            b[k] -= col_k[i] * b[i];
+        b[k] /= col_k[k];
+    }
+    /* L^T y = z */
+    for (int k = n - 2; k >= 0; k--) {
+        auto col_k = a[k];
+        for (int i = k + 1; i < n; i++)
+            b[k] -= col_k[i] * b[i];
+    }
+    /* x = P^T y */
+    for (int k = n - 1; k >= 0; k--)
+        if (p[k] != k)
+            std::swap(b[k], b[p[k]]);
+}
+
+/* ------------------------------------------------------------------------- */
+
 NewtonSolverDense::~NewtonSolverDense() {
     if(linsol_)
         SUNLinSolFree_Dense(linsol_);
@@ -185,9 +338,13 @@ void NewtonSolverSparse::prepareLinearSystem(int  /*ntry*/, int  /*nnewt*/) {
     /* Get sparse Jacobian */
     model_->fJSparse(*t_, 0.0, *x_, dx_, xdot_, Jtmp_.get());
     Jtmp_.refresh();
-    int status = SUNLinSolSetup_KLU(linsol_, Jtmp_.get());
-    if(status != AMICI_SUCCESS)
-        throw NewtonFailure(status, "SUNLinSolSetup_KLU");
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
+    setupLinearSolver();
+    x_factorized_.copy(*x_);
+    t_factorized_ = *t_;
+    factorized_ = true;
 }
 
 /* ------------------------------------------------------------------------- */
@@ -196,6 +353,58 @@ void NewtonSolverSparse::prepareLinearSystemB(int  /*ntry*/, int  /*nnewt*/) {
     /* Get sparse Jacobian */
     model_->fJSparseB(*t_, 0.0, *x_, dx_, xB_, dxB_, xdot_, Jtmp_.get());
     Jtmp_.refresh();
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
+    setupLinearSolver();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverSparse::prepareShiftedLinearSystem(realtype h) {
+    model_->fJSparse(*t_, 0.0, *x_, dx_, xdot_, Jtmp_.get());
+    Jtmp_.refresh();
+    ++num_jac_evals_;
+    ++num_factorizations_;
+    factorized_ = false;
+    resetJacobian();
+    /* may extend the sparsity pattern by the diagonal and reallocate */
+    int status = SUNMatScaleAddI(-h, Jtmp_.get());
+    if(status != AMICI_SUCCESS)
+        throw NewtonFailure(status, "SUNMatScaleAddI");
+    Jtmp_.refresh();
+    setupLinearSolver();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverSparse::setupLinearSolver() {
+    auto n = Jtmp_.columns();
+    bool same_pattern =
+        static_cast<sunindextype>(factorized_indexptrs_.size()) == n + 1;
+    for (sunindextype icol = 0; same_pattern && icol <= n; icol++)
+        same_pattern = factorized_indexptrs_[icol] == Jtmp_.get_indexptr(icol);
+    for (sunindextype idx = 0; same_pattern && idx < Jtmp_.get_indexptr(n);
+         idx++)
+        same_pattern = factorized_indexvals_[idx] == Jtmp_.get_indexval(idx);
+
+    if (!same_pattern) {
+        /* KLU refactorization requires the analyzed pattern */
+        if (!factorized_indexptrs_.empty()) {
+            int status = SUNLinSol_KLUReInit(linsol_, Jtmp_.get(),
+                                             Jtmp_.capacity(),
+                                             SUNKLU_REINIT_PARTIAL);
+            if(status != AMICI_SUCCESS)
+                throw NewtonFailure(status, "SUNLinSol_KLUReInit");
+        }
+        factorized_indexptrs_.resize(n + 1);
+        for (sunindextype icol = 0; icol <= n; icol++)
+            factorized_indexptrs_[icol] = Jtmp_.get_indexptr(icol);
+        factorized_indexvals_.resize(Jtmp_.get_indexptr(n));
+        for (sunindextype idx = 0; idx < Jtmp_.get_indexptr(n); idx++)
+            factorized_indexvals_[idx] = Jtmp_.get_indexval(idx);
+    }
+
     int status = SUNLinSolSetup_KLU(linsol_, Jtmp_.get());
     if(status != AMICI_SUCCESS)
         throw NewtonFailure(status, "SUNLinSolSetup_KLU");
@@ -215,6 +424,34 @@ void NewtonSolverSparse::solveLinearSystem(AmiVector &rhs) {
 
 /* ------------------------------------------------------------------------- */
 
+void NewtonSolverSparse::solveLinearSystems(AmiVectorArray &rhs) {
+    if (rhs.getLength() == 0)
+        return;
+    /* the data of rhs is stored contiguously (column-major) */
+    auto status = sun_klu_solve(
+        SUNLinSol_KLUGetSymbolic(linsol_), SUNLinSol_KLUGetNumeric(linsol_),
+        model_->nx_solver, rhs.getLength(), rhs.data().data(),
+        SUNLinSol_KLUGetCommon(linsol_));
+    if(status == 0)
+        throw NewtonFailure(AMICI_SINGULAR_JACOBIAN, "klu_solve");
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverSparse::solveLinearSystemTransposed(AmiVector &rhs) {
+    if (!isFactorizedAt(*x_)) {
+        prepareLinearSystem(0, -1);
+        resetJacobian();
+    }
+    auto status = sun_klu_tsolve(
+        SUNLinSol_KLUGetSymbolic(linsol_), SUNLinSol_KLUGetNumeric(linsol_),
+        model_->nx_solver, 1, rhs.data(), SUNLinSol_KLUGetCommon(linsol_));
+    if(status == 0)
+        throw NewtonFailure(AMICI_SINGULAR_JACOBIAN, "klu_tsolve");
+}
+
+/* ------------------------------------------------------------------------- */
+
 NewtonSolverSparse::~NewtonSolverSparse() {
     if(linsol_)
         SUNLinSolFree_KLU(linsol_);
@@ -224,14 +461,21 @@ NewtonSolverSparse::~NewtonSolverSparse() {
 /* - Iterative linear solver------------------------------------------------ */
 /* ------------------------------------------------------------------------- */
 
-NewtonSolverIterative::NewtonSolverIterative(realtype *t, AmiVector *x,
-                                             Model *model)
-    : NewtonSolver(t, x, model), ns_p_(model->nx_solver),
-    ns_h_(model->nx_solver), ns_t_(model->nx_solver), ns_s_(model->nx_solver),
-    ns_r_(model->nx_solver), ns_rt_(model->nx_solver), ns_v_(model->nx_solver),
-    ns_Jv_(model->nx_solver), ns_tmp_(model->nx_solver),
-    ns_Jdiag_(model->nx_solver), ns_J_(model->nx_solver, model->nx_solver)
+NewtonSolverIterative::NewtonSolverIterative(
+    realtype *t, AmiVector *x, Model *model, LinearSolver linsol_type,
+    PreconditionerType preconditioner_type)
+    : NewtonSolver(t, x, model), linsol_type_(linsol_type),
+    preconditioner_(Preconditioner::create(preconditioner_type,
+                                           model->nx_solver, model->nnz)),
+    ns_p_(model->nx_solver), ns_h_(model->nx_solver), ns_t_(model->nx_solver),
+    ns_s_(model->nx_solver), ns_r_(model->nx_solver), ns_rt_(model->nx_solver),
+    ns_v_(model->nx_solver), ns_Jv_(model->nx_solver),
+    ns_tmp_(model->nx_solver), ns_Jdiag_(model->nx_solver),
+    ns_J_(model->nx_solver, model->nx_solver, model->nnz, CSC_MAT)
     {
+    if (linsol_type_ != LinearSolver::SPBCG &&
+        linsol_type_ != LinearSolver::SPGMR)
+        throw NewtonFailure(AMICI_NOT_IMPLEMENTED, "NewtonSolverIterative");
 }
 
 /* ------------------------------------------------------------------------- */
@@ -245,17 +489,11 @@ void NewtonSolverIterative::prepareLinearSystem(int ntry, int nnewt) {
                             "computation for steady state problems.");
     }
 
-    // Get the Jacobian and its diagonal for preconditioning
-    model_->fJ(*t_, 0.0, *x_, dx_, xdot_, ns_J_.get());
+    // Get the sparse Jacobian for matrix-vector products and preconditioning
+    model_->fJSparse(*t_, 0.0, *x_, dx_, xdot_, ns_J_.get());
     ns_J_.refresh();
-    model_->fJDiag(*t_, ns_Jdiag_, 0.0, *x_, dx_);
-
-    // Ensure positivity of entries in ns_Jdiag
-    ns_p_.set(1.0);
-    ns_Jdiag_.abs();
-    N_VCompare(1e-15, ns_Jdiag_.getNVector(), ns_tmp_.getNVector());
-    linearSum(-1.0, ns_tmp_, 1.0, ns_p_, ns_tmp_);
-    linearSum(1.0, ns_Jdiag_, 1.0, ns_tmp_, ns_Jdiag_);
+    ++num_jac_evals_;
+    setupLinearSystem(0.0, 1.0, false);
 }
 
 /* ------------------------------------------------------------------------- */
@@ -268,50 +506,143 @@ void NewtonSolverIterative::prepareLinearSystemB(int ntry, int nnewt) {
                            "computation for steady state problems.");
     }
 
-    // Get the Jacobian and its diagonal for preconditioning
-    model_->fJB(*t_, 0.0, *x_, dx_, xB_, dxB_, xdot_, ns_J_.get());
+    // Get the sparse Jacobian for matrix-vector products and preconditioning
+    model_->fJSparseB(*t_, 0.0, *x_, dx_, xB_, dxB_, xdot_, ns_J_.get());
     ns_J_.refresh();
-    // Get the diagonal and ensure negativity of entries is ns_J. Note that diag(JB) = -diag(J).
-    model_->fJDiag(*t_, ns_Jdiag_, 0.0, *x_, dx_);
+    ++num_jac_evals_;
+    setupLinearSystem(0.0, 1.0, true);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverIterative::prepareShiftedLinearSystem(realtype h) {
+    newton_try_ = 0;
+    i_newton_ = -1;
+    resetJacobian();
+
+    model_->fJSparse(*t_, 0.0, *x_, dx_, xdot_, ns_J_.get());
+    ns_J_.refresh();
+    ++num_jac_evals_;
+    setupLinearSystem(1.0, -h, false);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverIterative::setupLinearSystem(realtype alpha, realtype beta,
+                                              bool backward) {
+    alpha_ = alpha;
+    beta_ = beta;
+    backward_ = backward;
+
+    if (!preconditioner_) {
+        // Scale by the diagonal of alpha I + beta J, note that
+        // diag(JB) = -diag(J)
+        model_->fJDiag(*t_, ns_Jdiag_, 0.0, *x_, dx_);
+        N_VScale(backward ? -beta : beta, ns_Jdiag_.getNVector(),
+                 ns_Jdiag_.getNVector());
+        N_VAddConst(ns_Jdiag_.getNVector(), alpha, ns_Jdiag_.getNVector());
+
+        // Ensure positivity of entries in ns_Jdiag
+        ns_p_.set(1.0);
+        ns_Jdiag_.abs();
+        N_VCompare(1e-15, ns_Jdiag_.getNVector(), ns_tmp_.getNVector());
+        linearSum(-1.0, ns_tmp_, 1.0, ns_p_, ns_tmp_);
+        linearSum(1.0, ns_Jdiag_, 1.0, ns_tmp_, ns_Jdiag_);
+        if (backward)
+            ns_Jdiag_.minus();
+        return;
+    }
+
+    preconditioner_current_ = false;
+    /* Reuse the preconditioner of a previous Jacobian for the same kind of
+       linear system, unless the number of linear iterations has more than
+       doubled since it was computed */
+    if (reuse_preconditioner_ && preconditioner_valid_ &&
+        alpha == preconditioner_alpha_ && beta == preconditioner_beta_ &&
+        backward == preconditioner_backward_ &&
+        (preconditioner_lin_steps_ < 0 ||
+         last_lin_steps_ <= 2 * std::max(preconditioner_lin_steps_, 1)))
+        return;
+
+    setupPreconditioner();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverIterative::setupPreconditioner() {
+    preconditioner_valid_ = false;
+    preconditioner_->getJacobian() = ns_J_;
+    ++num_factorizations_;
+    if (preconditioner_->setup(alpha_, beta_) != AMICI_SUCCESS)
+        throw NewtonFailure(AMICI_SINGULAR_JACOBIAN, "Preconditioner::setup");
+    preconditioner_valid_ = true;
+    preconditioner_alpha_ = alpha_;
+    preconditioner_beta_ = beta_;
+    preconditioner_backward_ = backward_;
+    preconditioner_current_ = true;
+    preconditioner_lin_steps_ = -1;
+}
+
+/* ------------------------------------------------------------------------- */
 
-    ns_p_.set(1.0);
-    ns_Jdiag_.abs();
-    N_VCompare(1e-15, ns_Jdiag_.getNVector(), ns_tmp_.getNVector());
-    linearSum(-1.0, ns_tmp_, 1.0, ns_p_, ns_tmp_);
-    linearSum(1.0, ns_Jdiag_, 1.0, ns_tmp_, ns_Jdiag_);
-    ns_Jdiag_.minus();
+void NewtonSolverIterative::multiplyMatrix(AmiVector const &v,
+                                           AmiVector &Av) const {
+    // Av = alpha * v + beta * J * v
+    N_VScale(alpha_, const_cast<N_Vector>(v.getNVector()), Av.getNVector());
+    ns_J_.multiply(Av, v, beta_);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverIterative::applyPreconditioner(AmiVector const &r,
+                                                AmiVector &z) const {
+    if (preconditioner_) {
+        preconditioner_->solve(gsl::make_span(r.data(), r.getLength()),
+                                gsl::make_span(z.data(), z.getLength()));
+    } else {
+        N_VDiv(const_cast<N_Vector>(r.getNVector()),
+               const_cast<N_Vector>(ns_Jdiag_.getNVector()), z.getNVector());
+    }
 }
 
 /* ------------------------------------------------------------------------- */
 
 void NewtonSolverIterative::solveLinearSystem(AmiVector &rhs) {
-    linsolveSPBCG(newton_try_, i_newton_, rhs);
-    rhs.minus();
+    try {
+        if (linsol_type_ == LinearSolver::SPGMR)
+            linsolveSPGMR(newton_try_, i_newton_, rhs);
+        else
+            linsolveSPBCG(newton_try_, i_newton_, rhs);
+    } catch (NewtonFailure const &) {
+        if (!preconditioner_ || preconditioner_current_)
+            throw;
+        // retry with a preconditioner computed from the current Jacobian
+        setupPreconditioner();
+        // both solvers keep the right hand side in ns_rt_
+        rhs = ns_rt_;
+        if (linsol_type_ == LinearSolver::SPGMR)
+            linsolveSPGMR(newton_try_, i_newton_, rhs);
+        else
+            linsolveSPBCG(newton_try_, i_newton_, rhs);
+    }
+    if (preconditioner_lin_steps_ < 0)
+        preconditioner_lin_steps_ = last_lin_steps_;
 }
 
 /* ------------------------------------------------------------------------- */
 
 void NewtonSolverIterative::linsolveSPBCG(int /*ntry*/, int nnewt,
                                           AmiVector &ns_delta) {
-    xdot_ = ns_delta;
-    xdot_.minus();
-
-    // Initialize for linear solve
+    // Initialize for linear solve, initial guess is zero, hence r = b
+    ns_r_ = ns_delta;
+    ns_rt_ = ns_r_;
     ns_p_.zero();
     ns_v_.zero();
     ns_delta.zero();
-    ns_tmp_.zero();
     double rho = 1.0;
     double omega = 1.0;
     double alpha = 1.0;
 
-    ns_J_.multiply(ns_Jv_, ns_delta);
-
-    // ns_r = xdot - ns_Jv;
-    linearSum(-1.0, ns_Jv_, 1.0, xdot_, ns_r_);
-    ns_r_ /= ns_Jdiag_;
-    ns_rt_ = ns_r_;
-
     for (int i_linstep = 0; i_linstep < max_lin_steps_; i_linstep++) {
         // Compute factors
         double rho1 = rho;
@@ -322,50 +653,160 @@ void NewtonSolverIterative::linsolveSPBCG(int /*ntry*/, int nnewt,
         linearSum(1.0, ns_p_, -omega, ns_v_, ns_p_);
         linearSum(1.0, ns_r_, beta, ns_p_, ns_p_);
 
-        // ns_v = J * ns_p
-        ns_v_.zero();
-        ns_J_.multiply(ns_v_, ns_p_);
-        ns_v_ /= ns_Jdiag_;
+        // ns_v = A * P^{-1} * ns_p
+        applyPreconditioner(ns_p_, ns_h_);
+        multiplyMatrix(ns_h_, ns_v_);
 
         // Compute factor
         alpha = rho / dotProd(ns_rt_, ns_v_);
 
-        // ns_h = ns_delta + alpha * ns_p;
-        linearSum(1.0, ns_delta, alpha, ns_p_, ns_h_);
+        // ns_delta = ns_delta + alpha * P^{-1} * ns_p;
+        linearSum(1.0, ns_delta, alpha, ns_h_, ns_delta);
         // ns_s = ns_r - alpha * ns_v;
         linearSum(1.0, ns_r_, -alpha, ns_v_, ns_s_);
 
-        // ns_t = J * ns_s
-        ns_t_.zero();
-        ns_J_.multiply(ns_t_, ns_s_);
-        ns_t_ /= ns_Jdiag_;
+        // Test convergence after the first half step, omega would be
+        // undefined for ns_s = 0
+        if (sqrt(dotProd(ns_s_, ns_s_)) < atol_) {
+            last_lin_steps_ = i_linstep + 1;
+            if (nnewt >= 0)
+                num_lin_steps_.at(nnewt) = last_lin_steps_;
+            return;
+        }
+
+        // ns_t = A * P^{-1} * ns_s
+        applyPreconditioner(ns_s_, ns_tmp_);
+        multiplyMatrix(ns_tmp_, ns_t_);
 
         // Compute factor
         omega = dotProd(ns_t_, ns_s_) / dotProd(ns_t_, ns_t_);
 
-        // ns_delta = ns_h + omega * ns_s;
-        linearSum(1.0, ns_h_, omega, ns_s_, ns_delta);
+        // ns_delta = ns_delta + omega * P^{-1} * ns_s;
+        linearSum(1.0, ns_delta, omega, ns_tmp_, ns_delta);
         // ns_r = ns_s - omega * ns_t;
         linearSum(1.0, ns_s_, -omega, ns_t_, ns_r_);
 
-        // Compute the (unscaled) residual
-        ns_r_ *= ns_Jdiag_;
+        // Compute the residual
         double res = sqrt(dotProd(ns_r_, ns_r_));
 
         // Test convergence
         if (res < atol_) {
             // Write number of steps needed
-            num_lin_steps_.at(nnewt) = i_linstep + 1;
+            last_lin_steps_ = i_linstep + 1;
+            if (nnewt >= 0)
+                num_lin_steps_.at(nnewt) = last_lin_steps_;
 
             // Return success
             return;
         }
-
-        // Scale back
-        ns_r_ /= ns_Jdiag_;
     }
     throw NewtonFailure(AMICI_CONV_FAILURE, "linsolveSPBCG");
 }
 
+/* ------------------------------------------------------------------------- */
+
+void NewtonSolverIterative::linsolveSPGMR(int /*ntry*/, int nnewt,
+                                          AmiVector &ns_delta) {
+    auto m = std::max(std::min(max_krylov_dim_, max_lin_steps_), 1);
+    if (static_cast<int>(ns_V_.size()) < m + 1) {
+        ns_V_.resize(m + 1, AmiVector(model_->nx_solver));
+        ns_H_.resize((m + 1) * m);
+        ns_cs_.resize(m);
+        ns_sn_.resize(m);
+        ns_g_.resize(m + 1);
+    }
+
+    // Initialize for linear solve, initial guess is zero, hence r = b
+    ns_r_ = ns_delta;
+    ns_rt_ = ns_r_;
+    ns_delta.zero();
+    double res = sqrt(dotProd(ns_r_, ns_r_));
+
+    int i_linstep = 0;
+    while (res >= atol_) {
+        if (i_linstep >= max_lin_steps_ || !std::isfinite(res))
+            throw NewtonFailure(AMICI_CONV_FAILURE, "linsolveSPGMR");
+
+        // ns_V[0] = ns_r / |ns_r|
+        linearSum(1.0 / res, ns_r_, 0.0, ns_r_, ns_V_[0]);
+        std::fill(ns_g_.begin(), ns_g_.end(), 0.0);
+        ns_g_[0] = res;
+
+        // Arnoldi process with modified Gram-Schmidt orthogonalization
+        int k = 0;
+        while (k < m && i_linstep < max_lin_steps_ && res >= atol_) {
+            auto h = &ns_H_.at(k * (m + 1));
+
+            // ns_V[k+1] = A * P^{-1} * ns_V[k]
+            applyPreconditioner(ns_V_[k], ns_tmp_);
+            multiplyMatrix(ns_tmp_, ns_V_[k + 1]);
+            auto norm_Av = sqrt(dotProd(ns_V_[k + 1], ns_V_[k + 1]));
+            for (int i = 0; i <= k; i++) {
+                h[i] = dotProd(ns_V_[k + 1], ns_V_[i]);
+                linearSum(1.0, ns_V_[k + 1], -h[i], ns_V_[i], ns_V_[k + 1]);
+            }
+            h[k + 1] = sqrt(dotProd(ns_V_[k + 1], ns_V_[k + 1]));
+            // The Krylov subspace is invariant if the new direction
+            // vanishes up to round-off, no further directions can be added
+            bool breakdown = !(h[k + 1] >
+                               100 * std::numeric_limits<realtype>::epsilon() *
+                                   norm_Av);
+            if (breakdown)
+                h[k + 1] = 0.0;
+            else
+                linearSum(1.0 / h[k + 1], ns_V_[k + 1], 0.0, ns_V_[k + 1],
+                          ns_V_[k + 1]);
+
+            // Apply previous Givens rotations to the new column
+            for (int i = 0; i < k; i++) {
+                auto tmp = ns_cs_[i] * h[i] + ns_sn_[i] * h[i + 1];
+                h[i + 1] = -ns_sn_[i] * h[i] + ns_cs_[i] * h[i + 1];
+                h[i] = tmp;
+            }
+            // Compute new rotation to eliminate h[k + 1]
+            auto nrm = std::hypot(h[k], h[k + 1]);
+            ns_cs_[k] = h[k] / nrm;
+            ns_sn_[k] = h[k + 1] / nrm;
+            h[k] = nrm;
+            h[k + 1] = 0.0;
+            ns_g_[k + 1] = -ns_sn_[k] * ns_g_[k];
+            ns_g_[k] = ns_cs_[k] * ns_g_[k];
+
+            // The residual of the least squares problem
+            res = std::abs(ns_g_[k + 1]);
+            ++k;
+            ++i_linstep;
+            if (breakdown)
+                break;
+        }
+
+        // Solve the upper triangular system H y = g, stored in g
+        for (int i = k - 1; i >= 0; i--) {
+            for (int j = i + 1; j < k; j++)
+                ns_g_[i] -= ns_H_.at(j * (m + 1) + i) * ns_g_[j];
+            ns_g_[i] /= ns_H_.at(i * (m + 1) + i);
+        }
+
+        // ns_delta = ns_delta + P^{-1} * ns_V * y
+        ns_s_.zero();
+        for (int i = 0; i < k; i++)
+            linearSum(1.0, ns_s_, ns_g_[i], ns_V_[i], ns_s_);
+        applyPreconditioner(ns_s_, ns_tmp_);
+        linearSum(1.0, ns_delta, 1.0, ns_tmp_, ns_delta);
+
+        // Restart with the true residual ns_r = b - A * ns_delta
+        if (res >= atol_) {
+            multiplyMatrix(ns_delta, ns_Jv_);
+            linearSum(1.0, ns_rt_, -1.0, ns_Jv_, ns_r_);
+            res = sqrt(dotProd(ns_r_, ns_r_));
+        }
+    }
+
+    // Write number of steps needed
+    last_lin_steps_ = i_linstep;
+    if (nnewt >= 0)
+        num_lin_steps_.at(nnewt) = last_lin_steps_;
+}
+
 
 } // namespace amici
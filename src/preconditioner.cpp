@@ -0,0 +1,228 @@
+#include "amici/preconditioner.h"
+
+#include "amici/exception.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace amici {
+
+/**
+ * @brief Check whether a pivot can be used for division
+ * @param pivot pivot
+ * @return true if pivot is nonzero and finite
+ */
+static bool isValidPivot(realtype pivot) {
+    return pivot != 0.0 && std::isfinite(pivot);
+}
+
+Preconditioner::Preconditioner(sunindextype n, sunindextype nnz)
+    : n_(n), J_(n, n, nnz, CSC_MAT) {
+    J_.zero();
+}
+
+std::unique_ptr<Preconditioner>
+Preconditioner::create(PreconditionerType type, sunindextype n,
+                       sunindextype nnz) {
+    switch (type) {
+    case PreconditionerType::none:
+        return nullptr;
+    case PreconditionerType::jacobi:
+        return std::make_unique<JacobiPreconditioner>(n, nnz);
+    case PreconditionerType::blockJacobi:
+        return std::make_unique<BlockJacobiPreconditioner>(n, nnz);
+    case PreconditionerType::ILU:
+        return std::make_unique<ILUPreconditioner>(n, nnz);
+    }
+    throw AmiException("Invalid preconditioner type: %d",
+                       static_cast<int>(type));
+}
+
+SUNMatrixWrapper &Preconditioner::getJacobian() { return J_; }
+
+JacobiPreconditioner::JacobiPreconditioner(sunindextype n, sunindextype nnz)
+    : Preconditioner(n, nnz), inv_diag_(n) {}
+
+int JacobiPreconditioner::setup(realtype alpha, realtype beta) {
+    std::fill(inv_diag_.begin(), inv_diag_.end(), alpha);
+    for (sunindextype icol = 0; icol < n_; ++icol) {
+        for (auto idx = J_.get_indexptr(icol);
+             idx < J_.get_indexptr(icol + 1); ++idx) {
+            if (J_.get_indexval(idx) == icol)
+                inv_diag_[icol] += beta * J_.get_data(idx);
+        }
+    }
+    for (auto &d : inv_diag_) {
+        if (!isValidPivot(d))
+            return AMICI_RECOVERABLE_ERROR;
+        d = 1.0 / d;
+    }
+    return AMICI_SUCCESS;
+}
+
+void JacobiPreconditioner::solve(gsl::span<const realtype> r,
+                                 gsl::span<realtype> z) const {
+    for (sunindextype i = 0; i < n_; ++i)
+        z[i] = inv_diag_[i] * r[i];
+}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(sunindextype n,
+                                                     sunindextype nnz,
+                                                     sunindextype block_size)
+    : Preconditioner(n, nnz), block_size_(std::max<sunindextype>(block_size, 1)),
+      lu_(((n + block_size_ - 1) / block_size_) * block_size_ * block_size_),
+      pivots_(n) {}
+
+int BlockJacobiPreconditioner::setup(realtype alpha, realtype beta) {
+    for (sunindextype offset = 0; offset < n_; offset += block_size_) {
+        auto m = std::min(block_size_, n_ - offset);
+        auto block = &lu_.at(offset * block_size_);
+
+        /* assemble dense diagonal block (row-major) */
+        std::fill_n(block, m * m, 0.0);
+        for (sunindextype i = 0; i < m; ++i)
+            block[i * m + i] = alpha;
+        for (sunindextype icol = offset; icol < offset + m; ++icol) {
+            for (auto idx = J_.get_indexptr(icol);
+                 idx < J_.get_indexptr(icol + 1); ++idx) {
+                auto irow = J_.get_indexval(idx);
+                if (irow >= offset && irow < offset + m)
+                    block[(irow - offset) * m + (icol - offset)] +=
+                        beta * J_.get_data(idx);
+            }
+        }
+
+        /* LU factorization with partial pivoting */
+        for (sunindextype k = 0; k < m; ++k) {
+            auto piv = k;
+            for (auto i = k + 1; i < m; ++i)
+                if (std::abs(block[i * m + k]) > std::abs(block[piv * m + k]))
+                    piv = i;
+            pivots_[offset + k] = piv;
+            if (!isValidPivot(block[piv * m + k]))
+                return AMICI_RECOVERABLE_ERROR;
+            if (piv != k)
+                std::swap_ranges(block + k * m, block + (k + 1) * m,
+                                 block + piv * m);
+            for (auto i = k + 1; i < m; ++i) {
+                block[i * m + k] /= block[k * m + k];
+                for (auto j = k + 1; j < m; ++j)
+                    block[i * m + j] -= block[i * m + k] * block[k * m + j];
+            }
+        }
+    }
+    return AMICI_SUCCESS;
+}
+
+void BlockJacobiPreconditioner::solve(gsl::span<const realtype> r,
+                                      gsl::span<realtype> z) const {
+    std::copy_n(r.begin(), n_, z.begin());
+    for (sunindextype offset = 0; offset < n_; offset += block_size_) {
+        auto m = std::min(block_size_, n_ - offset);
+        auto block = &lu_.at(offset * block_size_);
+        auto zb = &z[offset];
+
+        for (sunindextype k = 0; k < m; ++k)
+            std::swap(zb[k], zb[pivots_[offset + k]]);
+        for (sunindextype i = 1; i < m; ++i)
+            for (sunindextype j = 0; j < i; ++j)
+                zb[i] -= block[i * m + j] * zb[j];
+        for (auto i = m - 1; i >= 0; --i) {
+            for (auto j = i + 1; j < m; ++j)
+                zb[i] -= block[i * m + j] * zb[j];
+            zb[i] /= block[i * m + i];
+        }
+    }
+}
+
+ILUPreconditioner::ILUPreconditioner(sunindextype n, sunindextype nnz)
+    : Preconditioner(n, nnz), row_ptrs_(n + 1), diag_idxs_(n), work_(n, -1) {}
+
+int ILUPreconditioner::setup(realtype alpha, realtype beta) {
+    /* Transpose the CSC pattern of J to CSR, adding missing diagonal
+     * entries. Columns are visited in ascending order, so column indices
+     * within each row end up sorted. */
+    std::fill(row_ptrs_.begin(), row_ptrs_.end(), 0);
+    for (sunindextype icol = 0; icol < n_; ++icol) {
+        bool has_diag = false;
+        for (auto idx = J_.get_indexptr(icol);
+             idx < J_.get_indexptr(icol + 1); ++idx) {
+            auto irow = J_.get_indexval(idx);
+            ++row_ptrs_[irow + 1];
+            has_diag = has_diag || irow == icol;
+        }
+        if (!has_diag)
+            ++row_ptrs_[icol + 1];
+    }
+    for (sunindextype i = 0; i < n_; ++i)
+        row_ptrs_[i + 1] += row_ptrs_[i];
+
+    col_idxs_.resize(row_ptrs_[n_]);
+    values_.resize(row_ptrs_[n_]);
+    work_.assign(row_ptrs_.begin(), row_ptrs_.end() - 1);
+    for (sunindextype icol = 0; icol < n_; ++icol) {
+        bool has_diag = false;
+        for (auto idx = J_.get_indexptr(icol);
+             idx < J_.get_indexptr(icol + 1); ++idx) {
+            auto irow = J_.get_indexval(idx);
+            auto pos = work_[irow]++;
+            col_idxs_[pos] = icol;
+            values_[pos] = beta * J_.get_data(idx);
+            if (irow == icol) {
+                values_[pos] += alpha;
+                diag_idxs_[icol] = pos;
+                has_diag = true;
+            }
+        }
+        if (!has_diag) {
+            auto pos = work_[icol]++;
+            col_idxs_[pos] = icol;
+            values_[pos] = alpha;
+            diag_idxs_[icol] = pos;
+        }
+    }
+
+    /* ILU(0), IKJ variant */
+    std::fill(work_.begin(), work_.end(), -1);
+    for (sunindextype i = 0; i < n_; ++i) {
+        for (auto p = row_ptrs_[i]; p < row_ptrs_[i + 1]; ++p)
+            work_[col_idxs_[p]] = p;
+
+        for (auto p = row_ptrs_[i]; p < diag_idxs_[i]; ++p) {
+            auto k = col_idxs_[p];
+            values_[p] /= values_[diag_idxs_[k]];
+            for (auto q = diag_idxs_[k] + 1; q < row_ptrs_[k + 1]; ++q) {
+                auto pos = work_[col_idxs_[q]];
+                if (pos >= 0)
+                    values_[pos] -= values_[p] * values_[q];
+            }
+        }
+
+        for (auto p = row_ptrs_[i]; p < row_ptrs_[i + 1]; ++p)
+            work_[col_idxs_[p]] = -1;
+
+        if (!isValidPivot(values_[diag_idxs_[i]]))
+            return AMICI_RECOVERABLE_ERROR;
+    }
+    return AMICI_SUCCESS;
+}
+
+void ILUPreconditioner::solve(gsl::span<const realtype> r,
+                              gsl::span<realtype> z) const {
+    /* L y = r, L with unit diagonal */
+    for (sunindextype i = 0; i < n_; ++i) {
+        auto zi = r[i];
+        for (auto p = row_ptrs_[i]; p < diag_idxs_[i]; ++p)
+            zi -= values_[p] * z[col_idxs_[p]];
+        z[i] = zi;
+    }
+    /* U z = y */
+    for (auto i = n_ - 1; i >= 0; --i) {
+        auto zi = z[i];
+        for (auto p = diag_idxs_[i] + 1; p < row_ptrs_[i + 1]; ++p)
+            zi -= values_[p] * z[col_idxs_[p]];
+        z[i] = zi / values_[diag_idxs_[i]];
+    }
+}
+
+} // namespace amici
@@ -10,8 +10,10 @@
 #include "amici/steadystateproblem.h"
 #include "amici/symbolic_functions.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
+#include <limits>
 
 namespace amici {
 
@@ -162,6 +164,9 @@ void ReturnData::processSimulationObjects(SteadystateProblem const *preeq,
     if (preeq)
         processPreEquilibration(*preeq, model);
 
+    if (fwd && edata && model.hasInnerParameters())
+        fitInnerParameters(*fwd, posteq, model, *edata);
+
     if (fwd)
         processForwardProblem(*fwd, model, edata);
     else
@@ -183,6 +188,59 @@ void ReturnData::processSimulationObjects(SteadystateProblem const *preeq,
     applyChainRuleFactorToSimulationResults(model);
 }
 
+void ReturnData::checkInnerParameters(Model const &model,
+                                      ExpData const &edata) const {
+    if (sensi >= SensitivityOrder::second
+        || (sensi >= SensitivityOrder::first
+            && sensi_meth == SensitivityMethod::adjoint))
+        throw AmiException("Inner parameters are only supported with first "
+                           "order forward sensitivities.");
+    if (!model.hasQuadraticLLH())
+        throw AmiException("Inner parameters are only supported for "
+                           "Gaussian noise.");
+
+    auto const &scaling_idxs = model.getInnerScalingParameters();
+    auto const &offset_idxs = model.getInnerOffsetParameters();
+    auto const &sigma_idxs = model.getInnerSigmaParameters();
+    for (int iy = 0; iy < nytrue; ++iy) {
+        /* the closed-form solutions are for observables on linear scale */
+        if ((scaling_idxs.at(iy) >= 0 || offset_idxs.at(iy) >= 0
+             || sigma_idxs.at(iy) >= 0)
+            && model.getObservableScaling(iy) != ObservableScaling::lin)
+            throw AmiException("Observable %d has inner parameters, but is "
+                               "not on linear scale.", iy);
+        for (int jy = 0; jy < nytrue; ++jy) {
+            auto is = scaling_idxs.at(iy);
+            auto ib = offset_idxs.at(iy);
+            auto isigma = sigma_idxs.at(iy);
+            if ((is >= 0 && (is == offset_idxs.at(jy)
+                             || is == sigma_idxs.at(jy)))
+                || (ib >= 0 && ib == sigma_idxs.at(jy)))
+                throw AmiException("Parameter %d is used as different types "
+                                   "of inner parameters.",
+                                   is >= 0 ? is : ib);
+            /* otherwise, the inner problem has no closed-form solution */
+            auto shares_scaling_or_offset =
+                (is >= 0 && is == scaling_idxs.at(jy))
+                || (ib >= 0 && ib == offset_idxs.at(jy));
+            if (shares_scaling_or_offset
+                && (is != scaling_idxs.at(jy) || ib != offset_idxs.at(jy)
+                    || isigma != sigma_idxs.at(jy)))
+                throw AmiException("Observables %d and %d share inner "
+                                   "scaling or offset parameters, but not "
+                                   "all of their inner parameters.",
+                                   iy, jy);
+        }
+        if (sigma_idxs.at(iy) < 0)
+            continue;
+        for (int it = 0; it < nt; ++it)
+            if (edata.isSetObservedDataStdDev(it, iy))
+                throw AmiException("Observable %d has an inner noise "
+                                   "parameter, but standard deviations are "
+                                   "provided in ExpData.", iy);
+    }
+}
+
 void ReturnData::processPreEquilibration(SteadystateProblem const &preeq,
                                          Model &model) {
     readSimulationState(preeq.getFinalSimulationState(), model);
@@ -193,20 +251,23 @@ void ReturnData::processPreEquilibration(SteadystateProblem const &preeq,
     }
     if (!sx_ss.empty() && sensi >= SensitivityOrder::first) {
         model.fsx_rdata(sx_rdata_, sx_solver_, x_solver_);
-        for (int ip = 0; ip < nplist; ip++)
-            writeSlice(sx_rdata_[ip], slice(sx_ss, ip, nx));
+        writeSlice(sx_rdata_, sx_ss);
     }
     /* Get cpu time for Newton solve in milliseconds */
     preeq_cpu_time = preeq.getCPUTime();
     preeq_cpu_timeB = preeq.getCPUTimeB();
     preeq_numstepsB = preeq.getNumStepsB();
+    preeq_numjacevals = preeq.getNumJacobianEvaluations();
+    preeq_numfactorizations = preeq.getNumFactorizations();
+    preeq_ptc_numsteps = preeq.getNumPseudoTransientSteps();
+    preeq_ptc_numlinsolves = preeq.getNumPseudoTransientLinearSolves();
     preeq_wrms = preeq.getResidualNorm();
     preeq_status = preeq.getSteadyStateStatus();
     if (preeq_status[1] == SteadyStateStatus::success)
         preeq_t = preeq.getSteadyStateTime();
     if (!preeq_numsteps.empty())
         writeSlice(preeq.getNumSteps(), preeq_numsteps);
-    if (!preeq.getNumLinSteps().empty() && !preeq_numlinsteps.empty()) {
+    if (!preeq.getNumLinSteps().empty()) {
         preeq_numlinsteps.resize(newton_maxsteps * 2, 0);
         writeSlice(preeq.getNumLinSteps(), preeq_numlinsteps);
     }
@@ -225,13 +286,17 @@ void ReturnData::processPostEquilibration(SteadystateProblem const &posteq,
     posteq_cpu_time = posteq.getCPUTime();
     posteq_cpu_timeB = posteq.getCPUTimeB();
     posteq_numstepsB = posteq.getNumStepsB();
+    posteq_numjacevals = posteq.getNumJacobianEvaluations();
+    posteq_numfactorizations = posteq.getNumFactorizations();
+    posteq_ptc_numsteps = posteq.getNumPseudoTransientSteps();
+    posteq_ptc_numlinsolves = posteq.getNumPseudoTransientLinearSolves();
     posteq_wrms = posteq.getResidualNorm();
     posteq_status = posteq.getSteadyStateStatus();
     if (posteq_status[1] == SteadyStateStatus::success)
         posteq_t = posteq.getSteadyStateTime();
     if (!posteq_numsteps.empty())
         writeSlice(posteq.getNumSteps(), posteq_numsteps);
-    if (!posteq.getNumLinSteps().empty() && !posteq_numlinsteps.empty()) {
+    if (!posteq.getNumLinSteps().empty()) {
         posteq_numlinsteps.resize(newton_maxsteps * 2, 0);
         writeSlice(posteq.getNumLinSteps(), posteq_numlinsteps);
     }
@@ -242,6 +307,8 @@ void ReturnData::processForwardProblem(ForwardProblem const &fwd, Model &model,
     if (edata)
         initializeObjectiveFunction(model.hasQuadraticLLH());
 
+    numinterpolatedoutputs = fwd.getNumInterpolatedOutputs();
+
     auto initialState = fwd.getInitialSimulationState();
     if (initialState.x.getLength() == 0 && model.nx_solver > 0)
         return; // if x wasn't set forward problem failed during initialization
@@ -254,15 +321,16 @@ void ReturnData::processForwardProblem(ForwardProblem const &fwd, Model &model,
 
     if (!sx0.empty()) {
         model.fsx_rdata(sx_rdata_, sx_solver_, x_solver_);
-        for (int ip = 0; ip < nplist; ip++)
-            writeSlice(sx_rdata_[ip], slice(sx0, ip, nx));
+        writeSlice(sx_rdata_, sx0);
     }
 
     // process timepoint data
     realtype tf = fwd.getFinalTime();
+    SimulationState state;
     for (int it = 0; it < model.nt(); it++) {
         if (model.getTimepoint(it) <= tf) {
-            readSimulationState(fwd.getSimulationStateTimepoint(it), model);
+            fwd.getSimulationStateTimepoint(it, state);
+            readSimulationState(state, model);
             getDataOutput(it, model, edata);
         } else {
             // check for integration failure but consider postequilibration
@@ -281,6 +349,165 @@ void ReturnData::processForwardProblem(ForwardProblem const &fwd, Model &model,
     }
 }
 
+void ReturnData::fitInnerParameters(ForwardProblem const &fwd,
+                                    SteadystateProblem const *posteq,
+                                    Model &model, ExpData const &edata) {
+    auto const &scaling_idxs = model.getInnerScalingParameters();
+    auto const &offset_idxs = model.getInnerOffsetParameters();
+    auto const &sigma_idxs = model.getInnerSigmaParameters();
+
+    /* Observables are y = c + s * h + b. c and h are obtained from
+     * evaluating y for s = 0 and s = 1 with b = 0. Inner noise parameters
+     * don't affect y. */
+    inner_parameters.assign(np, getNaN());
+    for (int iy = 0; iy < nytrue; ++iy) {
+        if (scaling_idxs.at(iy) >= 0)
+            inner_parameters.at(scaling_idxs.at(iy)) = 0.0;
+        if (offset_idxs.at(iy) >= 0)
+            inner_parameters.at(offset_idxs.at(iy)) = 0.0;
+        if (sigma_idxs.at(iy) >= 0)
+            inner_parameters.at(sigma_idxs.at(iy)) = 1.0;
+    }
+    auto setScaling = [&](realtype s) {
+        for (auto is : scaling_idxs)
+            if (is >= 0)
+                inner_parameters.at(is) = s;
+    };
+
+    /* c, h and weights 1/sigma^2 (1 for inner noise parameters, which are
+     * identical for all data points entering a least squares problem) */
+    std::vector<realtype> c(nt * nytrue, getNaN());
+    std::vector<realtype> h(nt * nytrue, getNaN());
+    std::vector<realtype> w(nt * nytrue, 1.0);
+    std::vector<realtype> y_it(ny);
+    std::vector<realtype> sigmay_it(ny);
+    SimulationState state;
+    realtype tf = fwd.getFinalTime();
+    for (int it = 0; it < nt; ++it) {
+        auto t = model.getTimepoint(it);
+        setScaling(0.0);
+        if (std::isinf(t) && posteq) {
+            readSimulationState(posteq->getFinalSimulationState(), model);
+        } else if (t <= tf) {
+            fwd.getSimulationStateTimepoint(it, state);
+            readSimulationState(state, model);
+        } else {
+            continue;
+        }
+
+        model.getObservable(y_it, t, x_solver_);
+        std::copy_n(y_it.begin(), nytrue, &c.at(it * nytrue));
+
+        setScaling(1.0);
+        applyInnerParameters(model);
+        model.getObservable(y_it, t, x_solver_);
+        model.getObservableSigma(sigmay_it, it, &edata);
+        for (int iy = 0; iy < nytrue; ++iy) {
+            h.at(it * nytrue + iy) = y_it.at(iy) - c.at(it * nytrue + iy);
+            if (sigma_idxs.at(iy) < 0)
+                w.at(it * nytrue + iy) = 1.0 / std::pow(sigmay_it.at(iy), 2);
+        }
+    }
+
+    /* parameters that don't affect any data point keep their values */
+    auto const &p = fwd.getInitialSimulationState().state.unscaledParameters;
+    auto hasData = [&](int it, int iy) {
+        return edata.isSetObservedData(it, iy)
+               && !isNaN(h.at(it * nytrue + iy));
+    };
+
+    /* scaling and offset parameters, weighted least squares */
+    std::vector<bool> done(nytrue, false);
+    for (int iy = 0; iy < nytrue; ++iy) {
+        auto is = scaling_idxs.at(iy);
+        auto ib = offset_idxs.at(iy);
+        if (done.at(iy) || (is < 0 && ib < 0))
+            continue;
+
+        realtype sw = 0.0, sh = 0.0, sm = 0.0, shh = 0.0, shm = 0.0;
+        for (int jy = iy; jy < nytrue; ++jy) {
+            if (scaling_idxs.at(jy) != is || offset_idxs.at(jy) != ib)
+                continue;
+            done.at(jy) = true;
+            for (int it = 0; it < nt; ++it) {
+                if (!hasData(it, jy))
+                    continue;
+                auto idx = it * nytrue + jy;
+                auto m = edata.getObservedDataPtr(it)[jy] - c.at(idx);
+                sw += w.at(idx);
+                sh += w.at(idx) * h.at(idx);
+                sm += w.at(idx) * m;
+                shh += w.at(idx) * h.at(idx) * h.at(idx);
+                shm += w.at(idx) * h.at(idx) * m;
+            }
+        }
+
+        if (sw == 0.0) {
+            if (is >= 0)
+                inner_parameters.at(is) = p.at(is);
+            if (ib >= 0)
+                inner_parameters.at(ib) = p.at(ib);
+        } else if (is >= 0 && ib >= 0) {
+            /* if h is constant, scaling and offset are not identifiable,
+               keep the scaling and fit the offset only */
+            auto det = sw * shh - sh * sh;
+            auto s = det > 100 * std::numeric_limits<realtype>::epsilon()
+                               * sw * shh
+                         ? (sw * shm - sh * sm) / det
+                         : p.at(is);
+            inner_parameters.at(is) = s;
+            inner_parameters.at(ib) = (sm - s * sh) / sw;
+        } else if (is >= 0) {
+            /* if h is zero, the scaling does not affect the data */
+            inner_parameters.at(is) = shh > 0.0 ? shm / shh : p.at(is);
+        } else {
+            /* h is zero without inner scaling parameter */
+            inner_parameters.at(ib) = sm / sw;
+        }
+    }
+
+    /* noise parameters, root mean square of the residuals */
+    std::fill(done.begin(), done.end(), false);
+    for (int iy = 0; iy < nytrue; ++iy) {
+        auto isigma = sigma_idxs.at(iy);
+        if (done.at(iy) || isigma < 0)
+            continue;
+
+        int n = 0;
+        realtype srr = 0.0;
+        for (int jy = iy; jy < nytrue; ++jy) {
+            if (sigma_idxs.at(jy) != isigma)
+                continue;
+            done.at(jy) = true;
+            auto s = scaling_idxs.at(jy) >= 0
+                         ? inner_parameters.at(scaling_idxs.at(jy))
+                         : 0.0;
+            auto b = offset_idxs.at(jy) >= 0
+                         ? inner_parameters.at(offset_idxs.at(jy))
+                         : 0.0;
+            for (int it = 0; it < nt; ++it) {
+                if (!hasData(it, jy))
+                    continue;
+                auto idx = it * nytrue + jy;
+                auto r = edata.getObservedDataPtr(it)[jy] - c.at(idx)
+                         - s * h.at(idx) - b;
+                srr += r * r;
+                ++n;
+            }
+        }
+        inner_parameters.at(isigma) = n ? std::sqrt(srr / n) : p.at(isigma);
+    }
+}
+
+void ReturnData::applyInnerParameters(Model &model) {
+    inner_model_state_ = model.getModelState();
+    for (int ip = 0; ip < static_cast<int>(inner_parameters.size()); ++ip)
+        if (!isNaN(inner_parameters.at(ip)))
+            inner_model_state_.unscaledParameters.at(ip) =
+                inner_parameters.at(ip);
+    model.setModelState(inner_model_state_);
+}
+
 void ReturnData::getDataOutput(int it, Model &model, ExpData const *edata) {
     if (!x.empty()) {
         model.fx_rdata(x_rdata_, x_solver_);
@@ -319,10 +546,7 @@ void ReturnData::getDataOutput(int it, Model &model, ExpData const *edata) {
 void ReturnData::getDataSensisFSA(int it, Model &model, ExpData const *edata) {
     if (!sx.empty()) {
         model.fsx_rdata(sx_rdata_, sx_solver_, x_solver_);
-        for (int ip = 0; ip < nplist; ip++) {
-            writeSlice(sx_rdata_[ip],
-                       slice(sx, it * nplist + ip, nx));
-        }
+        writeSlice(sx_rdata_, slice(sx, it, nplist * nx));
     }
 
     if (!sy.empty()) {
@@ -528,6 +752,9 @@ void ReturnData::processSolver(Solver const &solver) {
     }
 
     cpu_timeB = solver.getCpuTimeB();
+    numcheckpoints = solver.getNumCheckpoints();
+    numrecomputedrhsevals =
+        static_cast<int>(solver.getNumRecomputedRhsEvals());
 
     if (!numstepsB.empty()) {
         tmp = &solver.getNumStepsB();
@@ -559,6 +786,8 @@ void ReturnData::readSimulationState(SimulationState const &state,
         sx_solver_ = state.sx;
     t_ = state.t;
     model.setModelState(state.state);
+    if (!inner_parameters.empty())
+        applyInnerParameters(model);
 }
 
 void ReturnData::invalidate(const int it_start) {
@@ -101,7 +101,7 @@ mxArray *initMatlabReturnFields(ReturnData const *rdata) {
 }
 
 mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
-    const int numFields = 27;
+    const int numFields = 38;
     const char *field_names_sol[numFields] = {"xdot",
                                               "J",
                                               "numsteps",
@@ -109,14 +109,21 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
                                               "numerrtestfails",
                                               "numnonlinsolvconvfails",
                                               "order",
+                                              "numinterpolatedoutputs",
                                               "numstepsB",
                                               "numrhsevalsB",
                                               "numerrtestfailsB",
                                               "numnonlinsolvconvfailsB",
+                                              "numcheckpoints",
+                                              "numrecomputedrhsevals",
                                               "preeq_status",
                                               "preeq_numsteps",
                                               "preeq_numstepsB",
                                               "preeq_numlinsteps",
+                                              "preeq_numjacevals",
+                                              "preeq_numfactorizations",
+                                              "preeq_ptc_numsteps",
+                                              "preeq_ptc_numlinsolves",
                                               "preeq_cpu_time",
                                               "preeq_cpu_timeB",
                                               "preeq_t",
@@ -125,6 +132,10 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
                                               "posteq_numsteps",
                                               "posteq_numstepsB",
                                               "posteq_numlinsteps",
+                                              "posteq_numjacevals",
+                                              "posteq_numfactorizations",
+                                              "posteq_ptc_numsteps",
+                                              "posteq_ptc_numlinsolves",
                                               "posteq_cpu_time",
                                               "posteq_cpu_timeB",
                                               "posteq_t",
@@ -161,6 +172,8 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
         matlabDiagnosisStruct, "order",
         gsl::make_span(rdata->order).subspan(0, finite_nt),
         finite_nt);
+    writeMatlabField0(matlabDiagnosisStruct, "numinterpolatedoutputs",
+                      rdata->numinterpolatedoutputs);
 
     if (rdata->nx > 0) {
         writeMatlabField1(matlabDiagnosisStruct, "xdot", gsl::make_span(rdata->xdot), rdata->nx_solver);
@@ -173,6 +186,10 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
                           rdata->preeq_numlinsteps.size() > 0
                               ? rdata->newton_maxsteps : 0, 2, perm1);
         writeMatlabField0(matlabDiagnosisStruct, "preeq_numstepsB", rdata->preeq_numstepsB);
+        writeMatlabField0(matlabDiagnosisStruct, "preeq_numjacevals", rdata->preeq_numjacevals);
+        writeMatlabField0(matlabDiagnosisStruct, "preeq_numfactorizations", rdata->preeq_numfactorizations);
+        writeMatlabField0(matlabDiagnosisStruct, "preeq_ptc_numsteps", rdata->preeq_ptc_numsteps);
+        writeMatlabField0(matlabDiagnosisStruct, "preeq_ptc_numlinsolves", rdata->preeq_ptc_numlinsolves);
         writeMatlabField0(matlabDiagnosisStruct, "preeq_cpu_time", rdata->preeq_cpu_time);
         writeMatlabField0(matlabDiagnosisStruct, "preeq_cpu_timeB", rdata->preeq_cpu_timeB);
         writeMatlabField0(matlabDiagnosisStruct, "preeq_t", rdata->preeq_t);
@@ -185,6 +202,10 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
                           rdata->posteq_numlinsteps.size() > 0
                               ? rdata->newton_maxsteps : 0, 2, perm1);
         writeMatlabField0(matlabDiagnosisStruct, "posteq_numstepsB", rdata->posteq_numstepsB);
+        writeMatlabField0(matlabDiagnosisStruct, "posteq_numjacevals", rdata->posteq_numjacevals);
+        writeMatlabField0(matlabDiagnosisStruct, "posteq_numfactorizations", rdata->posteq_numfactorizations);
+        writeMatlabField0(matlabDiagnosisStruct, "posteq_ptc_numsteps", rdata->posteq_ptc_numsteps);
+        writeMatlabField0(matlabDiagnosisStruct, "posteq_ptc_numlinsolves", rdata->posteq_ptc_numlinsolves);
         writeMatlabField0(matlabDiagnosisStruct, "posteq_cpu_time", rdata->posteq_cpu_time);
         writeMatlabField0(matlabDiagnosisStruct, "posteq_cpu_timeB", rdata->posteq_cpu_timeB);
         writeMatlabField0(matlabDiagnosisStruct, "posteq_t", rdata->posteq_t);
@@ -209,6 +230,10 @@ mxArray *initMatlabDiagnosisFields(ReturnData const *rdata) {
                 gsl::make_span(rdata->numnonlinsolvconvfailsB
                                ).subspan(0, finite_nt),
                 finite_nt);
+            writeMatlabField0(matlabDiagnosisStruct, "numcheckpoints",
+                              rdata->numcheckpoints);
+            writeMatlabField0(matlabDiagnosisStruct, "numrecomputedrhsevals",
+                              rdata->numrecomputedrhsevals);
         }
     }
 
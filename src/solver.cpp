@@ -4,15 +4,27 @@
 #include "amici/misc.h"
 #include "amici/model.h"
 #include "amici/rdata.h"
+#include "amici/steadystateproblem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
 #include <memory>
+#include <numeric>
 
 namespace amici {
 
-Solver::Solver(AmiciApplication *app) : app(app)
+Solver::Solver()
+    : steady_state_warm_start_(std::make_shared<SteadyStateWarmStart>())
+{
+
+}
+
+Solver::Solver(AmiciApplication *app)
+    : app(app),
+      steady_state_warm_start_(std::make_shared<SteadyStateWarmStart>())
 {
 
 }
@@ -20,16 +32,25 @@ Solver::Solver(AmiciApplication *app) : app(app)
 Solver::Solver(const Solver &other)
     : ism_(other.ism_), lmm_(other.lmm_), iter_(other.iter_),
       interp_type_(other.interp_type_), maxsteps_(other.maxsteps_),
+      checkpoint_memory_budget_(other.checkpoint_memory_budget_),
+      checkpoint_spill_(other.checkpoint_spill_),
       maxtime_(other.maxtime_), starttime_(other.starttime_),
       sensi_meth_(other.sensi_meth_), sensi_meth_preeq_(other.sensi_meth_preeq_),
-      stldet_(other.stldet_), ordering_(other.ordering_),
+      stldet_(other.stldet_), interpolated_output_(other.interpolated_output_),
+      ordering_(other.ordering_),
       newton_maxsteps_(other.newton_maxsteps_),
       newton_maxlinsteps_(other.newton_maxlinsteps_),
       newton_damping_factor_mode_(other.newton_damping_factor_mode_),
       newton_damping_factor_lower_bound_(other.newton_damping_factor_lower_bound_),
+      newton_jacobian_reuse_(other.newton_jacobian_reuse_),
+      steady_state_ptc_(other.steady_state_ptc_),
+      steady_state_concurrent_search_(other.steady_state_concurrent_search_),
+      steady_state_warm_start_mode_(other.steady_state_warm_start_mode_),
+      steady_state_warm_start_(other.steady_state_warm_start_),
       requires_preequilibration_(other.requires_preequilibration_),
-      linsol_(other.linsol_), atol_(other.atol_), rtol_(other.rtol_),
-      atol_fsa_(other.atol_fsa_), rtol_fsa_(other.rtol_fsa_),
+      linsol_(other.linsol_), preconditioner_type_(other.preconditioner_type_),
+      atol_(other.atol_), rtol_(other.rtol_), atol_fsa_(other.atol_fsa_),
+      rtol_fsa_(other.rtol_fsa_),
       atolB_(other.atolB_), rtolB_(other.rtolB_), quad_atol_(other.quad_atol_),
       quad_rtol_(other.quad_rtol_), ss_atol_(other.ss_atol_),
       ss_rtol_(other.ss_rtol_), ss_atol_sensi_(other.ss_atol_sensi_),
@@ -64,6 +85,14 @@ void Solver::apply_max_num_steps_B() const {
 }
 
 int Solver::run(const realtype tout) const {
+    return run(tout, AMICI_NORMAL);
+}
+
+int Solver::runOneStep(const realtype tstop) const {
+    return run(tstop, AMICI_ONE_STEP);
+}
+
+int Solver::run(const realtype tout, const int itask) const {
     setStopTime(tout);
     clock_t starttime = clock();
     int status = AMICI_SUCCESS;
@@ -71,9 +100,9 @@ int Solver::run(const realtype tout) const {
     apply_max_num_steps();
     if (nx() > 0) {
         if (getAdjInitDone()) {
-            status = solveF(tout, AMICI_NORMAL, &ncheckPtr_);
+            status = solveF(tout, itask, &ncheckPtr_);
         } else {
-            status = solve(tout, AMICI_NORMAL);
+            status = solve(tout, itask);
         }
     } else {
         t_ = tout;
@@ -103,7 +132,9 @@ void Solver::runB(const realtype tout) const {
 
     apply_max_num_steps_B();
     if (nx() > 0) {
+        auto num_rhs_evals = num_rhs_evals_;
         solveB(tout, AMICI_NORMAL);
+        num_rhs_evals_recomputed_ += num_rhs_evals_ - num_rhs_evals;
     }
     cpu_timeB_ += (realtype)((clock() - starttime) * 1000) / CLOCKS_PER_SEC;
     t_ = tout;
@@ -112,10 +143,13 @@ void Solver::runB(const realtype tout) const {
 void Solver::setup(const realtype t0, Model *model, const AmiVector &x0,
                    const AmiVector &dx0, const AmiVectorArray &sx0,
                    const AmiVectorArray &sdx0) const {
+    auto sens_idxs = model->getNonzeroStateSensitivityIndices();
+    /* the number of sensitivities cannot be changed after initialization */
     if (nx() != model->nx_solver || nplist() != model->nplist() ||
-        nquad() != model->nJ * model->nplist()) {
+        nquad() != model->nJ * model->nplist() || sens_idxs != sens_idxs_) {
         resetMutableMemory(model->nx_solver, model->nplist(),
                            model->nJ * model->nplist());
+        sens_idxs_ = std::move(sens_idxs);
     }
     /* Create solver memory object if necessary */
     allocateSolver();
@@ -139,7 +173,11 @@ void Solver::setup(const realtype t0, Model *model, const AmiVector &x0,
     /* activates stability limit detection */
     setStabLimDet(stldet_);
 
-    rootInit(model->ne);
+    /* time-triggered events don't need root finding */
+    rootInit(static_cast<int>(model->getTimeTriggeredEvents().size())
+                     == model->ne
+                 ? 0
+                 : model->ne);
 
     if (nx() == 0)
         return;
@@ -152,15 +190,21 @@ void Solver::setup(const realtype t0, Model *model, const AmiVector &x0,
         auto plist = model->getParameterList();
         sensInit1(sx0, sdx0);
         if (sensi_meth_ == SensitivityMethod::forward && !plist.empty()) {
-            /* Set sensitivity analysis optional inputs */
-            auto par = model->getUnscaledParameters();
-
-            /* Activate sensitivity calculations  and apply tolerances */
-            initializeNonLinearSolverSens(model);
-            setSensParams(par.data(), nullptr, plist.data());
-            applyTolerancesFSA();
+            if (nsens() > 0) {
+                /* Set sensitivity analysis optional inputs */
+                auto par = model->getUnscaledParameters();
+                std::vector<int> sens_plist(nsens());
+                for (int is = 0; is < nsens(); ++is)
+                    sens_plist[is] = plist.at(sens_idxs_[is]);
+
+                /* Activate sensitivity calculations  and apply tolerances */
+                initializeNonLinearSolverSens();
+                setSensParams(par.data(), nullptr, sens_plist.data());
+                applyTolerancesFSA();
+            }
         } else {
             /* Allocate space for the adjoint computation */
+            steps_per_checkpoint_ = computeStepsPerCheckpoint(model);
             adjInit();
         }
     }
@@ -246,6 +290,9 @@ void Solver::resetDiagnosis() const {
     nrhsB_.clear();
     netfB_.clear();
     nnlscfB_.clear();
+
+    ncheckPtr_ = 0;
+    num_rhs_evals_recomputed_ = 0;
 }
 
 void Solver::storeDiagnosis() const {
@@ -300,6 +347,8 @@ void Solver::storeDiagnosisB(const int which) const {
 }
 
 void Solver::initializeLinearSolver(const Model *model) const {
+    auto pretype = preconditioner_type_ == PreconditionerType::none
+                       ? PREC_NONE : PREC_LEFT;
     switch (linsol_) {
 
         /* DIRECT SOLVERS */
@@ -331,21 +380,24 @@ void Solver::initializeLinearSolver(const Model *model) const {
         /* ITERATIVE SOLVERS */
 
     case LinearSolver::SPGMR:
-        linear_solver_ = std::make_unique<SUNLinSolSPGMR>(x_);
+        linear_solver_ = std::make_unique<SUNLinSolSPGMR>(x_, pretype);
         setLinearSolver();
         setJacTimesVecFn();
+        setPreconditionerFn(model);
         break;
 
     case LinearSolver::SPBCG:
-        linear_solver_ = std::make_unique<SUNLinSolSPBCGS>(x_);
+        linear_solver_ = std::make_unique<SUNLinSolSPBCGS>(x_, pretype);
         setLinearSolver();
         setJacTimesVecFn();
+        setPreconditionerFn(model);
         break;
 
     case LinearSolver::SPTFQMR:
-        linear_solver_ = std::make_unique<SUNLinSolSPTFQMR>(x_);
+        linear_solver_ = std::make_unique<SUNLinSolSPTFQMR>(x_, pretype);
         setLinearSolver();
         setJacTimesVecFn();
+        setPreconditionerFn(model);
         break;
 
         /* SPARSE SOLVERS */
@@ -394,6 +446,8 @@ void Solver::initializeNonLinearSolver() const {
 
 void Solver::initializeLinearSolverB(const Model *model,
                                      const int which) const {
+    auto pretype = preconditioner_type_ == PreconditionerType::none
+                       ? PREC_NONE : PREC_LEFT;
     switch (linsol_) {
     /* DIRECT SOLVERS */
     case LinearSolver::dense:
@@ -423,21 +477,24 @@ void Solver::initializeLinearSolverB(const Model *model,
         /* ITERATIVE SOLVERS */
 
     case LinearSolver::SPGMR:
-        linear_solver_B_ = std::make_unique<SUNLinSolSPGMR>(xB_);
+        linear_solver_B_ = std::make_unique<SUNLinSolSPGMR>(xB_, pretype);
         setLinearSolverB(which);
         setJacTimesVecFnB(which);
+        setPreconditionerFnB(model, which);
         break;
 
     case LinearSolver::SPBCG:
-        linear_solver_B_ = std::make_unique<SUNLinSolSPBCGS>(xB_);
+        linear_solver_B_ = std::make_unique<SUNLinSolSPBCGS>(xB_, pretype);
         setLinearSolverB(which);
         setJacTimesVecFnB(which);
+        setPreconditionerFnB(model, which);
         break;
 
     case LinearSolver::SPTFQMR:
-        linear_solver_B_ = std::make_unique<SUNLinSolSPTFQMR>(xB_);
+        linear_solver_B_ = std::make_unique<SUNLinSolSPTFQMR>(xB_, pretype);
         setLinearSolverB(which);
         setJacTimesVecFnB(which);
+        setPreconditionerFnB(model, which);
         break;
 
         /* SPARSE SOLVERS */
@@ -488,14 +545,24 @@ bool operator==(const Solver &a, const Solver &b) {
 
     return (a.interp_type_ == b.interp_type_) && (a.lmm_ == b.lmm_) &&
            (a.iter_ == b.iter_) && (a.stldet_ == b.stldet_) &&
+           (a.interpolated_output_ == b.interpolated_output_) &&
            (a.ordering_ == b.ordering_) &&
            (a.newton_maxsteps_ == b.newton_maxsteps_) &&
            (a.newton_maxlinsteps_ == b.newton_maxlinsteps_) &&
            (a.newton_damping_factor_mode_ == b.newton_damping_factor_mode_) &&
            (a.newton_damping_factor_lower_bound_ == b.newton_damping_factor_lower_bound_) &&
+           (a.newton_jacobian_reuse_ == b.newton_jacobian_reuse_) &&
+           (a.steady_state_ptc_ == b.steady_state_ptc_) &&
+           (a.steady_state_concurrent_search_ ==
+            b.steady_state_concurrent_search_) &&
+           (a.steady_state_warm_start_mode_ == b.steady_state_warm_start_mode_) &&
            (a.requires_preequilibration_ == b.requires_preequilibration_) && (a.ism_ == b.ism_) &&
-           (a.linsol_ == b.linsol_) && (a.atol_ == b.atol_) && (a.rtol_ == b.rtol_) &&
+           (a.linsol_ == b.linsol_) &&
+           (a.preconditioner_type_ == b.preconditioner_type_) &&
+           (a.atol_ == b.atol_) && (a.rtol_ == b.rtol_) &&
            (a.maxsteps_ == b.maxsteps_) && (a.maxstepsB_ == b.maxstepsB_) &&
+           (a.checkpoint_memory_budget_ == b.checkpoint_memory_budget_) &&
+           (a.checkpoint_spill_ == b.checkpoint_spill_) &&
            (a.quad_atol_ == b.quad_atol_) && (a.quad_rtol_ == b.quad_rtol_) &&
            (a.maxtime_ == b.maxtime_) &&
            (a.getAbsoluteToleranceSteadyState() ==
@@ -532,8 +599,8 @@ void Solver::applyTolerancesFSA() const {
     if (sensi_ < SensitivityOrder::first)
         return;
 
-    if (nplist()) {
-        std::vector<realtype> atols(nplist(), getAbsoluteToleranceFSA());
+    if (nsens()) {
+        std::vector<realtype> atols(nsens(), getAbsoluteToleranceFSA());
         setSensSStolerances(getRelativeToleranceFSA(), atols.data());
         setSensErrCon(true);
     }
@@ -655,6 +722,44 @@ void Solver::setNewtonDampingFactorLowerBound(double dampingFactorLowerBound) {
   newton_damping_factor_lower_bound_ = dampingFactorLowerBound;
 }
 
+bool Solver::getNewtonJacobianReuse() const { return newton_jacobian_reuse_; }
+
+void Solver::setNewtonJacobianReuse(bool reuse) {
+    newton_jacobian_reuse_ = reuse;
+}
+
+bool Solver::getSteadyStatePseudoTransientContinuation() const {
+    return steady_state_ptc_;
+}
+
+void Solver::setSteadyStatePseudoTransientContinuation(bool ptc) {
+    steady_state_ptc_ = ptc;
+}
+
+bool Solver::getSteadyStateConcurrentSearch() const {
+    return steady_state_concurrent_search_;
+}
+
+void Solver::setSteadyStateConcurrentSearch(bool concurrent) {
+    steady_state_concurrent_search_ = concurrent;
+}
+
+SteadyStateWarmStartMode Solver::getSteadyStateWarmStartMode() const {
+    return steady_state_warm_start_mode_;
+}
+
+void Solver::setSteadyStateWarmStartMode(SteadyStateWarmStartMode mode) {
+    steady_state_warm_start_mode_ = mode;
+}
+
+void Solver::resetSteadyStateWarmStart() {
+    steady_state_warm_start_->clear();
+}
+
+SteadyStateWarmStart &Solver::getSteadyStateWarmStart() const {
+    return *steady_state_warm_start_;
+}
+
 SensitivityOrder Solver::getSensitivityOrder() const { return sensi_; }
 
 void Solver::setSensitivityOrder(const SensitivityOrder sensi) {
@@ -857,6 +962,14 @@ bool Solver::timeExceeded() const
     return std::chrono::system_clock::now() - starttime_ > maxtime_;
 }
 
+void Solver::countRhsEval() const { ++num_rhs_evals_; }
+
+int Solver::getNumCheckpoints() const { return ncheckPtr_; }
+
+long int Solver::getNumRecomputedRhsEvals() const {
+    return num_rhs_evals_recomputed_;
+}
+
 void Solver::setMaxSteps(const long int maxsteps) {
     if (maxsteps <= 0)
         throw AmiException("maxsteps must be a positive number");
@@ -875,6 +988,77 @@ void Solver::setMaxStepsBackwardProblem(const long int maxsteps) {
     maxstepsB_ = maxsteps;
 }
 
+long int Solver::getCheckpointMemoryBudget() const {
+    return checkpoint_memory_budget_;
+}
+
+void Solver::setCheckpointMemoryBudget(const long int budget) {
+    if (budget < 0)
+        throw AmiException("budget must be a non-negative number");
+
+    checkpoint_memory_budget_ = budget;
+    if (getAdjInitDone())
+        resetMutableMemory(nx(), nplist(), nquad());
+}
+
+bool Solver::getCheckpointSpill() const { return checkpoint_spill_; }
+
+void Solver::setCheckpointSpill(const bool spill) {
+    checkpoint_spill_ = spill;
+    if (getAdjInitDone())
+        resetMutableMemory(nx(), nplist(), nquad());
+}
+
+int Solver::computeStepsPerCheckpoint(const Model *model) const {
+    if (checkpoint_memory_budget_ == 0 || nx() == 0)
+        return static_cast<int>(maxsteps_);
+
+    if (model->ne > 0) {
+        /* state updates at events cannot be recomputed from checkpoints */
+        app->warning("AMICI:checkpointing",
+                     "Checkpoint memory budget is not supported for models "
+                     "with events and will be ignored.");
+        return static_cast<int>(maxsteps_);
+    }
+
+    /* For nd steps per checkpoint and n = maxsteps steps in total, the
+     * memory required is about n / nd * c for the checkpoints (Nordsieck
+     * history array) plus nd * d for the interpolation data of a single
+     * checkpoint interval. Choose the largest nd with
+     * n / nd * c + nd * d <= budget, minimizing recomputation. If
+     * checkpoints are spilled, at most two of them are kept in memory. */
+    auto vector_size = static_cast<double>(nx() * sizeof(realtype));
+    auto d = (interp_type_ == InterpolationType::hermite ? 2 : 1) * vector_size;
+    auto c = (lmm_ == LinearMultistepMethod::adams ? 12 + 1 : 5 + 1) *
+             vector_size;
+    auto n = static_cast<double>(maxsteps_);
+    auto b = static_cast<double>(checkpoint_memory_budget_);
+
+    double nd;
+    if (checkpoint_spill_) {
+        nd = (b - 2.0 * c) / d;
+        if (nd < 1.0)
+            app->warningF("AMICI:checkpointing",
+                          "Checkpoint memory budget of %ld bytes is "
+                          "insufficient, using %.0f bytes.",
+                          checkpoint_memory_budget_, 2.0 * c + d);
+        return static_cast<int>(std::max(1.0, std::min(nd, n)));
+    }
+
+    auto disc = b * b - 4.0 * d * n * c;
+    if (disc >= 0) {
+        nd = (b + std::sqrt(disc)) / (2.0 * d);
+    } else {
+        nd = std::sqrt(n * c / d);
+        app->warningF("AMICI:checkpointing",
+                      "Checkpoint memory budget of %ld bytes is insufficient "
+                      "for %ld steps, using %.0f bytes.",
+                      checkpoint_memory_budget_, maxsteps_,
+                      2.0 * std::sqrt(n * c * d));
+    }
+    return static_cast<int>(std::max(1.0, std::min(nd, n)));
+}
+
 LinearMultistepMethod Solver::getLinearMultistepMethod() const { return lmm_; }
 
 void Solver::setLinearMultistepMethod(const LinearMultistepMethod lmm) {
@@ -935,6 +1119,12 @@ void Solver::setStabilityLimitFlag(const bool stldet) {
     }
 }
 
+bool Solver::getInterpolatedOutput() const { return interpolated_output_; }
+
+void Solver::setInterpolatedOutput(const bool interpolated_output) {
+    interpolated_output_ = interpolated_output;
+}
+
 LinearSolver Solver::getLinearSolver() const { return linsol_; }
 
 void Solver::setLinearSolver(LinearSolver linsol) {
@@ -943,6 +1133,24 @@ void Solver::setLinearSolver(LinearSolver linsol) {
     linsol_ = linsol;
 }
 
+PreconditionerType Solver::getPreconditionerType() const {
+    return preconditioner_type_;
+}
+
+void Solver::setPreconditionerType(PreconditionerType type) {
+    if (solver_memory_)
+        resetMutableMemory(nx(), nplist(), nquad());
+    preconditioner_type_ = type;
+}
+
+Preconditioner *Solver::getPreconditioner() const {
+    return preconditioner_.get();
+}
+
+Preconditioner *Solver::getPreconditionerB() const {
+    return preconditioner_B_.get();
+}
+
 InternalSensitivityMethod Solver::getInternalSensitivityMethod() const {
     return ism_;
 }
@@ -965,14 +1173,14 @@ void Solver::setReturnDataReportingMode(RDataReporting rdrm) {
     rdata_mode_ = rdrm;
 }
 
-void Solver::initializeNonLinearSolverSens(const Model *model) const {
+void Solver::initializeNonLinearSolverSens() const {
     switch (iter_) {
     case NonlinearSolverIteration::newton:
         switch (ism_) {
         case InternalSensitivityMethod::staggered:
         case InternalSensitivityMethod::simultaneous:
             non_linear_solver_sens_ = std::make_unique<SUNNonLinSolNewton>(
-                1 + model->nplist(), x_.getNVector());
+                1 + nsens(), x_.getNVector());
             break;
         case InternalSensitivityMethod::staggered1:
             non_linear_solver_sens_ =
@@ -988,7 +1196,7 @@ void Solver::initializeNonLinearSolverSens(const Model *model) const {
         case InternalSensitivityMethod::staggered:
         case InternalSensitivityMethod::simultaneous:
             non_linear_solver_sens_ = std::make_unique<SUNNonLinSolFixedPoint>(
-                1 + model->nplist(), x_.getNVector());
+                1 + nsens(), x_.getNVector());
             break;
         case InternalSensitivityMethod::staggered1:
             non_linear_solver_sens_ =
@@ -1009,6 +1217,12 @@ void Solver::initializeNonLinearSolverSens(const Model *model) const {
 
 int Solver::nplist() const { return sx_.getLength(); }
 
+int Solver::nsens() const { return static_cast<int>(sens_idxs_.size()); }
+
+std::vector<int> const &Solver::getIntegratedSensitivityIndices() const {
+    return sens_idxs_;
+}
+
 int Solver::nx() const { return x_.getLength(); }
 
 int Solver::nquad() const { return xQB_.getLength(); }
@@ -1066,6 +1280,11 @@ realtype Solver::getCpuTimeB() const {
     return cpu_timeB_;
 }
 
+void Solver::resetCpuTime() const {
+    cpu_time_ = 0.0;
+    cpu_timeB_ = 0.0;
+}
+
 void Solver::resetMutableMemory(const int nx, const int nplist,
                                 const int nquad) const {
     solver_memory_ = nullptr;
@@ -1078,8 +1297,11 @@ void Solver::resetMutableMemory(const int nx, const int nplist,
 
     x_ = AmiVector(nx);
     dx_ = AmiVector(nx);
+    dky_ = AmiVector(nx);
     sx_ = AmiVectorArray(nx, nplist);
     sdx_ = AmiVectorArray(nx, nplist);
+    sens_idxs_.resize(nplist);
+    std::iota(sens_idxs_.begin(), sens_idxs_.end(), 0);
 
     xB_ = AmiVector(nx);
     dxB_ = AmiVector(nx);
@@ -1091,6 +1313,18 @@ void Solver::resetMutableMemory(const int nx, const int nplist,
     initializedQB_.clear();
 }
 
+N_Vector *
+Solver::getIntegratedSensitivities(AmiVectorArray &sx,
+                                   std::vector<N_Vector> &nvecs) const {
+    if (nsens() == sx.getLength())
+        return sx.getNVectorArray();
+
+    nvecs.resize(nsens());
+    for (int is = 0; is < nsens(); ++is)
+        nvecs[is] = sx.getNVector(sens_idxs_[is]);
+    return nvecs.data();
+}
+
 void Solver::writeSolution(realtype *t, AmiVector &x, AmiVector &dx,
                            AmiVectorArray &sx, AmiVector &xQ) const {
     *t = gett();
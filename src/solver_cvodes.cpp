@@ -64,13 +64,35 @@ static int fJBandB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
                    SUNMatrix JB, void *user_data, N_Vector tmp1B,
                    N_Vector tmp2B, N_Vector tmp3B);
 
+static int fJvSetup(realtype t, N_Vector x, N_Vector xdot,
+                    void *user_data);
+
 static int fJv(N_Vector v, N_Vector Jv, realtype t, N_Vector x,
                N_Vector xdot, void *user_data, N_Vector tmp);
 
+static int fJvSetupB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
+                     void *user_data);
+
 static int fJvB(N_Vector vB, N_Vector JvB, realtype t, N_Vector x,
                 N_Vector xB, N_Vector xBdot, void *user_data,
                 N_Vector tmpB);
 
+static int fPrecSetup(realtype t, N_Vector x, N_Vector xdot,
+                      booleantype jok, booleantype *jcurPtr, realtype gamma,
+                      void *user_data);
+
+static int fPrecSolve(realtype t, N_Vector x, N_Vector xdot, N_Vector r,
+                      N_Vector z, realtype gamma, realtype delta, int lr,
+                      void *user_data);
+
+static int fPrecSetupB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
+                       booleantype jokB, booleantype *jcurPtrB,
+                       realtype gammaB, void *user_data);
+
+static int fPrecSolveB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
+                       N_Vector rB, N_Vector zB, realtype gammaB,
+                       realtype deltaB, int lrB, void *user_data);
+
 static int froot(realtype t, N_Vector x, realtype *root, void *user_data);
 
 static int fxBdot(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
@@ -87,10 +109,14 @@ static int fJSparseB_ss(realtype t, N_Vector x, N_Vector xBdot,
                         SUNMatrix JB, void *user_data, N_Vector tmp1,
                         N_Vector tmp2, N_Vector tmp3);
 
-static int fsxdot(int Ns, realtype t, N_Vector x, N_Vector xdot, int ip,
+static int fsxdot(int Ns, realtype t, N_Vector x, N_Vector xdot, int is,
                   N_Vector sx, N_Vector sxdot, void *user_data,
                   N_Vector tmp1, N_Vector tmp2);
 
+static int fsxdot_block(int Ns, realtype t, N_Vector x, N_Vector xdot,
+                        N_Vector *sx, N_Vector *sxdot, void *user_data,
+                        N_Vector tmp1, N_Vector tmp2);
+
 
 /* Function implementations */
 
@@ -124,17 +150,26 @@ void CVodeSolver::sensInit1(const AmiVectorArray &sx0,
                             const AmiVectorArray & /*sdx0*/) const {
     int status = CV_SUCCESS;
     sx_ = sx0;
-    if (getSensitivityMethod() == SensitivityMethod::forward && nplist() > 0) {
+    if (getSensitivityMethod() == SensitivityMethod::forward && nsens() > 0) {
+        auto sx = getIntegratedSensitivities(sx_, sx_nvecs_);
         if (getSensInitDone()) {
             status = CVodeSensReInit(
                 solver_memory_.get(),
-                static_cast<int>(getInternalSensitivityMethod()),
-                sx_.getNVectorArray());
-        } else {
+                static_cast<int>(getInternalSensitivityMethod()), sx);
+        } else if (getInternalSensitivityMethod()
+                   == InternalSensitivityMethod::staggered1) {
+            /* staggered1 requires the sensitivity right hand side for a
+             single parameter */
             status =
-                CVodeSensInit1(solver_memory_.get(), nplist(),
+                CVodeSensInit1(solver_memory_.get(), nsens(),
                                static_cast<int>(getInternalSensitivityMethod()),
-                               fsxdot, sx_.getNVectorArray());
+                               fsxdot, sx);
+            setSensInitDone();
+        } else {
+            status =
+                CVodeSensInit(solver_memory_.get(), nsens(),
+                              static_cast<int>(getInternalSensitivityMethod()),
+                              fsxdot_block, sx);
             setSensInitDone();
         }
     }
@@ -199,7 +234,7 @@ void CVodeSolver::setBandJacFn() const {
 }
 
 void CVodeSolver::setJacTimesVecFn() const {
-    int status = CVodeSetJacTimes(solver_memory_.get(), nullptr, fJv);
+    int status = CVodeSetJacTimes(solver_memory_.get(), fJvSetup, fJv);
     if (status != CV_SUCCESS)
         throw CvodeException(status, "CVodeSetJacTimes");
 }
@@ -223,11 +258,36 @@ void CVodeSolver::setBandJacFnB(int which) const {
 }
 
 void CVodeSolver::setJacTimesVecFnB(int which) const {
-    int status = CVodeSetJacTimesB(solver_memory_.get(), which, nullptr, fJvB);
+    int status =
+        CVodeSetJacTimesB(solver_memory_.get(), which, fJvSetupB, fJvB);
     if (status != CV_SUCCESS)
         throw CvodeException(status, "CVodeSetJacTimesB");
 }
 
+void CVodeSolver::setPreconditionerFn(const Model *model) const {
+    preconditioner_ = Preconditioner::create(getPreconditionerType(),
+                                             model->nx_solver, model->nnz);
+    if (!preconditioner_)
+        return;
+
+    int status = CVodeSetPreconditioner(solver_memory_.get(), fPrecSetup,
+                                        fPrecSolve);
+    if (status != CV_SUCCESS)
+        throw CvodeException(status, "CVodeSetPreconditioner");
+}
+
+void CVodeSolver::setPreconditionerFnB(const Model *model, int which) const {
+    preconditioner_B_ = Preconditioner::create(getPreconditionerType(),
+                                               model->nx_solver, model->nnz);
+    if (!preconditioner_B_)
+        return;
+
+    int status = CVodeSetPreconditionerB(solver_memory_.get(), which,
+                                         fPrecSetupB, fPrecSolveB);
+    if (status != CV_SUCCESS)
+        throw CvodeException(status, "CVodeSetPreconditionerB");
+}
+
 void CVodeSolver::setSparseJacFn_ss() const {
     int status = CVodeSetJacFn(solver_memory_.get(), fJSparseB_ss);
     if (status != CV_SUCCESS)
@@ -504,15 +564,18 @@ void CVodeSolver::reInit(const realtype t0, const AmiVector &yy0,
 
 void CVodeSolver::sensReInit(const AmiVectorArray &yyS0,
                              const AmiVectorArray & /*ypS0*/) const {
+    sx_.copy(yyS0);
+    if (!getSensInitDone())
+        return;
     auto cv_mem = static_cast<CVodeMem>(solver_memory_.get());
     /* Initialize znS[0] in the history array */
-    for (int is = 0; is < nplist(); is++)
+    for (int is = 0; is < nsens(); is++)
         cv_mem->cv_cvals[is] = ONE;
     if (solver_was_called_F_)
         force_reinit_postprocess_F_ = true;
-    sx_.copy(yyS0);
-    int status = N_VScaleVectorArray(nplist(), cv_mem->cv_cvals,
-                                     sx_.getNVectorArray(), cv_mem->cv_znS[0]);
+    int status = N_VScaleVectorArray(
+        nsens(), cv_mem->cv_cvals, getIntegratedSensitivities(sx_, sx_nvecs_),
+        cv_mem->cv_znS[0]);
     if (status != CV_SUCCESS)
         throw CvodeException(CV_VECTOROP_ERR, "CVodeSensReInit");
 }
@@ -561,15 +624,15 @@ void CVodeSolver::getDky(realtype t, int k) const {
 
 void CVodeSolver::getSens() const {
     realtype tDummy = 0;
-    int status =
-        CVodeGetSens(solver_memory_.get(), &tDummy, sx_.getNVectorArray());
+    int status = CVodeGetSens(solver_memory_.get(), &tDummy,
+                              getIntegratedSensitivities(sx_, sx_nvecs_));
     if (status != CV_SUCCESS)
         throw CvodeException(status, "CVodeGetSens");
 }
 
 void CVodeSolver::getSensDky(const realtype t, const int k) const {
-    int status =
-        CVodeGetSensDky(solver_memory_.get(), t, k, sx_.getNVectorArray());
+    int status = CVodeGetSensDky(solver_memory_.get(), t, k,
+                                 getIntegratedSensitivities(sx_, sx_nvecs_));
     if (status != CV_SUCCESS)
         throw CvodeException(status, "CVodeGetSens");
 }
@@ -616,12 +679,17 @@ void CVodeSolver::adjInit() const {
     if (getAdjInitDone()) {
         status = CVodeAdjReInit(solver_memory_.get());
     } else {
-        status = CVodeAdjInit(solver_memory_.get(), static_cast<int>(maxsteps_),
+        status = CVodeAdjInit(solver_memory_.get(), steps_per_checkpoint_,
                               static_cast<int>(interp_type_));
         setAdjInitDone();
     }
     if (status != CV_SUCCESS)
         throw CvodeException(status, "CVodeAdjInit");
+
+    status =
+        CVodeSetAdjSpillCheckpoints(solver_memory_.get(), checkpoint_spill_);
+    if (status != CV_SUCCESS)
+        throw CvodeException(status, "CVodeSetAdjSpillCheckpoints");
 }
 
 void CVodeSolver::quadInit(const AmiVector &xQ0) const {
@@ -945,7 +1013,30 @@ static int fJBandB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
 
 
 /**
- * @brief Matrix vector product of J with a vector v (for iterative solvers)
+ * @brief Evaluates the Jacobian for subsequent Jacobian vector products
+ * (for iterative solvers). Called once per linear solve, i.e. whenever the
+ * time or the state changed.
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xdot Vector with the right hand side
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ **/
+static int fJvSetup(realtype t, N_Vector x, N_Vector /*xdot*/,
+                    void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
+    Expects(model);
+
+    model->fJvSetup(t, x);
+    return AMICI_SUCCESS;
+}
+
+
+/**
+ * @brief Matrix vector product of J with a vector v (for iterative solvers),
+ * using the Jacobian evaluated by fJvSetup
  * @param t timepoint
  * @param x Vector with the states
  * @param xdot Vector with the right hand side
@@ -956,20 +1047,43 @@ static int fJBandB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
  * @param tmp temporary storage vector
  * @return status flag indicating successful execution
  **/
-static int fJv(N_Vector v, N_Vector Jv, realtype t, N_Vector x,
+static int fJv(N_Vector v, N_Vector Jv, realtype /*t*/, N_Vector /*x*/,
         N_Vector /*xdot*/, void *user_data, N_Vector /*tmp*/) {
     auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
     Expects(typed_udata);
     auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
     Expects(model);
 
-    model->fJv(v, Jv, t, x);
+    model->fJv(v, Jv);
     return model->checkFinite(gsl::make_span(Jv), "Jacobian");
 }
 
 
 /**
- * @brief Matrix vector product of JB with a vector v (for iterative solvers)
+ * @brief Evaluates the backward Jacobian for subsequent Jacobian vector
+ * products (for iterative solvers). Called once per linear solve.
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xB Vector with the adjoint states
+ * @param xBdot Vector with the adjoint right hand side
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ **/
+static int fJvSetupB(realtype t, N_Vector x, N_Vector xB,
+                     N_Vector /*xBdot*/, void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
+    Expects(model);
+
+    model->fJvSetupB(t, x, xB);
+    return AMICI_SUCCESS;
+}
+
+
+/**
+ * @brief Matrix vector product of JB with a vector v (for iterative solvers),
+ * using the Jacobian evaluated by fJvSetupB
  * @param t timepoint
  * @param x Vector with the states
  * @param xB Vector with the adjoint states
@@ -981,19 +1095,152 @@ static int fJv(N_Vector v, N_Vector Jv, realtype t, N_Vector x,
  * @param tmpB temporary storage vector
  * @return status flag indicating successful execution
  **/
-static int fJvB(N_Vector vB, N_Vector JvB, realtype t, N_Vector x,
-         N_Vector xB, N_Vector /*xBdot*/, void *user_data,
+static int fJvB(N_Vector vB, N_Vector JvB, realtype /*t*/, N_Vector /*x*/,
+         N_Vector /*xB*/, N_Vector /*xBdot*/, void *user_data,
          N_Vector /*tmpB*/) {
     auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
     Expects(typed_udata);
     auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
     Expects(model);
 
-    model->fJvB(vB, JvB, t, x, xB);
+    model->fJvB(vB, JvB);
     return model->checkFinite(gsl::make_span(JvB), "Jacobian");
 }
 
 
+/**
+ * @brief Preconditioner setup for the iterative solvers, computes a
+ * preconditioner for M = I - gamma * J
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xdot Vector with the right hand side
+ * @param jok flag indicating whether the previously evaluated Jacobian can
+ * be reused
+ * @param jcurPtr set to true if the Jacobian was re-evaluated
+ * @param gamma scalar in M
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ */
+static int fPrecSetup(realtype t, N_Vector x, N_Vector /*xdot*/,
+                      booleantype jok, booleantype *jcurPtr, realtype gamma,
+                      void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
+    Expects(model);
+    auto preconditioner = typed_udata->second->getPreconditioner();
+    Expects(preconditioner);
+
+    if (jok) {
+        *jcurPtr = SUNFALSE;
+    } else {
+        auto &J = preconditioner->getJacobian();
+        model->fJSparse(t, x, J.get());
+        J.refresh();
+        *jcurPtr = SUNTRUE;
+        auto status = model->checkFinite(gsl::make_span(J.get()), "Jacobian");
+        if (status != AMICI_SUCCESS)
+            return status;
+    }
+    return preconditioner->setup(ONE, -gamma);
+}
+
+
+/**
+ * @brief Preconditioner solve for the iterative solvers
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xdot Vector with the right hand side
+ * @param r right hand side of the preconditioner system
+ * @param z solution of the preconditioner system
+ * @param gamma scalar in M
+ * @param delta tolerance for iterative preconditioners
+ * @param lr flag indicating left or right preconditioning
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ */
+static int fPrecSolve(realtype /*t*/, N_Vector /*x*/, N_Vector /*xdot*/,
+                      N_Vector r, N_Vector z, realtype /*gamma*/,
+                      realtype /*delta*/, int /*lr*/, void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto preconditioner = typed_udata->second->getPreconditioner();
+    Expects(preconditioner);
+
+    preconditioner->solve(gsl::make_span(r), gsl::make_span(z));
+    return AMICI_SUCCESS;
+}
+
+
+/**
+ * @brief Preconditioner setup for the iterative solvers of the backward
+ * problem, computes a preconditioner for MB = I - gammaB * JB
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xB Vector with the adjoint states
+ * @param xBdot Vector with the adjoint right hand side
+ * @param jokB flag indicating whether the previously evaluated Jacobian can
+ * be reused
+ * @param jcurPtrB set to true if the Jacobian was re-evaluated
+ * @param gammaB scalar in MB
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ */
+static int fPrecSetupB(realtype t, N_Vector x, N_Vector xB, N_Vector xBdot,
+                       booleantype jokB, booleantype *jcurPtrB,
+                       realtype gammaB, void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
+    Expects(model);
+    auto preconditioner = typed_udata->second->getPreconditionerB();
+    Expects(preconditioner);
+
+    if (jokB) {
+        *jcurPtrB = SUNFALSE;
+    } else {
+        auto &JB = preconditioner->getJacobian();
+        model->fJSparseB(t, x, xB, xBdot, JB.get());
+        JB.refresh();
+        *jcurPtrB = SUNTRUE;
+        auto status =
+            model->checkFinite(gsl::make_span(JB.get()), "Jacobian");
+        if (status != AMICI_SUCCESS)
+            return status;
+    }
+    return preconditioner->setup(ONE, -gammaB);
+}
+
+
+/**
+ * @brief Preconditioner solve for the iterative solvers of the backward
+ * problem
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xB Vector with the adjoint states
+ * @param xBdot Vector with the adjoint right hand side
+ * @param rB right hand side of the preconditioner system
+ * @param zB solution of the preconditioner system
+ * @param gammaB scalar in MB
+ * @param deltaB tolerance for iterative preconditioners
+ * @param lrB flag indicating left or right preconditioning
+ * @param user_data object with user input
+ * @return status flag indicating successful execution
+ */
+static int fPrecSolveB(realtype /*t*/, N_Vector /*x*/, N_Vector /*xB*/,
+                       N_Vector /*xBdot*/, N_Vector rB, N_Vector zB,
+                       realtype /*gammaB*/, realtype /*deltaB*/, int /*lrB*/,
+                       void *user_data) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto preconditioner = typed_udata->second->getPreconditionerB();
+    Expects(preconditioner);
+
+    preconditioner->solve(gsl::make_span(rB), gsl::make_span(zB));
+    return AMICI_SUCCESS;
+}
+
+
 /**
  * @brief Event trigger function for events
  * @param t timepoint
@@ -1010,6 +1257,10 @@ static int froot(realtype t, N_Vector x, realtype *root,
     Expects(model);
 
     model->froot(t, x, gsl::make_span<realtype>(root, model->ne));
+    /* time-triggered events are handled by ForwardProblem, a constant
+     * root value keeps the solver from locating them */
+    for (auto ie : model->getTimeTriggeredEvents())
+        root[ie] = 1.0;
     return model->checkFinite(gsl::make_span<realtype>(root, model->ne),
                               "root function");
 }
@@ -1043,6 +1294,7 @@ static int fxdot(realtype t, N_Vector x, N_Vector xdot, void *user_data) {
         return AMICI_UNRECOVERABLE_ERROR;
     }
 
+    solver->countRhsEval();
     model->fxdot(t, x, xdot);
     return model->checkFinite(gsl::make_span(xdot), "fxdot");
 }
@@ -1168,7 +1420,7 @@ static int fJSparseB_ss(realtype /*t*/, N_Vector /*x*/, N_Vector xBdot,
  * @param t timepoint
  * @param x Vector with the states
  * @param xdot Vector with the right hand side
- * @param ip parameter index
+ * @param is index of the integrated sensitivity
  * @param sx Vector with the state sensitivities
  * @param sxdot Vector with the sensitivity right hand side
  * @param user_data object with user input
@@ -1178,17 +1430,52 @@ static int fJSparseB_ss(realtype /*t*/, N_Vector /*x*/, N_Vector xBdot,
  * @return status flag indicating successful execution
  */
 static int fsxdot(int /*Ns*/, realtype t, N_Vector x, N_Vector /*xdot*/,
-                        int ip, N_Vector sx, N_Vector sxdot, void *user_data,
+                        int is, N_Vector sx, N_Vector sxdot, void *user_data,
                         N_Vector /*tmp1*/, N_Vector /*tmp2*/) {
     auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
     Expects(typed_udata);
     auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
     Expects(model);
+    auto solver = typed_udata->second;
 
-    model->fsxdot(t, x, ip, sx, sxdot);
+    model->fsxdot(t, x, solver->getIntegratedSensitivityIndices()[is], sx,
+                  sxdot, is == 0);
     return model->checkFinite(gsl::make_span(sxdot), "sxdot");
 }
 
+/**
+ * @brief Right hand side of differential equation for state sensitivities,
+ * for all parameters at once
+ * @param Ns number of integrated sensitivities
+ * @param t timepoint
+ * @param x Vector with the states
+ * @param xdot Vector with the right hand side
+ * @param sx Vectors with the state sensitivities
+ * @param sxdot Vectors with the sensitivity right hand sides
+ * @param user_data object with user input
+ * @param tmp1 temporary storage vector
+ * @param tmp2 temporary storage vector
+ * @return status flag indicating successful execution
+ */
+static int fsxdot_block(int Ns, realtype t, N_Vector x, N_Vector /*xdot*/,
+                        N_Vector *sx, N_Vector *sxdot, void *user_data,
+                        N_Vector /*tmp1*/, N_Vector /*tmp2*/) {
+    auto typed_udata = static_cast<CVodeSolver::user_data_type *>(user_data);
+    Expects(typed_udata);
+    auto model = dynamic_cast<Model_ODE *>(typed_udata->first);
+    Expects(model);
+    auto solver = typed_udata->second;
+
+    model->fsxdot(t, x, solver->getIntegratedSensitivityIndices(),
+                  gsl::make_span(sx, Ns), gsl::make_span(sxdot, Ns));
+    for (int ip = 0; ip < Ns; ++ip) {
+        auto status = model->checkFinite(gsl::make_span(sxdot[ip]), "sxdot");
+        if (status != AMICI_SUCCESS)
+            return status;
+    }
+    return AMICI_SUCCESS;
+}
+
 bool operator==(const CVodeSolver &a, const CVodeSolver &b) {
     return static_cast<Solver const &>(a) == static_cast<Solver const &>(b);
 }
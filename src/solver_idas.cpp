@@ -121,17 +121,19 @@ void IDASolver::sensInit1(const AmiVectorArray &sx0,
     int status = IDA_SUCCESS;
     sx_ = sx0;
     sdx_ = sdx0;
-    if (getSensitivityMethod() == SensitivityMethod::forward && nplist() > 0) {
+    if (getSensitivityMethod() == SensitivityMethod::forward && nsens() > 0) {
+        auto sx = getIntegratedSensitivities(sx_, sx_nvecs_);
+        auto sdx = getIntegratedSensitivities(sdx_, sdx_nvecs_);
         if (getSensInitDone()) {
             status =
                 IDASensReInit(solver_memory_.get(),
                               static_cast<int>(getInternalSensitivityMethod()),
-                              sx_.getNVectorArray(), sdx_.getNVectorArray());
+                              sx, sdx);
         } else {
             status = IDASensInit(
-                solver_memory_.get(), nplist(),
+                solver_memory_.get(), nsens(),
                 static_cast<int>(getInternalSensitivityMethod()), fsxdot,
-                sx_.getNVectorArray(), sdx_.getNVectorArray());
+                sx, sdx);
             setSensInitDone();
         }
     }
@@ -195,6 +197,19 @@ void IDASolver::setBandJacFn() const {
         throw IDAException(status, "IDADlsSetBandJacFn");
 }
 
+void IDASolver::setPreconditionerFn(const Model * /*model*/) const {
+    if (getPreconditionerType() != PreconditionerType::none)
+        throw AmiException("Preconditioners are currently not supported for "
+                           "DAE models!");
+}
+
+void IDASolver::setPreconditionerFnB(const Model * /*model*/,
+                                     int /*which*/) const {
+    if (getPreconditionerType() != PreconditionerType::none)
+        throw AmiException("Preconditioners are currently not supported for "
+                           "DAE models!");
+}
+
 void IDASolver::setJacTimesVecFn() const {
     int status = IDASetJacTimes(solver_memory_.get(), nullptr, fJv);
     if (status != IDA_SUCCESS)
@@ -428,21 +443,24 @@ void IDASolver::reInit(const realtype t0, const AmiVector &yy0,
 
 void IDASolver::sensReInit(const AmiVectorArray &yyS0,
                            const AmiVectorArray &ypS0) const {
+    sx_.copy(yyS0);
+    sdx_.copy(ypS0);
+    if (!getSensInitDone())
+        return;
     auto ida_mem = static_cast<IDAMem>(solver_memory_.get());
     /* Initialize znS[0] in the history array */
-    for (int is = 0; is < nplist(); is++)
+    for (int is = 0; is < nsens(); is++)
         ida_mem->ida_cvals[is] = ONE;
     if (solver_was_called_F_)
         force_reinit_postprocess_F_ = true;
-    sx_.copy(yyS0);
-    sdx_.copy(ypS0);
-    auto status =
-        N_VScaleVectorArray(nplist(), ida_mem->ida_cvals, sx_.getNVectorArray(),
-                            ida_mem->ida_phiS[0]);
+    auto status = N_VScaleVectorArray(
+        nsens(), ida_mem->ida_cvals, getIntegratedSensitivities(sx_, sx_nvecs_),
+        ida_mem->ida_phiS[0]);
     if (status != IDA_SUCCESS)
         throw IDAException(IDA_VECTOROP_ERR, "IDASensReInit");
-    status = N_VScaleVectorArray(nplist(), ida_mem->ida_cvals,
-                                 sdx_.getNVectorArray(), ida_mem->ida_phiS[1]);
+    status = N_VScaleVectorArray(
+        nsens(), ida_mem->ida_cvals,
+        getIntegratedSensitivities(sdx_, sdx_nvecs_), ida_mem->ida_phiS[1]);
     if (status != IDA_SUCCESS)
         throw IDAException(IDA_VECTOROP_ERR, "IDASensReInit");
 }
@@ -492,13 +510,15 @@ void IDASolver::getDky(const realtype t, const int k) const {
 
 void IDASolver::getSens() const {
     realtype tDummy = 0;
-    int status = IDAGetSens(solver_memory_.get(), &tDummy, sx_.getNVectorArray());
+    int status = IDAGetSens(solver_memory_.get(), &tDummy,
+                            getIntegratedSensitivities(sx_, sx_nvecs_));
     if (status != IDA_SUCCESS)
         throw IDAException(status, "IDAGetSens");
 }
 
 void IDASolver::getSensDky(const realtype t, const int k) const {
-    int status = IDAGetSensDky(solver_memory_.get(), t, k, sx_.getNVectorArray());
+    int status = IDAGetSensDky(solver_memory_.get(), t, k,
+                               getIntegratedSensitivities(sx_, sx_nvecs_));
     if (status != IDA_SUCCESS)
         throw IDAException(status, "IDAGetSens");
 }
@@ -549,12 +569,16 @@ void IDASolver::adjInit() const {
     if (getAdjInitDone()) {
         status = IDAAdjReInit(solver_memory_.get());
     } else {
-        status = IDAAdjInit(solver_memory_.get(), static_cast<int>(maxsteps_),
+        status = IDAAdjInit(solver_memory_.get(), steps_per_checkpoint_,
                             static_cast<int>(interp_type_));
         setAdjInitDone();
     }
     if (status != IDA_SUCCESS)
         throw IDAException(status, "IDAAdjInit");
+
+    status = IDAAdjSetSpillCheckpoints(solver_memory_.get(), checkpoint_spill_);
+    if (status != IDA_SUCCESS)
+        throw IDAException(status, "IDAAdjSetSpillCheckpoints");
 }
 
 void IDASolver::quadInit(const AmiVector &xQ0) const {
@@ -744,7 +768,7 @@ void IDASolver::setLinearSolver() const {
 
 void IDASolver::setLinearSolverB(const int which) const {
     int status =
-        IDASetLinearSolverB(solver_memory_B_[which].get(), which,
+        IDASetLinearSolverB(solver_memory_.get(), which,
                             linear_solver_B_->get(), linear_solver_B_->getMatrix());
     if (status != IDA_SUCCESS)
         throw IDAException(status, "setLinearSolverB");
@@ -1020,6 +1044,10 @@ int froot(realtype t, N_Vector x, N_Vector dx, realtype *root,
     Expects(model);
 
     model->froot(t, x, dx, gsl::make_span<realtype>(root, model->ne));
+    /* time-triggered events are handled by ForwardProblem, a constant
+     * root value keeps the solver from locating them */
+    for (auto ie : model->getTimeTriggeredEvents())
+        root[ie] = 1.0;
     return model->checkFinite(gsl::make_span<realtype>(root, model->ne),
                               "root function");
 }
@@ -1054,6 +1082,7 @@ int fxdot(realtype t, N_Vector x, N_Vector dx, N_Vector xdot,
         return AMICI_UNRECOVERABLE_ERROR;
     }
 
+    solver->countRhsEval();
     model->fxdot(t, x, dx, xdot);
     return model->checkFinite(gsl::make_span(xdot), "fxdot");
 }
@@ -1197,7 +1226,7 @@ static int fqBdot_ss(realtype t, N_Vector xB, N_Vector dxB, N_Vector qBdot,
  * @param tmp3 temporary storage vector
  * @return status flag indicating successful execution
  */
-int fsxdot(int /*Ns*/, realtype t, N_Vector x, N_Vector dx,
+int fsxdot(int Ns, realtype t, N_Vector x, N_Vector dx,
                       N_Vector /*xdot*/, N_Vector *sx, N_Vector *sdx,
                       N_Vector *sxdot, void *user_data, N_Vector /*tmp1*/,
                       N_Vector /*tmp2*/, N_Vector /*tmp3*/) {
@@ -1206,10 +1235,11 @@ int fsxdot(int /*Ns*/, realtype t, N_Vector x, N_Vector dx,
     Expects(typed_udata);
     auto model = dynamic_cast<Model_DAE *>(typed_udata->first);
     Expects(model);
+    auto const &ips = typed_udata->second->getIntegratedSensitivityIndices();
 
-    for (int ip = 0; ip < model->nplist(); ip++) {
-        model->fsxdot(t, x, dx, ip, sx[ip], sdx[ip], sxdot[ip]);
-        if (model->checkFinite(gsl::make_span(sxdot[ip]), "sxdot")
+    for (int is = 0; is < Ns; is++) {
+        model->fsxdot(t, x, dx, ips[is], sx[is], sdx[is], sxdot[is]);
+        if (model->checkFinite(gsl::make_span(sxdot[is]), "sxdot")
                 != AMICI_SUCCESS)
             return AMICI_RECOVERABLE_ERROR;
     }
@@ -5,6 +5,10 @@
  * Australia.
  */
 
+#include "amici/spline.h"
+
+#include <utility>
+
 namespace amici {
 /************************************************/
 /*  adapted from                                */
@@ -192,8 +196,8 @@ LeaveSpline:
 
 */
 
-double seval(int n, double u, double x[], double y[], double b[], double c[],
-             double d[])
+double seval(int n, double u, const double x[], const double y[],
+             const double b[], const double c[], const double d[])
 
 { /* begin function seval() */
 
@@ -289,4 +293,18 @@ double sinteg(int n, double u, double x[], double y[], double b[], double c[],
     return (sum);
 }
 
+CubicSpline::CubicSpline(std::vector<double> nodes, std::vector<double> values,
+                         bool fixed_slope, double slope)
+    : nodes_(std::move(nodes)), values_(std::move(values)),
+      b_(nodes_.size()), c_(nodes_.size()), d_(nodes_.size()) {
+    spline(static_cast<int>(nodes_.size()), fixed_slope, 0, slope, 0.0,
+           nodes_.data(), values_.data(), b_.data(), c_.data(), d_.data());
+}
+
+double CubicSpline::evaluate(double t) const {
+    auto n = static_cast<int>(nodes_.size());
+    return seval(n, t, nodes_.data(), values_.data(), b_.data(), c_.data(),
+                 d_.data());
+}
+
 } // namespace amici
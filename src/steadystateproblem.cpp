@@ -9,11 +9,15 @@
 #include "amici/newton_solver.h"
 #include "amici/misc.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <ctime>
+#include <exception>
+#include <future>
 #include <sundials/sundials_dense.h>
 #include <memory>
+#include <tuple>
 #include <cvodes/cvodes.h>
 
 namespace amici {
@@ -27,7 +31,8 @@ SteadystateProblem::SteadystateProblem(const Solver &solver, const Model &model)
       xQB_(model.nplist()), xQBdot_(model.nplist()),
       dJydx_(model.nJ * model.nx_solver * model.nt(), 0.0) {
           /* maxSteps must be adapted if iterative linear solvers are used */
-          if (solver.getLinearSolver() == LinearSolver::SPBCG) {
+          if (solver.getLinearSolver() == LinearSolver::SPBCG ||
+              solver.getLinearSolver() == LinearSolver::SPGMR) {
               max_steps_ = solver.getNewtonMaxSteps();
               numlinsteps_.resize(2 * max_steps_, 0);
           }
@@ -57,11 +62,11 @@ void SteadystateProblem::workSteadyStateProblem(Solver *solver, Model *model,
     }
 
     /* create a Newton solver object */
-    auto newtonSolver = NewtonSolver::getSolver(&t_, &x_, *solver, model);
+    newton_solver_ = NewtonSolver::getSolver(&t_, &x_, *solver, model);
 
     /* Compute steady state and get the computation time */
     clock_t starttime = clock();
-    findSteadyState(solver, newtonSolver.get(), model, it);
+    findSteadyState(solver, newton_solver_.get(), model, it);
     cpu_time_ = (double)((clock() - starttime) * 1000) / CLOCKS_PER_SEC;
 
     /* Check whether state sensis still need to be computed */
@@ -70,7 +75,7 @@ void SteadystateProblem::workSteadyStateProblem(Solver *solver, Model *model,
         try {
             /* this might still fail, if the Jacobian is singular and
              simulation did not find a steady state */
-            newtonSolver->computeNewtonSensis(sx_);
+            newton_solver_->computeNewtonSensis(sx_);
         } catch (NewtonFailure const &) {
             /* No steady state could be inferred. Store simulation state */
             storeSimulationState(model, solver->getSensitivityOrder() >=
@@ -79,11 +84,20 @@ void SteadystateProblem::workSteadyStateProblem(Solver *solver, Model *model,
                                "to unsuccessful factorization of RHS Jacobian");
         }
     }
+    num_jac_evals_ += newton_solver_->getNumJacobianEvaluations();
+    num_factorizations_ += newton_solver_->getNumFactorizations();
 
     /* Get output of steady state solver, write it to x0 and reset time
      if necessary */
-    storeSimulationState(model, getSensitivityFlag(model, solver, it,
-                         SteadyStateContext::sensiStorage));
+    bool storesensi = getSensitivityFlag(model, solver, it,
+                                         SteadyStateContext::sensiStorage);
+    storeSimulationState(model, storesensi);
+
+    /* keep steady state as starting point for the next preequilibration */
+    if (it == -1 &&
+        solver->getSteadyStateWarmStartMode() != SteadyStateWarmStartMode::off)
+        solver->getSteadyStateWarmStart().store(*model, x_,
+                                                storesensi ? &sx_ : nullptr);
 }
 
 void SteadystateProblem::workSteadyStateBackwardProblem(Solver *solver,
@@ -93,13 +107,31 @@ void SteadystateProblem::workSteadyStateBackwardProblem(Solver *solver,
     if (!initializeBackwardProblem(solver, model, bwd))
         return;
 
-    /* Get the Newton solver */
-    auto newtonSolver = NewtonSolver::getSolver(&t_, &x_, *solver, model);
+    /* Reuse the Newton solver of the forward problem, if available, which
+       may still hold a factorization of the Jacobian at the steady state */
+    if (!newton_solver_)
+        newton_solver_ = NewtonSolver::getSolver(&t_, &x_, *solver, model);
+    auto num_jac_evals = newton_solver_->getNumJacobianEvaluations();
+    auto num_factorizations = newton_solver_->getNumFactorizations();
 
     /* get the run time */
     clock_t starttime = clock();
-    computeSteadyStateQuadrature(newtonSolver.get(), solver, model);
+    computeSteadyStateQuadrature(newton_solver_.get(), solver, model);
     cpu_timeB_ = (double)((clock() - starttime) * 1000) / CLOCKS_PER_SEC;
+    num_jac_evals_ += newton_solver_->getNumJacobianEvaluations()
+                      - num_jac_evals;
+    num_factorizations_ += newton_solver_->getNumFactorizations()
+                           - num_factorizations;
+}
+
+void SteadystateProblem::resetDiagnostics() {
+    std::fill(numsteps_.begin(), numsteps_.end(), 0);
+    std::fill(numlinsteps_.begin(), numlinsteps_.end(), 0);
+    num_jac_evals_ = 0;
+    num_factorizations_ = 0;
+    num_ptc_steps_ = 0;
+    num_ptc_linsolves_ = 0;
+    cpu_time_ = 0.0;
 }
 
 void SteadystateProblem::findSteadyState(Solver *solver,
@@ -107,11 +139,27 @@ void SteadystateProblem::findSteadyState(Solver *solver,
                                          Model *model, int it) {
     /* First, try to run the Newton solver */
     steady_state_status_.resize(3, SteadyStateStatus::not_run);
-    findSteadyStateByNewtonsMethod(newtonSolver, model, false);
-
-    /* Newton solver didn't work, so try to simulate to steady state */
-    if (!checkSteadyStateSuccess())
-        findSteadyStateBySimulation(solver, model, it);
+    if (it == -1 &&
+        solver->getSteadyStateWarmStartMode() != SteadyStateWarmStartMode::off)
+        findSteadyStateFromWarmStart(solver, newtonSolver, model);
+    if (it == -1 && solver->getSteadyStateConcurrentSearch()) {
+        /* Race Newton's method against simulation */
+        if (!checkSteadyStateSuccess())
+            findSteadyStateConcurrently(solver, newtonSolver, model, it);
+    } else {
+        if (!checkSteadyStateSuccess())
+            findSteadyStateByNewtonsMethod(newtonSolver, model, false);
+
+        /* Newton solver didn't work, try pseudo-transient continuation */
+        if (!checkSteadyStateSuccess() &&
+            solver->getSteadyStatePseudoTransientContinuation())
+            findSteadyStateByPseudoTransientContinuation(solver, newtonSolver,
+                                                         model);
+
+        /* Still no steady state, so try to simulate to steady state */
+        if (!checkSteadyStateSuccess())
+            findSteadyStateBySimulation(solver, model, it);
+    }
 
     /* Simulation didn't work, retry the Newton solver from last sim state. */
     if (!checkSteadyStateSuccess())
@@ -131,6 +179,10 @@ void SteadystateProblem::findSteadyStateByNewtonsMethod(NewtonSolver *newtonSolv
         steady_state_status_[ind] = SteadyStateStatus::success;
     } catch (NewtonFailure const &ex) {
         /* nothing to be done */
+        if (isCancelled()) {
+            steady_state_status_[ind] = SteadyStateStatus::not_run;
+            return;
+        }
         switch (ex.error_code) {
             case AMICI_TOO_MUCH_WORK:
                 steady_state_status_[ind] =
@@ -165,6 +217,131 @@ void SteadystateProblem::findSteadyStateByNewtonsMethod(NewtonSolver *newtonSolv
     }
 }
 
+void SteadystateProblem::findSteadyStateFromWarmStart(
+    const Solver *solver, NewtonSolver *newtonSolver, Model *model) {
+    AmiVector x_cold(x_);
+    if (!solver->getSteadyStateWarmStart().getStartingPoint(
+            *model, solver->getSteadyStateWarmStartMode(), x_))
+        return;
+
+    findSteadyStateByNewtonsMethod(newtonSolver, model, false);
+    if (checkSteadyStateSuccess()) {
+        warm_started_ = true;
+        return;
+    }
+
+    /* fall back to cold start */
+    x_.copy(x_cold);
+    steady_state_status_[0] = SteadyStateStatus::not_run;
+    numsteps_.at(0) = 0;
+}
+
+void SteadystateProblem::findSteadyStateByPseudoTransientContinuation(
+    const Solver *solver, NewtonSolver *newtonSolver, Model *model) {
+    AmiVector x_start(x_);
+    try {
+        applyPseudoTransientContinuation(solver, model, newtonSolver);
+    } catch (NewtonFailure const &) {
+        x_.copy(x_start);
+        return;
+    }
+
+    /* switch to Newton's method near convergence */
+    findSteadyStateByNewtonsMethod(newtonSolver, model, true);
+    if (checkSteadyStateSuccess())
+        return;
+
+    /* fall back to simulation from where pseudo-transient continuation
+       started */
+    x_.copy(x_start);
+    steady_state_status_[2] = SteadyStateStatus::not_run;
+    numsteps_.at(2) = 0;
+}
+
+void SteadystateProblem::findSteadyStateConcurrently(const Solver *solver,
+                                                     NewtonSolver *newtonSolver,
+                                                     Model *model, int it) {
+    /* simulation works on copies of this problem and the model, the solver
+       is cloned in findSteadyStateBySimulation */
+    SteadystateProblem sim_problem(*this);
+    auto sim_model = std::unique_ptr<Model>(model->clone());
+    std::atomic<bool> finished {false};
+    search_finished_ = &finished;
+    sim_problem.search_finished_ = &finished;
+
+    /* Simulation runs on a separate thread, so that both methods run
+       concurrently regardless of whether we are already inside an OpenMP
+       parallel region. Exceptions do not stop the other method, which may
+       still converge. */
+    std::exception_ptr sim_exception;
+    auto sim_future = std::async(std::launch::async, [&]() {
+        try {
+            sim_problem.findSteadyStateBySimulation(solver, sim_model.get(),
+                                                    it);
+            if (sim_problem.checkSteadyStateSuccess())
+                finished.exchange(true);
+        } catch (...) {
+            sim_exception = std::current_exception();
+        }
+    });
+
+    bool newton_won = false;
+    std::exception_ptr newton_exception;
+    try {
+        findSteadyStateByNewtonsMethod(newtonSolver, model, false);
+        if (!checkSteadyStateSuccess() && !isCancelled() &&
+            solver->getSteadyStatePseudoTransientContinuation())
+            findSteadyStateByPseudoTransientContinuation(solver, newtonSolver,
+                                                         model);
+        if (checkSteadyStateSuccess())
+            newton_won = !finished.exchange(true);
+    } catch (...) {
+        newton_exception = std::current_exception();
+    }
+    sim_future.wait();
+    search_finished_ = nullptr;
+
+    /* only report errors if no method converged */
+    bool sim_converged =
+        !sim_exception && sim_problem.checkSteadyStateSuccess();
+    if (!newton_won && !sim_converged) {
+        if (newton_exception)
+            std::rethrow_exception(newton_exception);
+        if (sim_exception)
+            std::rethrow_exception(sim_exception);
+    }
+
+    auto sim_status = sim_problem.steady_state_status_[1];
+    if (newton_won) {
+        /* a simulation that converged too late is reported as not run */
+        if (sim_status == SteadyStateStatus::success)
+            sim_status = SteadyStateStatus::not_run;
+        steady_state_status_[1] = sim_status;
+        numsteps_.at(1) = sim_status == SteadyStateStatus::not_run
+                              ? 0 : sim_problem.numsteps_.at(1);
+        return;
+    }
+
+    /* Newton's method was stopped or converged too late */
+    for (int ind : {0, 2}) {
+        if (steady_state_status_[ind] == SteadyStateStatus::success) {
+            steady_state_status_[ind] = SteadyStateStatus::not_run;
+            numsteps_.at(ind) = 0;
+        }
+    }
+
+    /* take over the result of the simulation, which is also the starting
+       point for the second run of Newton's method if it failed */
+    steady_state_status_[1] = sim_status;
+    numsteps_.at(1) = sim_problem.numsteps_.at(1);
+    t_ = sim_problem.t_;
+    x_.copy(sim_problem.x_);
+    xdot_.copy(sim_problem.xdot_);
+    sx_ = sim_problem.sx_;
+    wrms_ = sim_problem.wrms_;
+    model->setModelState(sim_model->getModelState());
+}
+
 void SteadystateProblem::findSteadyStateBySimulation(const Solver *solver,
                                                      Model *model,
                                                      int it) {
@@ -189,6 +366,11 @@ void SteadystateProblem::findSteadyStateBySimulation(const Solver *solver,
         }
         steady_state_status_[1] = SteadyStateStatus::success;
     } catch (NewtonFailure const &ex) {
+        if (isCancelled()) {
+            steady_state_status_[1] = SteadyStateStatus::not_run;
+            numsteps_.at(1) = 0;
+            return;
+        }
         switch (ex.error_code) {
             case AMICI_TOO_MUCH_WORK:
                 steady_state_status_[1] = SteadyStateStatus::failed_convergence;
@@ -281,8 +463,15 @@ void SteadystateProblem::getQuadratureByLinSolve(NewtonSolver *newtonSolver,
     /* try to solve the linear system */
     try {
         /* compute integral over xB and write to xQ */
-        newtonSolver->prepareLinearSystemB(0, -1);
-        newtonSolver->solveLinearSystem(xQ_);
+        if (model->nx_solver == model->nxtrue_solver) {
+            /* JB = -J^T, so the factorization of J at the steady state can
+               be used, if the linear solver supports it */
+            newtonSolver->solveLinearSystemTransposed(xQ_);
+            xQ_.minus();
+        } else {
+            newtonSolver->prepareLinearSystemB(0, -1);
+            newtonSolver->solveLinearSystem(xQ_);
+        }
         /* Compute the quadrature as the inner product xQ * dxdotdp */
         computeQBfromQ(model, xQ_, xQB_);
         /* set flag that quadratures is available (for processing in rdata) */
@@ -379,9 +568,11 @@ bool SteadystateProblem::getSensitivityFlag(const Model *model,
         steady_state_status_[1] == SteadyStateStatus::success &&
         model->getSteadyStateSensitivityMode() == SteadyStateSensitivityMode::simulationFSA;
 
+    /* If Newton's method started from a stored steady state, the initial
+       state sensitivities do not apply */
     bool simulationStartedInSteadystate =
         steady_state_status_[0] == SteadyStateStatus::success &&
-        numsteps_[0] == 0;
+        numsteps_[0] == 0 && !warm_started_;
 
     /* Do we need forward sensis for postequilibration? */
     bool needForwardSensisPosteq = !preequilibration &&
@@ -475,6 +666,10 @@ bool SteadystateProblem::checkConvergence(const Solver *solver,
     return converged;
 }
 
+bool SteadystateProblem::isCancelled() const {
+    return search_finished_ && *search_finished_;
+}
+
 bool SteadystateProblem::checkSteadyStateSuccess() const {
     /* Did one of the attempts yield s steady state? */
     if (std::any_of(steady_state_status_.begin(), steady_state_status_.end(),
@@ -499,6 +694,7 @@ void SteadystateProblem::applyNewtonsMethod(Model *model,
 
     /* initialize output of linear solver for Newton step */
     delta_.zero();
+    newtonSolver->resetJacobian();
 
     model->fxdot(t_, x_, dx_, xdot_);
 
@@ -511,6 +707,10 @@ void SteadystateProblem::applyNewtonsMethod(Model *model,
                         newtonSolver->rtol_, ewt_);
     bool converged = newton_retry ? false : wrms_ < RCONST(1.0);
     while (!converged && i_newtonstep < newtonSolver->max_steps) {
+        if (isCancelled()) {
+            numsteps_.at(newton_retry ? 2 : 0) = i_newtonstep;
+            throw NewtonFailure(AMICI_ERROR, "applyNewtonsMethod");
+        }
 
         /* If Newton steps are necessary, compute the initial search direction */
         if (compNewStep) {
@@ -532,6 +732,11 @@ void SteadystateProblem::applyNewtonsMethod(Model *model,
                                         newtonSolver->rtol_, ewt_);
 
         if (wrms_tmp < wrms_) {
+            /* If the residuals decrease too slowly with a reused Jacobian,
+               reevaluate it for the next step */
+            if (newtonSolver->reuse_jacobian_ &&
+                wrms_tmp > newtonSolver->jacobian_reuse_contraction_ * wrms_)
+                newtonSolver->resetJacobian();
             /* If new residuals are smaller than old ones, update state */
             wrms_ = wrms_tmp;
             x_old_ = x_;
@@ -561,6 +766,13 @@ void SteadystateProblem::applyNewtonsMethod(Model *model,
                 /* increase dampening factor (superfluous, if converged) */
                 gamma = fmin(1.0, 2.0 * gamma);
             }
+        } else if (newtonSolver->getJacobianAge() > 0) {
+            /* The step was computed from an outdated Jacobian. Retry from the
+               last accepted state with a new one before damping. */
+            x_ = x_old_;
+            xdot_ = xdot_old_;
+            newtonSolver->resetJacobian();
+            compNewStep = true;
         } else if (newtonSolver->damping_factor_mode_==NewtonDampingFactorMode::on) {
             /* Reduce dampening factor and raise an error when becomes too small */
             gamma = gamma / 4.0;
@@ -582,6 +794,73 @@ void SteadystateProblem::applyNewtonsMethod(Model *model,
         throw NewtonFailure(AMICI_TOO_MUCH_WORK, "applyNewtonsMethod");
 }
 
+void SteadystateProblem::applyPseudoTransientContinuation(
+    const Solver *solver, Model *model, NewtonSolver *newtonSolver) {
+    if (model->nx_solver == 0)
+        return;
+
+    /* pseudo-time step size, adapted by switched evolution relaxation,
+       i.e. inversely proportional to the residual, such that the implicit
+       Euler steps turn into Newton steps as the residual vanishes */
+    realtype h = 1.0;
+    int i_step = 0;
+    /* bounds on the step size and its increase per step. The step size is
+       not allowed to grow without limit, since the residual may be small only
+       locally. Beyond the upper bound, the steps are Newton steps up to
+       round-off. */
+    constexpr realtype max_h = 1e10;
+    constexpr realtype max_h_increase = 10.0;
+
+    model->fxdot(t_, x_, dx_, xdot_);
+    x_old_ = x_;
+    xdot_old_ = xdot_;
+    wrms_ = getWrmsNorm(x_, xdot_, newtonSolver->atol_, newtonSolver->rtol_,
+                        ewt_);
+
+    while (wrms_ >= RCONST(1.0)) {
+        if (isCancelled())
+            throw NewtonFailure(AMICI_ERROR,
+                                "applyPseudoTransientContinuation");
+        if (i_step++ >= solver->getMaxSteps())
+            throw NewtonFailure(AMICI_TOO_MUCH_WORK,
+                                "applyPseudoTransientContinuation");
+
+        /* implicit Euler step: (I - h J) delta = h xdot */
+        realtype wrms_tmp = INFINITY;
+        try {
+            newtonSolver->prepareShiftedLinearSystem(h);
+            N_VScale(h, xdot_old_.getNVector(), delta_.getNVector());
+            ++num_ptc_linsolves_;
+            newtonSolver->solveLinearSystem(delta_);
+            linearSum(1.0, x_old_, 1.0, delta_, x_);
+            model->fxdot(t_, x_, dx_, xdot_);
+            wrms_tmp = getWrmsNorm(x_, xdot_, newtonSolver->atol_,
+                                   newtonSolver->rtol_, ewt_);
+        } catch (NewtonFailure const &ex) {
+            if (ex.error_code == AMICI_NOT_IMPLEMENTED)
+                throw;
+        }
+
+        if (!std::isfinite(wrms_tmp)) {
+            /* reject step, retry with a smaller step size */
+            x_ = x_old_;
+            xdot_ = xdot_old_;
+            h /= 4.0;
+            if (h < newtonSolver->damping_factor_lower_bound)
+                throw NewtonFailure(AMICI_DAMPING_FACTOR_ERROR,
+                                    "Pseudo-transient continuation failed: "
+                                    "the step size reached its lower bound");
+            continue;
+        }
+
+        h = std::min(h * std::min(wrms_ / wrms_tmp, max_h_increase), max_h);
+        wrms_ = wrms_tmp;
+        x_old_ = x_;
+        xdot_old_ = xdot_;
+        ++num_ptc_steps_;
+    }
+}
+
 void SteadystateProblem::runSteadystateSimulation(const Solver *solver,
                                                   Model *model,
                                                   bool backward)
@@ -614,6 +893,9 @@ void SteadystateProblem::runSteadystateSimulation(const Solver *solver,
     int sim_steps = 0;
 
     while (!converged) {
+        if (isCancelled())
+            throw NewtonFailure(AMICI_ERROR, "runSteadystateSimulation");
+
         /* One step of ODE integration
          reason for tout specification:
          max with 1 ensures correct direction (any positive value would do)
@@ -733,4 +1015,136 @@ void SteadystateProblem::storeSimulationState(Model *model, bool storesensi) {
     state_.state = model->getModelState();
 }
 
+bool SteadyStateWarmStart::getStartingPoint(Model &model,
+                                            SteadyStateWarmStartMode mode,
+                                            AmiVector &x) const {
+    auto key = getKey(model);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto entry = entries_.find(key);
+    if (entry == entries_.end() ||
+        entry->second.x.size() != static_cast<unsigned>(x.getLength()))
+        return false;
+
+    std::copy(entry->second.x.begin(), entry->second.x.end(), x.data());
+
+    if (mode != SteadyStateWarmStartMode::firstOrder ||
+        entry->second.sx.empty())
+        return true;
+
+    /* first order update x += sx * dp for the parameters for which
+       sensitivities are available */
+    auto const &p = model.getUnscaledParameters();
+    auto const &plist = entry->second.plist;
+    auto nx = static_cast<int>(entry->second.x.size());
+    for (int ip = 0; ip < static_cast<int>(plist.size()); ++ip) {
+        auto dp = p.at(plist[ip]) - entry->second.parameters.at(plist[ip]);
+        if (dp == 0.0)
+            continue;
+        for (int ix = 0; ix < nx; ++ix)
+            x[ix] += dp * entry->second.sx[ip * nx + ix];
+    }
+    return true;
+}
+
+void SteadyStateWarmStart::store(Model &model, AmiVector const &x,
+                                 AmiVectorArray const *sx) {
+    Entry entry;
+    entry.parameters = model.getUnscaledParameters();
+    entry.x = x.getVector();
+    if (sx && sx->getLength() > 0) {
+        entry.plist = model.getParameterList();
+        entry.sx.resize(sx->getLength() * x.getLength());
+        sx->flatten_to_vector(entry.sx);
+    }
+
+    auto key = getKey(model);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[std::move(key)] = std::move(entry);
+}
+
+void SteadyStateWarmStart::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+bool SteadyStateWarmStart::Key::operator<(Key const &other) const {
+    return std::tie(fixed_parameters, x0, sx0, t0, plist)
+           < std::tie(other.fixed_parameters, other.x0, other.sx0, other.t0,
+                      other.plist);
+}
+
+SteadyStateWarmStart::Key SteadyStateWarmStart::getKey(Model &model) {
+    Key key;
+    key.fixed_parameters = model.getFixedParameters();
+    if (model.hasCustomInitialStates())
+        key.x0 = model.getInitialStates();
+    if (model.hasCustomInitialStateSensitivities())
+        key.sx0 = model.getInitialStateSensitivities();
+    key.t0 = model.t0();
+    key.plist = model.getParameterList();
+    return key;
+}
+
+bool PreequilibrationCache::Key::operator<(Key const &other) const {
+    return std::tie(fixed_parameters, parameters, pscale, plist, x0, sx0, t0,
+                    sensi, sensi_meth, sensi_meth_preeq)
+           < std::tie(other.fixed_parameters, other.parameters, other.pscale,
+                      other.plist, other.x0, other.sx0, other.t0, other.sensi,
+                      other.sensi_meth, other.sensi_meth_preeq);
+}
+
+std::unique_ptr<SteadystateProblem> PreequilibrationCache::getPreequilibration(
+    Solver const &solver, Model &model,
+    std::function<std::unique_ptr<SteadystateProblem>()> const &compute) {
+    Key key;
+    key.fixed_parameters = model.getFixedParameters();
+    key.parameters = model.getUnscaledParameters();
+    key.pscale = model.getParameterScale();
+    key.plist = model.getParameterList();
+    if (model.hasCustomInitialStates())
+        key.x0 = model.getInitialStates();
+    if (model.hasCustomInitialStateSensitivities())
+        key.sx0 = model.getInitialStateSensitivities();
+    key.t0 = model.t0();
+    key.sensi = solver.getSensitivityOrder();
+    key.sensi_meth = solver.getSensitivityMethod();
+    key.sensi_meth_preeq = solver.getSensitivityMethodPreequilibration();
+
+    std::promise<std::shared_ptr<const SteadystateProblem>> promise;
+    std::shared_future<std::shared_ptr<const SteadystateProblem>> result;
+    bool owner = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto entry = entries_.find(key);
+        if (entry == entries_.end()) {
+            result = promise.get_future().share();
+            entries_.emplace(std::move(key), result);
+            owner = true;
+        } else {
+            result = entry->second;
+        }
+    }
+
+    if (!owner) {
+        if (auto cached = result.get()) {
+            model.setModelState(cached->getFinalSimulationState().state);
+            auto preeq = std::make_unique<SteadystateProblem>(*cached);
+            preeq->resetDiagnostics();
+            return preeq;
+        }
+        /* failed for another condition, repeat to get the error for this
+         * condition */
+        return compute();
+    }
+
+    try {
+        auto preeq = compute();
+        promise.set_value(std::make_shared<const SteadystateProblem>(*preeq));
+        return preeq;
+    } catch (...) {
+        promise.set_value(nullptr);
+        throw;
+    }
+}
+
 } // namespace amici
@@ -2,7 +2,9 @@
 #include <sundials/sundials_matrix.h> // return codes
 
 #include <amici/cblas.h>
+#include <amici/exception.h>
 
+#include <array>
 #include <new> // bad_alloc
 #include <utility>
 #include <stdexcept> // invalid_argument and domain_error
@@ -67,7 +69,6 @@ SUNMatrixWrapper::SUNMatrixWrapper(const SUNMatrixWrapper &A, realtype droptol,
     if (!matrix_)
         throw std::bad_alloc();
     finish_init();
-    num_nonzeros_ = indexptrs_[num_indexptrs()];
 }
 
 static inline SUNMatrix_ID get_sparse_id_w_default(SUNMatrix mat) {
@@ -252,6 +253,51 @@ void SUNMatrixWrapper::multiply(gsl::span<realtype> c,
 
 }
 
+void SUNMatrixWrapper::multiply_block(gsl::span<realtype> C,
+                                      gsl::span<const realtype> B,
+                                      sunindextype ncols,
+                                      realtype alpha) const {
+    if (!matrix_ || ncols == 0)
+        return;
+
+    assert(rows() * ncols == static_cast<sunindextype>(C.size()));
+    assert(columns() * ncols == static_cast<sunindextype>(B.size()));
+
+    switch (matrix_id()) {
+    case SUNMATRIX_DENSE:
+        for (sunindextype icol = 0; icol < columns(); ++icol) {
+            auto b_row = &B[icol * ncols];
+            for (sunindextype irow = 0; irow < rows(); ++irow) {
+                auto a = alpha * get_data(irow, icol);
+                if (a == 0.0)
+                    continue;
+                auto c_row = &C[irow * ncols];
+                for (sunindextype k = 0; k < ncols; ++k)
+                    c_row[k] += a * b_row[k];
+            }
+        }
+        break;
+    case SUNMATRIX_SPARSE:
+        if(!num_nonzeros()) {
+            return;
+        }
+        check_csc(this);
+        for (sunindextype icol = 0; icol < columns(); ++icol) {
+            auto b_row = &B[icol * ncols];
+            for (sunindextype idx = get_indexptr(icol);
+                 idx < get_indexptr(icol + 1); ++idx) {
+                auto a = alpha * get_data(idx);
+                auto c_row = &C[get_indexval(idx) * ncols];
+                for (sunindextype k = 0; k < ncols; ++k)
+                    c_row[k] += a * b_row[k];
+            }
+        }
+        break;
+    default:
+        throw std::domain_error("Not Implemented.");
+    }
+}
+
 void SUNMatrixWrapper::multiply(N_Vector c,
                                 const_N_Vector b,
                                 gsl::span <const int> cols,
@@ -501,6 +547,199 @@ void SUNMatrixWrapper::sparse_sum(const std::vector<SUNMatrixWrapper> &mats) {
         realloc(); // resize if necessary
 }
 
+/**
+ * @brief Check that a precomputed pattern matches the operands it is applied
+ * to, i.e. that their structure did not change since it was computed
+ * @param pattern pattern
+ * @param operand_nnz number of nonzero entries of the operands
+ * @param operation name of the operation for error messages
+ */
+static void check_pattern(const SparseOperationPattern &pattern,
+                          const std::vector<sunindextype> &operand_nnz,
+                          const char *operation) {
+    if (pattern.operand_nnz != operand_nnz)
+        throw AmiException("Precomputed sparsity pattern of %s does not "
+                           "match the number of nonzero entries of its "
+                           "operands",
+                           operation);
+}
+
+SparseOperationPattern
+SUNMatrixWrapper::sparse_multiply_pattern(const SUNMatrixWrapper &B) const {
+    SparseOperationPattern pattern;
+    if (!matrix_ || !B.matrix_)
+        return pattern;
+
+    check_csc(this);
+    check_csc(&B);
+    assert(static_cast<sunindextype>(B.rows()) == columns());
+
+    pattern.operand_nnz = {num_nonzeros(), B.num_nonzeros()};
+    pattern.indexptrs.resize(B.columns() + 1, 0);
+
+    /* same traversal as in sparse_multiply, such that the result has the same
+     * pattern and entries are accumulated in the same order */
+    sunindextype nnz = 0;
+    auto w = std::vector<sunindextype>(rows(), -1); // position of C(i,j)
+    for (sunindextype bcol = 0; bcol < B.columns(); bcol++) {
+        pattern.indexptrs.at(bcol) = nnz;
+        for (auto bidx = B.get_indexptr(bcol); bidx < B.get_indexptr(bcol + 1);
+             bidx++) {
+            auto acol = B.get_indexval(bidx);
+            for (auto aidx = get_indexptr(acol); aidx < get_indexptr(acol + 1);
+                 aidx++) {
+                auto arow = get_indexval(aidx);
+                if (w[arow] < pattern.indexptrs[bcol]) {
+                    w[arow] = nnz++;
+                    pattern.indexvals.push_back(arow);
+                }
+                pattern.result_idxs.push_back(w[arow]);
+                pattern.first_idxs.push_back(aidx);
+                pattern.second_idxs.push_back(bidx);
+            }
+        }
+    }
+    pattern.indexptrs.at(B.columns()) = nnz;
+    return pattern;
+}
+
+void SUNMatrixWrapper::sparse_multiply(
+    SUNMatrixWrapper &C, const SUNMatrixWrapper &B,
+    const SparseOperationPattern &pattern) const {
+    if (!matrix_ || !B.matrix_ || !C.matrix_)
+        return;
+
+    check_csc(&C);
+    assert(rows() == static_cast<sunindextype>(C.rows()));
+    assert(C.columns() == B.columns());
+    check_pattern(pattern, {num_nonzeros(), B.num_nonzeros()},
+                  "sparse_multiply");
+
+    C.set_pattern(pattern);
+
+    auto c_ptr = C.data();
+    auto a_ptr = data();
+    auto b_ptr = B.data();
+    auto num_terms = pattern.result_idxs.size();
+    for (std::size_t iterm = 0; iterm < num_terms; ++iterm)
+        c_ptr[pattern.result_idxs[iterm]] +=
+            a_ptr[pattern.first_idxs[iterm]] *
+            b_ptr[pattern.second_idxs[iterm]];
+}
+
+SparseOperationPattern SUNMatrixWrapper::sparse_sum_pattern(
+    const std::vector<const SUNMatrixWrapper *> &mats) {
+    SparseOperationPattern pattern;
+
+    sunindextype nrows = 0;
+    sunindextype ncols = 0;
+    for (auto mat : mats) {
+        pattern.operand_nnz.push_back(mat ? mat->num_nonzeros() : 0);
+        if (!mat || !mat->matrix_)
+            continue;
+        check_csc(mat);
+        assert(!ncols || (nrows == static_cast<sunindextype>(mat->rows()) &&
+                          ncols == static_cast<sunindextype>(mat->columns())));
+        nrows = mat->rows();
+        ncols = mat->columns();
+    }
+    if (!ncols)
+        return pattern;
+
+    pattern.indexptrs.resize(ncols + 1, 0);
+
+    /* same traversal as in sparse_sum */
+    sunindextype nnz = 0;
+    auto w = std::vector<sunindextype>(nrows, -1); // position of C(i,j)
+    for (sunindextype col = 0; col < ncols; col++) {
+        pattern.indexptrs.at(col) = nnz;
+        for (std::size_t imat = 0; imat < mats.size(); ++imat) {
+            auto mat = mats[imat];
+            if (!mat || !mat->matrix_ || !mat->num_nonzeros())
+                continue;
+            for (auto idx = mat->get_indexptr(col);
+                 idx < mat->get_indexptr(col + 1); idx++) {
+                auto row = mat->get_indexval(idx);
+                if (w[row] < pattern.indexptrs[col]) {
+                    w[row] = nnz++;
+                    pattern.indexvals.push_back(row);
+                }
+                pattern.result_idxs.push_back(w[row]);
+                pattern.first_idxs.push_back(static_cast<sunindextype>(imat));
+                pattern.second_idxs.push_back(idx);
+            }
+        }
+    }
+    pattern.indexptrs.at(ncols) = nnz;
+    return pattern;
+}
+
+void SUNMatrixWrapper::sparse_add(const SUNMatrixWrapper &A, realtype alpha,
+                                  const SUNMatrixWrapper &B, realtype beta,
+                                  const SparseOperationPattern &pattern) {
+    if (!matrix_ || !A.matrix_ || !B.matrix_)
+        return;
+
+    check_csc(this);
+    check_pattern(pattern, {A.num_nonzeros(), B.num_nonzeros()},
+                  "sparse_add");
+
+    set_pattern(pattern);
+
+    std::array<const realtype *, 2> operand_ptrs {A.data(), B.data()};
+    std::array<realtype, 2> coefficients {alpha, beta};
+    auto num_terms = pattern.result_idxs.size();
+    for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+        auto imat = pattern.first_idxs[iterm];
+        data_[pattern.result_idxs[iterm]] +=
+            coefficients[imat] * operand_ptrs[imat][pattern.second_idxs[iterm]];
+    }
+}
+
+void SUNMatrixWrapper::sparse_sum(const std::vector<SUNMatrixWrapper> &mats,
+                                  const SparseOperationPattern &pattern) {
+    if (!matrix_)
+        return;
+
+    check_csc(this);
+    std::vector<sunindextype> operand_nnz;
+    operand_nnz.reserve(mats.size());
+    for (auto const &mat : mats)
+        operand_nnz.push_back(mat.num_nonzeros());
+    check_pattern(pattern, operand_nnz, "sparse_sum");
+
+    set_pattern(pattern);
+
+    auto num_terms = pattern.result_idxs.size();
+    for (std::size_t iterm = 0; iterm < num_terms; ++iterm) {
+        auto const &mat = mats[pattern.first_idxs[iterm]];
+        data_[pattern.result_idxs[iterm]] +=
+            mat.data_[pattern.second_idxs[iterm]];
+    }
+}
+
+void SUNMatrixWrapper::set_pattern(const SparseOperationPattern &pattern) {
+    if (pattern.indexptrs.empty()) {
+        zero();
+        num_nonzeros_ = 0;
+        return;
+    }
+    if (static_cast<sunindextype>(pattern.indexptrs.size()) !=
+        num_indexptrs() + 1)
+        throw AmiException("Precomputed sparsity pattern has %d columns, but "
+                           "the result matrix has %d",
+                           static_cast<int>(pattern.indexptrs.size()) - 1,
+                           static_cast<int>(num_indexptrs()));
+
+    auto nnz = pattern.indexptrs.back();
+    if (nnz > capacity())
+        reallocate(nnz);
+
+    set_indexptrs(pattern.indexptrs);
+    std::copy(pattern.indexvals.begin(), pattern.indexvals.end(), indexvals_);
+    std::fill_n(data_, nnz, 0.0);
+}
+
 sunindextype SUNMatrixWrapper::scatter(const sunindextype acol,
                                        const realtype beta,
                                        sunindextype *w,
@@ -599,6 +838,7 @@ void SUNMatrixWrapper::transpose(SUNMatrixWrapper &C, const realtype alpha,
         }
         /* row pointers */
         cumsum(gsl::make_span(C.indexptrs_, C.columns()+1), w);
+        C.num_nonzeros_ = C.indexptrs_[C.num_indexptrs()];
 
         for (sunindextype acol = 0; acol < nrows; acol++)
         {
@@ -689,6 +929,9 @@ void SUNMatrixWrapper::zero()
 void SUNMatrixWrapper::finish_init() {
     update_ptrs();
     update_size();
+    num_nonzeros_ = (matrix_ && matrix_id() == SUNMATRIX_SPARSE)
+                        ? indexptrs_[num_indexptrs()]
+                        : 0;
 }
 
 void SUNMatrixWrapper::update_ptrs() {
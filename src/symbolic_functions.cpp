@@ -12,16 +12,15 @@
 #include <cfloat>
 #include <cmath>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdlib>
-#if _MSC_VER && !__INTEL_COMPILER
-#include <malloc.h>
-#define alloca _alloca
-#elif defined(WIN32) || defined(__WIN32) || defined(__WIN32__)
-// For alloca().
-#include <malloc.h>
-#else
-#include <alloca.h>
-#endif
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace amici {
 
@@ -111,221 +110,339 @@ double pos_pow(double base, double exponent) {
 
 
 // Legacy spline implementation in C (MATLAB only)
-double spline(double t, int num, ...) {
 
-    va_list valist;
+/**
+ * @brief Knots and boundary conditions of a spline
+ */
+struct SplineKnots {
+    /** abscissas of the knots */
+    std::vector<double> nodes;
+    /** boundary condition flag at the first knot */
+    double ss {0.0};
+    /** slope at the first knot */
+    double dudt {0.0};
+
+    /**
+     * @brief Equality operator
+     * @param other other knots
+     * @return true if the knots and boundary conditions are the same
+     */
+    bool operator==(SplineKnots const &other) const {
+        return ss == other.ss && dudt == other.dudt && nodes == other.nodes;
+    }
+};
 
-    double uout;
-    double ss;
-    double dudt;
+/**
+ * @brief Spline through given values, or their logarithms
+ */
+struct SplineCacheEntry {
+    /** knots and boundary conditions */
+    SplineKnots knots;
+    /** values at the knots */
+    std::vector<double> values;
+    /** whether the spline interpolates the logarithms of values */
+    bool log_values {false};
+    /** spline coefficients */
+    CubicSpline spline;
+};
+
+/**
+ * @brief Splines through the unit vectors, i.e. derivatives of a spline with
+ * respect to the values at the knots, which only depend on the knots
+ */
+struct UnitSplineCacheEntry {
+    /** knots and boundary conditions */
+    SplineKnots knots;
+    /** splines through the unit vectors, computed on demand */
+    std::vector<CubicSpline> unit_splines;
+};
 
-    auto *ts = (double *)alloca(num * sizeof(double));
-    auto *us = (double *)alloca(num * sizeof(double));
+/**
+ * @brief local helper function to combine a hash with the bits of a double
+ * @param seed hash to update
+ * @param value value
+ */
+static void hashCombine(std::size_t &seed, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    seed ^= std::hash<std::uint64_t>()(bits) + 0x9e3779b9 + (seed << 6)
+            + (seed >> 2);
+}
 
-    auto *b = (double *)alloca(num * sizeof(double));
-    auto *c = (double *)alloca(num * sizeof(double));
-    auto *d = (double *)alloca(num * sizeof(double));
+/**
+ * @brief local helper function to hash the knots and boundary conditions
+ * @param knots knots and boundary conditions
+ * @return hash
+ */
+static std::size_t hashSplineKnots(SplineKnots const &knots) {
+    std::size_t seed = knots.nodes.size();
+    for (auto node : knots.nodes)
+        hashCombine(seed, node);
+    hashCombine(seed, knots.ss);
+    hashCombine(seed, knots.dudt);
+    return seed;
+}
 
-    /* Variable list type macro */
-    /* initialize valist for num number of arguments */
-    va_start(valist, num);
+/** maximum number of entries kept in each spline cache per thread */
+constexpr std::size_t max_spline_cache_size = 64;
 
-    for (int i = 0; i < 2 * num; i += 2) {
-        int j = i / 2;
-        ts[j] = va_arg(valist, double);
-        us[j] = va_arg(valist, double);
+/**
+ * @brief Least recently used cache of spline entries. Entries are looked up
+ * by the hash of their arguments, the list only keeps track of the order of
+ * use for eviction.
+ */
+template <typename Entry> class SplineCache {
+  public:
+    /**
+     * @brief Looks up an entry, or adds a new one, evicting the least
+     * recently used entry if the cache is full
+     * @param hash hash of the arguments identifying the entry
+     * @param matches predicate identifying the entry among those with the
+     * same hash
+     * @param created set to true if a new (default constructed) entry was
+     * added
+     * @return entry, marked as most recently used
+     */
+    template <typename Predicate>
+    Entry &get(std::size_t hash, Predicate const &matches, bool &created) {
+        auto range = index_.equal_range(hash);
+        auto found = std::find_if(range.first, range.second,
+                                  [&](typename Index::value_type const &e) {
+                                      return matches(e.second->second);
+                                  });
+        created = found == range.second;
+        typename List::iterator entry;
+        if (created) {
+            ++misses_;
+            if (entries_.size() >= max_spline_cache_size) {
+                /* reuse the least recently used entry */
+                entry = std::prev(entries_.end());
+                eraseIndex(entry);
+                entry->second = Entry();
+            } else {
+                entry = entries_.emplace(entries_.end());
+            }
+            entry->first = hash;
+            index_.emplace(hash, entry);
+        } else {
+            ++hits_;
+            entry = found->second;
+        }
+        entries_.splice(entries_.begin(), entries_, entry);
+        return entries_.front().second;
     }
-    ss = va_arg(valist, double);
-    dudt = va_arg(valist, double);
 
-    /* clean memory reserved for valist */
-    va_end(valist);
+    /** number of lookups that found an entry */
+    long hits_ {0};
+
+    /** number of lookups that added an entry */
+    long misses_ {0};
+
+  private:
+    /** list of hashes and entries */
+    using List = std::list<std::pair<std::size_t, Entry>>;
+
+    /** map from hashes to entries */
+    using Index = std::unordered_multimap<std::size_t,
+                                          typename List::iterator>;
+
+    /**
+     * @brief Removes an entry from the index
+     * @param entry entry
+     */
+    void eraseIndex(typename List::iterator entry) {
+        auto range = index_.equal_range(entry->first);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == entry) {
+                index_.erase(it);
+                return;
+            }
+        }
+    }
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, us, b, c, d);
-    uout = seval(num, t, ts, us, b, c, d);
+    /** hashes and entries, ordered from most to least recently used */
+    List entries_;
 
-    return uout;
-}
+    /** entries by hash */
+    Index index_;
+};
 
-double spline_pos(double t, int num, ...) {
+/** splines of the calling thread */
+static thread_local SplineCache<SplineCacheEntry> spline_cache;
 
-    va_list valist;
+/** unit vector splines of the calling thread */
+static thread_local SplineCache<UnitSplineCacheEntry> unit_spline_cache;
 
-    double uout;
-    double ss;
-    double dudt;
+long getSplineCacheHits() {
+    return spline_cache.hits_ + unit_spline_cache.hits_;
+}
 
-    auto *ts = (double *)alloca(num * sizeof(double));
-    auto *us = (double *)alloca(num * sizeof(double));
-    auto *uslog = (double *)alloca(num * sizeof(double));
+long getSplineCacheMisses() {
+    return spline_cache.misses_ + unit_spline_cache.misses_;
+}
 
-    auto *b = (double *)alloca(num * sizeof(double));
-    auto *c = (double *)alloca(num * sizeof(double));
-    auto *d = (double *)alloca(num * sizeof(double));
+/**
+ * @brief local helper function to read the variadic spline arguments
+ * @param num number of knots
+ * @param args variadic arguments: num pairs of knot abscissa and value,
+ * followed by boundary condition flag and slope at the first knot
+ * @param knots buffer for knots and boundary conditions
+ * @param values buffer for the values at the knots
+ */
+static void readSplineArguments(int num, va_list args, SplineKnots &knots,
+                                std::vector<double> &values) {
+    knots.nodes.resize(num);
+    values.resize(num);
+    for (int j = 0; j < num; ++j) {
+        knots.nodes[j] = va_arg(args, double);
+        values[j] = va_arg(args, double);
+    }
+    knots.ss = va_arg(args, double);
+    knots.dudt = va_arg(args, double);
+}
 
-    /* initialize valist for num number of arguments */
-    va_start(valist, num);
+/**
+ * @brief local helper function to get the spline through the given values
+ * or their logarithms, computing the coefficients only if this spline is not
+ * cached
+ * @param knots knots and boundary conditions
+ * @param values values at the knots
+ * @param log_values whether to interpolate the logarithms of values
+ * @return spline
+ */
+static CubicSpline const &getSpline(SplineKnots const &knots,
+                                    std::vector<double> const &values,
+                                    bool log_values) {
+    auto hash = hashSplineKnots(knots);
+    for (auto value : values)
+        hashCombine(hash, value);
+    hashCombine(hash, log_values ? 1.0 : 0.0);
+    bool created;
+    auto &entry = spline_cache.get(
+        hash,
+        [&](SplineCacheEntry const &e) {
+            return e.log_values == log_values && e.values == values
+                   && e.knots == knots;
+        },
+        created);
+    if (created) {
+        entry.knots = knots;
+        entry.values = values;
+        entry.log_values = log_values;
+        std::vector<double> spline_values(values);
+        if (log_values)
+            std::transform(values.begin(), values.end(),
+                           spline_values.begin(),
+                           [](double v) { return log(v); });
+        entry.spline =
+            CubicSpline(knots.nodes, std::move(spline_values),
+                        static_cast<int>(knots.ss) == 1, knots.dudt);
+    }
+    return entry.spline;
+}
 
-    for (int i = 0; i < 2 * num; i += 2) {
-        int j = i / 2;
-        ts[j] = va_arg(valist, double);
-        us[j] = va_arg(valist, double);
-        uslog[j] = log(us[j]);
+/**
+ * @brief local helper function to get the spline through the unit vector
+ * e_index, i.e. the derivative of the spline with respect to the value at
+ * the knot with the given index
+ * @param knots knots and boundary conditions
+ * @param index knot index
+ * @return spline
+ */
+static CubicSpline const &getUnitSpline(SplineKnots const &knots, int index) {
+    bool created;
+    auto &entry = unit_spline_cache.get(
+        hashSplineKnots(knots),
+        [&](UnitSplineCacheEntry const &e) { return e.knots == knots; },
+        created);
+    if (created) {
+        entry.knots = knots;
+        entry.unit_splines.resize(knots.nodes.size());
+    }
+    auto &unit_spline = entry.unit_splines.at(index);
+    if (unit_spline.getValues().empty()) {
+        std::vector<double> unit(knots.nodes.size(), 0.0);
+        unit[index] = 1.0;
+        unit_spline = CubicSpline(knots.nodes, std::move(unit),
+                                  static_cast<int>(knots.ss) == 1, knots.dudt);
     }
-    ss = va_arg(valist, double);
-    dudt = va_arg(valist, double);
+    return unit_spline;
+}
 
-    /* clean memory reserved for valist */
-    va_end(valist);
+double spline(double t, int num, ...) {
+    static thread_local SplineKnots knots;
+    static thread_local std::vector<double> us;
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, uslog, b, c, d);
-    uout = seval(num, t, ts, uslog, b, c, d);
+    va_list valist;
+    va_start(valist, num);
+    readSplineArguments(num, valist, knots, us);
+    va_end(valist);
 
-    return exp(uout);
+    return getSpline(knots, us, false).evaluate(t);
 }
 
-double Dspline(int id, double t, int num, ...) {
+double spline_pos(double t, int num, ...) {
+    static thread_local SplineKnots knots;
+    static thread_local std::vector<double> us;
 
     va_list valist;
+    va_start(valist, num);
+    readSplineArguments(num, valist, knots, us);
+    va_end(valist);
 
-    double uout;
-    double ss;
-    double dudt;
-
-    double *ts = (double *)alloca(num * sizeof(double));
-    double *us = (double *)alloca(num * sizeof(double));
-    double *ps = (double *)alloca(num * sizeof(double));
+    return exp(getSpline(knots, us, true).evaluate(t));
+}
 
-    double *b = (double *)alloca(num * sizeof(double));
-    double *c = (double *)alloca(num * sizeof(double));
-    double *d = (double *)alloca(num * sizeof(double));
+double Dspline(int id, double t, int num, ...) {
+    static thread_local SplineKnots knots;
+    static thread_local std::vector<double> ps;
 
     int did = id / 2 - 2;
 
-    /* initialize valist for num number of arguments */
+    va_list valist;
     va_start(valist, num);
-
-    for (int i = 0; i < 2 * num; i += 2) {
-        int j = i / 2;
-        ts[j] = va_arg(valist, double);
-        ps[j] = va_arg(valist, double);
-        us[j] = 0.0;
-    }
-    us[did] = 1.0;
-    ss = va_arg(valist, double);
-    dudt = va_arg(valist, double);
-
-    /* clean memory reserved for valist */
+    readSplineArguments(num, valist, knots, ps);
     va_end(valist);
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, us, b, c, d);
-    uout = seval(num, t, ts, us, b, c, d);
-
-    return uout;
+    return getUnitSpline(knots, did).evaluate(t);
 }
 
 double Dspline_pos(int id, double t, int num, ...) {
-
-    va_list valist;
-
-    auto *ts = (double *)alloca(num * sizeof(double));
-    auto *us = (double *)alloca(num * sizeof(double));
-    auto *sus = (double *)alloca(num * sizeof(double));
-    auto *uslog = (double *)alloca(num * sizeof(double));
-
-    auto *b = (double *)alloca(num * sizeof(double));
-    auto *c = (double *)alloca(num * sizeof(double));
-    auto *d = (double *)alloca(num * sizeof(double));
-
-    double uout;
-    double ss;
-    double dudt;
-    double uspline_pos;
-    double suspline;
+    static thread_local SplineKnots knots;
+    static thread_local std::vector<double> us;
 
     int did = id / 2 - 2;
 
-    /* initialize valist for num number of arguments */
+    va_list valist;
     va_start(valist, num);
-
-    for (int i = 0; i < 2 * num; i += 2) {
-        int j = i / 2;
-        ts[j] = va_arg(valist, double);
-        us[j] = va_arg(valist, double);
-        uslog[j] = log(us[j]);
-        sus[j] = 0.0;
-    }
-    ss = va_arg(valist, double);
-    dudt = va_arg(valist, double);
-    sus[did] = 1.0;
-
-    /* clean memory reserved for valist */
+    readSplineArguments(num, valist, knots, us);
     va_end(valist);
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, uslog, b, c, d);
-    uspline_pos = exp(seval(num, t, ts, uslog, b, c, d));
+    double uspline_pos = exp(getSpline(knots, us, true).evaluate(t));
+    double suspline = getUnitSpline(knots, did).evaluate(t);
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, sus, b, c, d);
-    suspline = seval(num, t, ts, sus, b, c, d);
-    uout = suspline * uspline_pos / us[did];
-
-    return uout;
+    return suspline * uspline_pos / us[did];
 }
 
 double DDspline(int  /*id1*/, int  /*id2*/, double  /*t*/, int  /*num*/, ...) { return 0.0; }
 
 double DDspline_pos(int id1, int id2, double t, int num, ...) {
-
-    va_list valist;
-
-    auto *ts = (double *)alloca(num * sizeof(double));
-    auto *us = (double *)alloca(num * sizeof(double));
-    auto *sus1 = (double *)alloca(num * sizeof(double));
-    auto *sus2 = (double *)alloca(num * sizeof(double));
-    auto *uslog = (double *)alloca(num * sizeof(double));
-
-    auto *b = (double *)alloca(num * sizeof(double));
-    auto *c = (double *)alloca(num * sizeof(double));
-    auto *d = (double *)alloca(num * sizeof(double));
-
-    double uout;
-    double ss;
-    double dudt;
-    double uspline_pos;
-    double su1spline;
-    double su2spline;
+    static thread_local SplineKnots knots;
+    static thread_local std::vector<double> us;
 
     int did1 = id1 / 2 - 2;
     int did2 = id2 / 2 - 2;
 
-    /* initialize valist for num number of arguments */
+    va_list valist;
     va_start(valist, num);
-
-    for (int i = 0; i < 2 * num; i += 2) {
-        int j = i / 2;
-        ts[j] = va_arg(valist, double);
-        us[j] = va_arg(valist, double);
-        uslog[j] = log(us[j]);
-        sus1[j] = 0.0;
-        sus2[j] = 0.0;
-    }
-    ss = va_arg(valist, double);
-    dudt = va_arg(valist, double);
-    sus1[did1] = 1.0;
-    sus2[did2] = 1.0;
-
-    /* clean memory reserved for valist */
+    readSplineArguments(num, valist, knots, us);
     va_end(valist);
 
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, uslog, b, c, d);
-    uspline_pos = exp(seval(num, t, ts, uslog, b, c, d));
-
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, sus1, b, c, d);
-    su1spline = seval(num, t, ts, sus1, b, c, d);
-
-    spline(num, static_cast<int>(ss), 0, dudt, 0.0, ts, sus2, b, c, d);
-    su2spline = seval(num, t, ts, sus2, b, c, d);
+    double uspline_pos = exp(getSpline(knots, us, true).evaluate(t));
+    double su1spline = getUnitSpline(knots, did1).evaluate(t);
+    double su2spline = getUnitSpline(knots, did2).evaluate(t);
 
+    double uout;
     if (id1 == id2) {
         uout = (su1spline * su2spline - su1spline) * uspline_pos;
     } else {
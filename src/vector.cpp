@@ -2,46 +2,64 @@
 
 #include <functional>
 #include <algorithm>
+#include <stdexcept>
 
 namespace amici {
 
 AmiVector &AmiVector::operator=(AmiVector const &other) {
-    vec_ = other.vec_;
+    if (is_view_) {
+        copy(other);
+        return *this;
+    }
+    if (&other == this)
+        return *this;
+    vec_.assign(other.data(), other.data() + other.getLength());
     synchroniseNVector();
     return *this;
 }
 
-realtype *AmiVector::data() { return vec_.data(); }
+realtype *AmiVector::data() {
+    return is_view_ ? N_VGetArrayPointer(nvec_) : vec_.data();
+}
 
-const realtype *AmiVector::data() const { return vec_.data(); }
+const realtype *AmiVector::data() const {
+    return is_view_ ? N_VGetArrayPointerConst(nvec_) : vec_.data();
+}
 
 N_Vector AmiVector::getNVector() { return nvec_; }
 
 const_N_Vector AmiVector::getNVector() const { return nvec_; }
 
-std::vector<realtype> const &AmiVector::getVector() const { return vec_; }
+std::vector<realtype> AmiVector::getVector() const {
+    return std::vector<realtype>(data(), data() + getLength());
+}
 
-int AmiVector::getLength() const { return static_cast<int>(vec_.size()); }
+int AmiVector::getLength() const {
+    return static_cast<int>(is_view_ ? NV_LENGTH_S(nvec_) : vec_.size());
+}
 
 void AmiVector::zero() { set(0.0); }
 
 void AmiVector::minus() {
-    std::transform(vec_.begin(), vec_.end(),
-                   vec_.begin(), std::negate<realtype>());
+    std::transform(begin(), end(), begin(), std::negate<realtype>());
 }
 
-void AmiVector::set(realtype val) { std::fill(vec_.begin(), vec_.end(), val); }
+void AmiVector::set(realtype val) { std::fill(begin(), end(), val); }
 
 realtype &AmiVector::operator[](int pos) {
-    return vec_.at(static_cast<decltype(vec_)::size_type>(pos));
+    return at(pos);
 }
 
 realtype &AmiVector::at(int pos) {
-    return vec_.at(static_cast<decltype(vec_)::size_type>(pos));
+    if (pos < 0 || pos >= getLength())
+        throw std::out_of_range("AmiVector::at");
+    return data()[pos];
 }
 
 const realtype &AmiVector::at(int pos) const {
-    return vec_.at(static_cast<decltype(vec_)::size_type>(pos));
+    if (pos < 0 || pos >= getLength())
+        throw std::out_of_range("AmiVector::at");
+    return data()[pos];
 }
 
 void AmiVector::copy(const AmiVector &other) {
@@ -49,8 +67,7 @@ void AmiVector::copy(const AmiVector &other) {
         throw AmiException("Dimension of AmiVector (%i) does not "
                            "match input dimension (%i)",
                            getLength(), other.getLength());
-    std::copy(other.vec_.begin(), other.vec_.end(), vec_.begin());
-    synchroniseNVector();
+    std::copy(other.data(), other.data() + other.getLength(), data());
 }
 
 void AmiVector::synchroniseNVector() {
@@ -65,30 +82,51 @@ AmiVector::~AmiVector() {
 }
 
 AmiVectorArray::AmiVectorArray(long int length_inner, long int length_outer)
-    : vec_array_(length_outer, AmiVector(length_inner)) {
-    nvec_array_.resize(length_outer);
-    for (int idx = 0; idx < length_outer; idx++) {
-        nvec_array_.at(idx) = vec_array_.at(idx).getNVector();
-    }
+    : length_inner_(length_inner),
+      data_(static_cast<decltype(data_)::size_type>(length_inner
+                                                    * length_outer), 0.0) {
+    createViews(length_outer);
 }
 
 AmiVectorArray &AmiVectorArray::operator=(AmiVectorArray const &other) {
-    vec_array_ = other.vec_array_;
-    nvec_array_.resize(other.getLength());
-    for (int idx = 0; idx < other.getLength(); idx++) {
-        nvec_array_.at(idx) = vec_array_.at(idx).getNVector();
+    if (&other == this)
+        return *this;
+    if (length_inner_ == other.length_inner_
+        && getLength() == other.getLength()) {
+        /* keep views and N_Vectors valid */
+        std::copy(other.data_.begin(), other.data_.end(), data_.begin());
+        return *this;
     }
+    length_inner_ = other.length_inner_;
+    data_ = other.data_;
+    createViews(other.getLength());
     return *this;
 }
 
 AmiVectorArray::AmiVectorArray(const AmiVectorArray &vaold)
-    : vec_array_(vaold.vec_array_) {
-    nvec_array_.resize(vaold.getLength());
-    for (int idx = 0; idx < vaold.getLength(); idx++) {
+    : length_inner_(vaold.length_inner_), data_(vaold.data_) {
+    createViews(vaold.getLength());
+}
+
+void AmiVectorArray::createViews(long int length_outer) {
+    vec_array_.clear();
+    vec_array_.reserve(length_outer);
+    nvec_array_.resize(length_outer);
+    for (int idx = 0; idx < length_outer; idx++) {
+        vec_array_.push_back(
+            AmiVector(data_.data() + idx * length_inner_, length_inner_));
         nvec_array_.at(idx) = vec_array_.at(idx).getNVector();
     }
 }
 
+gsl::span<realtype> AmiVectorArray::data() {
+    return gsl::make_span(data_);
+}
+
+gsl::span<const realtype> AmiVectorArray::data() const {
+    return gsl::make_span(data_);
+}
+
 realtype *AmiVectorArray::data(int pos) { return vec_array_.at(pos).data(); }
 
 const realtype *AmiVectorArray::data(int pos) const {
@@ -120,26 +158,21 @@ int AmiVectorArray::getLength() const {
 }
 
 void AmiVectorArray::zero() {
-    for (auto &v : vec_array_)
-        v.zero();
+    std::fill(data_.begin(), data_.end(), 0.0);
 }
 
 void AmiVectorArray::flatten_to_vector(std::vector<realtype> &vec) const {
-    int n_outer = static_cast<int>(vec_array_.size());
-    if (n_outer == 0)
+    if (vec_array_.empty())
         return; // nothing to do ...
-    int n_inner = vec_array_.at(0).getLength();
 
-    if (static_cast<int>(vec.size()) != n_inner * n_outer) {
+    if (vec.size() != data_.size()) {
         throw AmiException("Dimension of AmiVectorArray (%ix%i) does not "
                            "match target vector dimension (%u)",
-                           n_inner, n_outer, vec.size());
+                           static_cast<int>(length_inner_), getLength(),
+                           vec.size());
     }
 
-    for (int outer = 0; outer < n_outer; ++outer) {
-        for (int inner = 0; inner < n_inner; ++inner)
-            vec.at(inner + outer * n_inner) = this->at(inner, outer);
-    }
+    std::copy(data_.begin(), data_.end(), vec.begin());
 }
 
 void AmiVectorArray::copy(const AmiVectorArray &other) {
@@ -147,11 +180,13 @@ void AmiVectorArray::copy(const AmiVectorArray &other) {
         throw AmiException("Dimension of AmiVectorArray (%i) does not "
                            "match input dimension (%i)",
                            getLength(), other.getLength());
+    if (length_inner_ != other.length_inner_)
+        throw AmiException("Dimension of AmiVector (%i) does not "
+                           "match input dimension (%i)",
+                           static_cast<int>(length_inner_),
+                           static_cast<int>(other.length_inner_));
 
-    for (int iv = 0; iv < getLength(); ++iv) {
-        vec_array_.at(iv).copy(other.vec_array_.at(iv));
-        nvec_array_[iv] = vec_array_.at(iv).getNVector();
-    }
+    std::copy(other.data_.begin(), other.data_.end(), data_.begin());
 }
 
 } // namespace amici
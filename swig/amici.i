@@ -12,7 +12,11 @@ common pitfalls when accessing C++ types from python and implement some
 nonstandard type conversions.
 """
 %enddef
-%module (docstring=DOCSTRING) amici
+%module (docstring=DOCSTRING, threads="1") amici
+
+// Keep the GIL by default, it is only released for long-running calls
+// (simulations, HDF5 I/O) that are marked with %thread below
+%nothread;
 
 // typemaps for docstrings
 %typemap(doctype) std::unique_ptr< amici::ExpData >::pointer "ExpData";
@@ -36,11 +40,13 @@ nonstandard type conversions.
 %typemap(doctype) amici::Model const * "amici.Model";
 %typemap(doctype) amici::NewtonDampingFactorMode "amici.NewtonDampingFactorMode";
 %typemap(doctype) amici::NonlinearSolverIteration "amici.NonlinearSolverIteration";
+%typemap(doctype) amici::PreconditionerType "amici.PreconditionerType";
 %typemap(doctype) amici::RDataReporting "amici.RDataReporting";
 %typemap(doctype) amici::SensitivityMethod "amici.SensitivityMethod";
 %typemap(doctype) amici::SensitivityOrder "amici.SensitivityOrder";
 %typemap(doctype) amici::Solver * "amici.Solver";
 %typemap(doctype) amici::SteadyStateSensitivityMode "amici.SteadyStateSensitivityMode";
+%typemap(doctype) amici::SteadyStateWarmStartMode "amici.SteadyStateWarmStartMode";
 %typemap(doctype) amici::realtype "float";
 %typemap(doctype) DoubleVector "numpy.ndarray";
 %typemap(doctype) IntVector "List[int]";
@@ -80,6 +86,7 @@ import_array();
 %include <stl.i>
 %template(DoubleVector) std::vector<double>;
 %template(IntVector) std::vector<int>;
+%template(IntVectorVector) std::vector<std::vector<int>>;
 %template(BoolVector) std::vector<bool>;
 %template(StringVector) std::vector<std::string>;
 %feature("docstring") std::map<std::string, double>
@@ -165,6 +172,15 @@ using namespace amici;
 %ignore std::vector<std::unique_ptr<amici::ReturnData>>;
 %template(ReturnDataPtrVector) std::vector<std::unique_ptr<amici::ReturnData>>;
 
+// Release the GIL during simulations. Concurrent calls from different Python
+// threads are safe as long as they use distinct Model and Solver instances.
+%thread amici::runAmiciSimulation;
+%thread amici::runAmiciSimulations;
+%thread amici::runAmiciSimulationsAggregated;
+%thread amici::AmiciApplication::runAmiciSimulation;
+%thread amici::AmiciApplication::runAmiciSimulations;
+%thread amici::AmiciApplication::runAmiciSimulationsAggregated;
+
 // Process symbols in header
 %include "amici/amici.h"
 
@@ -238,6 +254,7 @@ SecondOrderMode = enum('SecondOrderMode')
 SensitivityOrder = enum('SensitivityOrder')
 SensitivityMethod = enum('SensitivityMethod')
 LinearSolver = enum('LinearSolver')
+PreconditionerType = enum('PreconditionerType')
 InternalSensitivityMethod = enum('InternalSensitivityMethod')
 InterpolationType = enum('InterpolationType')
 LinearMultistepMethod = enum('LinearMultistepMethod')
@@ -245,6 +262,7 @@ NonlinearSolverIteration = enum('NonlinearSolverIteration')
 SteadyStateSensitivityMode = enum('SteadyStateSensitivityMode')
 SteadyStateStatus = enum('SteadyStateStatus')
 NewtonDampingFactorMode = enum('NewtonDampingFactorMode')
+SteadyStateWarmStartMode = enum('SteadyStateWarmStartMode')
 FixedParameterContext = enum('FixedParameterContext')
 RDataReporting = enum('RDataReporting')
 %}
@@ -8,5 +8,48 @@ using namespace amici;
 
 %ignore ConditionContext;
 
+// Numpy arrays with copies of the data buffers, used by
+// amici.numpy.ExpDataView. Unlike for ReturnData, these are not views, since
+// the buffers are reallocated when the dimensions of the ExpData instance
+// change, e.g. in setTimepoints or setObservedData.
+%extend amici::ExpData {
+    PyObject *_field_as_numpy(std::string const &field,
+                              std::vector<int> const &dims,
+                              PyObject *owner) {
+        // the buffers are only exposed through const accessors, but the
+        // object itself is mutable
+        std::vector<amici::realtype> *vec = nullptr;
+        if (field == "observedData")
+            vec = const_cast<std::vector<amici::realtype> *>(
+                &$self->getObservedData());
+        else if (field == "observedDataStdDev")
+            vec = const_cast<std::vector<amici::realtype> *>(
+                &$self->getObservedDataStdDev());
+        else if (field == "observedEvents")
+            vec = const_cast<std::vector<amici::realtype> *>(
+                &$self->getObservedEvents());
+        else if (field == "observedEventsStdDev")
+            vec = const_cast<std::vector<amici::realtype> *>(
+                &$self->getObservedEventsStdDev());
+        else if (field == "fixedParameters")
+            vec = &$self->fixedParameters;
+        else if (field == "fixedParametersPreequilibration")
+            vec = &$self->fixedParametersPreequilibration;
+        else if (field == "fixedParametersPresimulation")
+            vec = &$self->fixedParametersPresimulation;
+        else
+            throw std::invalid_argument("Unknown ExpData field: " + field);
+        auto view = stdVec2ndarrayView(*vec, dims, owner, false);
+        if (view == Py_None)
+            return view;
+        auto copy = PyArray_NewCopy(reinterpret_cast<PyArrayObject *>(view),
+                                    NPY_CORDER);
+        Py_DECREF(view);
+        if (!copy)
+            throw std::runtime_error("Unknown failure in _field_as_numpy");
+        return copy;
+    }
+}
+
 // Process symbols in header
 %include "amici/edata.h"
@@ -8,6 +8,21 @@
 %rename("%s") amici::hdf5::writeSimulationExpData;
 %rename("%s") amici::hdf5::writeSolverSettingsToHDF5;
 
+// Release the GIL during file I/O. Only the overloads taking a file name
+// serialize access to libhdf5, which is not necessarily thread-safe.
+%thread amici::hdf5::readModelDataFromHDF5(std::string const &, Model &,
+                                           std::string const &);
+%thread amici::hdf5::readSimulationExpData(const std::string &,
+                                           const std::string &,
+                                           const Model &);
+%thread amici::hdf5::readSolverSettingsFromHDF5(std::string const &, Solver &,
+                                                std::string const &);
+%thread amici::hdf5::writeReturnData(const ReturnData &, std::string const &,
+                                     const std::string &);
+%thread amici::hdf5::writeSolverSettingsToHDF5(Solver const&,
+                                               std::string const&,
+                                               std::string const&);
+
 // Add necessary symbols to generated header
 %{
 #ifndef AMICI_SWIG_WITHOUT_HDF5
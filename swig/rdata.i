@@ -3,11 +3,96 @@
 // Add necessary symbols to generated header
 %{
 #include "amici/rdata.h"
+
+#include <map>
 using namespace amici;
 %}
 
 %ignore processSimulationObjects;
+%ignore checkInnerParameters;
 %ignore ModelContext;
 
+// Read-only numpy views on the result buffers, used by
+// amici.numpy.ReturnDataView
+%extend amici::ReturnData {
+    PyObject *_field_as_numpy(std::string const &field,
+                              std::vector<int> const &dims,
+                              PyObject *owner) {
+        using amici::ReturnData;
+        static std::map<std::string,
+                        std::vector<amici::realtype> ReturnData::*> const
+            double_fields = {
+                {"ts", &ReturnData::ts},
+                {"x", &ReturnData::x},
+                {"x0", &ReturnData::x0},
+                {"x_ss", &ReturnData::x_ss},
+                {"sx", &ReturnData::sx},
+                {"sx0", &ReturnData::sx0},
+                {"sx_ss", &ReturnData::sx_ss},
+                {"y", &ReturnData::y},
+                {"sigmay", &ReturnData::sigmay},
+                {"sy", &ReturnData::sy},
+                {"ssigmay", &ReturnData::ssigmay},
+                {"z", &ReturnData::z},
+                {"rz", &ReturnData::rz},
+                {"sigmaz", &ReturnData::sigmaz},
+                {"sz", &ReturnData::sz},
+                {"srz", &ReturnData::srz},
+                {"ssigmaz", &ReturnData::ssigmaz},
+                {"sllh", &ReturnData::sllh},
+                {"s2llh", &ReturnData::s2llh},
+                {"inner_parameters", &ReturnData::inner_parameters},
+                {"res", &ReturnData::res},
+                {"sres", &ReturnData::sres},
+                {"FIM", &ReturnData::FIM},
+                {"J", &ReturnData::J},
+                {"w", &ReturnData::w},
+                {"xdot", &ReturnData::xdot},
+            };
+        static std::map<std::string, std::vector<int> ReturnData::*> const
+            int_fields = {
+                {"preeq_numlinsteps", &ReturnData::preeq_numlinsteps},
+                {"preeq_numsteps", &ReturnData::preeq_numsteps},
+                {"posteq_numlinsteps", &ReturnData::posteq_numlinsteps},
+                {"posteq_numsteps", &ReturnData::posteq_numsteps},
+                {"numsteps", &ReturnData::numsteps},
+                {"numrhsevals", &ReturnData::numrhsevals},
+                {"numerrtestfails", &ReturnData::numerrtestfails},
+                {"numnonlinsolvconvfails",
+                 &ReturnData::numnonlinsolvconvfails},
+                {"order", &ReturnData::order},
+                {"numstepsB", &ReturnData::numstepsB},
+                {"numrhsevalsB", &ReturnData::numrhsevalsB},
+                {"numerrtestfailsB", &ReturnData::numerrtestfailsB},
+                {"numnonlinsolvconvfailsB",
+                 &ReturnData::numnonlinsolvconvfailsB},
+            };
+        static_assert(sizeof(amici::SteadyStateStatus) == sizeof(npy_int),
+                      "SteadyStateStatus size mismatch");
+        static std::map<std::string,
+                        std::vector<amici::SteadyStateStatus> ReturnData::*>
+            const status_fields = {
+                {"preeq_status", &ReturnData::preeq_status},
+                {"posteq_status", &ReturnData::posteq_status},
+            };
+
+        auto double_field = double_fields.find(field);
+        if (double_field != double_fields.end())
+            return stdVec2ndarrayView($self->*(double_field->second), dims,
+                                      owner, false);
+        auto int_field = int_fields.find(field);
+        if (int_field != int_fields.end())
+            return stdVec2ndarrayView($self->*(int_field->second), dims,
+                                      owner, false);
+        auto status_field = status_fields.find(field);
+        if (status_field != status_fields.end()) {
+            auto &vec = $self->*(status_field->second);
+            return buffer2ndarrayView(vec.data(), vec.size(), NPY_INT, dims,
+                                      owner, false);
+        }
+        throw std::invalid_argument("Unknown ReturnData field: " + field);
+    }
+}
+
 // Process symbols in header
 %include "amici/rdata.h"
@@ -39,6 +39,10 @@ using namespace amici;
 %ignore turnOffRootFinding;
 %ignore getRootInfo;
 %ignore updateAndReinitStatesAndSensitivities;
+%ignore getSteadyStateWarmStart;
+%ignore getPreconditioner;
+%ignore getPreconditionerB;
+%ignore countRhsEval;
 
 
 %newobject amici::Solver::clone;
@@ -125,4 +125,82 @@ PyObject* stdVec2ndarray(std::vector<int>& vec, int dim1, int dim2, int dim3, in
     return array;
 }
 
+#ifndef SWIG
+/**
+ * @brief Create a numpy ndarray view (row-major) on a contiguous buffer
+ * without copying.
+ *
+ * The array holds a reference to `owner`, which has to keep the buffer alive
+ * and must not reallocate it while the array exists.
+ *
+ * @param data buffer
+ * @param size number of elements in the buffer
+ * @param typenum numpy type of the buffer elements
+ * @param dims array dimensions
+ * @param owner Python object owning the buffer
+ * @param writeable whether the array may be modified
+ * @return array, or None if the buffer is empty
+ */
+PyObject* buffer2ndarrayView(void *data, std::size_t size, int typenum,
+                             std::vector<int> const& dims, PyObject *owner,
+                             bool writeable) {
+    if (size == 0)
+        Py_RETURN_NONE;
+
+    std::size_t expected_size = 1;
+    std::vector<npy_intp> npy_dims(dims.begin(), dims.end());
+    for (auto dim: dims)
+        expected_size *= dim;
+    if (size != expected_size)
+        throw std::runtime_error("Size mismatch in buffer2ndarrayView");
+
+    PyObject *array = PyArray_SimpleNewFromData(
+        static_cast<int>(npy_dims.size()), npy_dims.data(), typenum, data);
+    if (!array)
+        throw std::runtime_error("Unknown failure in buffer2ndarrayView");
+    if (!writeable)
+        PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(array),
+                           NPY_ARRAY_WRITEABLE);
+    Py_INCREF(owner);
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(array),
+                              owner) < 0) {
+        Py_DECREF(array);
+        throw std::runtime_error("Unknown failure in buffer2ndarrayView");
+    }
+    return array;
+}
+
+/**
+ * @brief Create a *non-owning* numpy ndarray view on a std::vector<double>
+ * that keeps `owner` alive, see buffer2ndarrayView.
+ * @param vec
+ * @param dims
+ * @param owner
+ * @param writeable
+ * @return
+ */
+PyObject* stdVec2ndarrayView(std::vector<double>& vec,
+                             std::vector<int> const& dims, PyObject *owner,
+                             bool writeable) {
+    return buffer2ndarrayView(vec.data(), vec.size(), NPY_DOUBLE, dims, owner,
+                              writeable);
+}
+
+/**
+ * @brief Create a *non-owning* numpy ndarray view on a std::vector<int>
+ * that keeps `owner` alive, see buffer2ndarrayView.
+ * @param vec
+ * @param dims
+ * @param owner
+ * @param writeable
+ * @return
+ */
+PyObject* stdVec2ndarrayView(std::vector<int>& vec,
+                             std::vector<int> const& dims, PyObject *owner,
+                             bool writeable) {
+    return buffer2ndarrayView(vec.data(), vec.size(), NPY_INT, dims, owner,
+                              writeable);
+}
+#endif
+
 }
@@ -1,6 +1,8 @@
 #include "testfunctions.h"
 
 #include "wrapfunctions.h"
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 
 #include <gtest/gtest.h>
@@ -19,3 +21,64 @@ TEST(ExampleEvents, SensitivityForward)
 {
     amici::simulateVerifyWrite("/model_events/sensiforward/");
 }
+
+/**
+ * @brief Events model whose time-triggered events (`t = 4` and `t = p[3]`)
+ * are scheduled in advance instead of located by root finding
+ */
+class Model_model_events_scheduled
+    : public amici::model_model_events::Model_model_events {
+  public:
+    Model_model_events_scheduled() { time_triggered_events_ = {2, 3, 4, 5}; }
+
+    amici::Model *clone() const override {
+        return new Model_model_events_scheduled(*this);
+    }
+
+    void ftrigger_times(amici::realtype *trigger_times,
+                        const amici::realtype *p,
+                        const amici::realtype * /*k*/) override {
+        trigger_times[0] = 4.0;
+        trigger_times[1] = p[3];
+        trigger_times[2] = 4.0;
+        trigger_times[3] = p[3];
+    }
+};
+
+TEST(ExampleEvents, ScheduledEventsMatchRootFinding)
+{
+    auto model = amici::generic_model::getModel();
+    Model_model_events_scheduled model_scheduled;
+    ASSERT_TRUE(model->getTimeTriggeredEvents().empty());
+
+    for (auto model_ptr : {model.get(), static_cast<amici::Model *>(
+                                            &model_scheduled)}) {
+        model_ptr->setParameters({0.5, 2.0, 0.5, 2.5});
+        model_ptr->setTimepoints({0.0, 1.0, 2.0, 3.0, 5.0, 7.5, 10.0});
+    }
+
+    auto solver = model->getSolver();
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+    solver->setSensitivityMethod(amici::SensitivityMethod::forward);
+    solver->setAbsoluteTolerance(1e-12);
+    solver->setRelativeTolerance(1e-10);
+
+    auto rdata = runAmiciSimulation(*solver, nullptr, *model);
+    auto rdata_scheduled = runAmiciSimulation(*solver, nullptr,
+                                              model_scheduled);
+    ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+    ASSERT_EQ(amici::AMICI_SUCCESS, rdata_scheduled->status);
+
+    // the state-dependent events, whose event outputs are their event times,
+    // are still located by root finding
+    ASSERT_GT(std::count_if(rdata->z.begin(), rdata->z.end(),
+                            [](double z) { return !std::isnan(z); }), 0);
+    amici::checkEqualArray(rdata->z, rdata_scheduled->z, 1e-8, 1e-6, "z");
+    amici::checkEqualArray(rdata->sz, rdata_scheduled->sz, 1e-6, 1e-5, "sz");
+    amici::checkEqualArray(rdata->x, rdata_scheduled->x, 1e-8, 1e-6, "x");
+    amici::checkEqualArray(rdata->sx, rdata_scheduled->sx, 1e-6, 1e-5, "sx");
+
+    // scheduled events require stopping the integrator at their trigger
+    // times instead of locating them
+    ASSERT_LE(rdata_scheduled->numrhsevals.back(), rdata->numrhsevals.back());
+}
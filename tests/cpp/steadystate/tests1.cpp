@@ -2,6 +2,7 @@
 
 #include "wrapfunctions.h"
 #include <cstring>
+#include <numeric>
 
 #include <gtest/gtest.h>
 
@@ -219,3 +220,584 @@ TEST(ExampleSteadystate, SensiAdjByhandPreeq)
 {
     amici::simulateVerifyWrite("/model_steadystate/sensiadjbyhandpreeq/");
 }
+
+TEST(ExampleSteadystate, PreconditionedIterativeLinearSolvers)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 2.0, 5.0, 10.0});
+
+    amici::ExpData edata(*model);
+    edata.setObservedData(
+        std::vector<double>(edata.nt() * edata.nytrue(), 0.5));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+
+    for (auto sensi_meth : {amici::SensitivityMethod::forward,
+                            amici::SensitivityMethod::adjoint}) {
+        auto solver = model->getSolver();
+        solver->setSensitivityOrder(amici::SensitivityOrder::first);
+        solver->setSensitivityMethod(sensi_meth);
+        auto rdata_dense = runAmiciSimulation(*solver, &edata, *model);
+        ASSERT_EQ(amici::AMICI_SUCCESS, rdata_dense->status);
+
+        for (auto linsol : {amici::LinearSolver::SPGMR,
+                            amici::LinearSolver::SPBCG}) {
+            solver->setLinearSolver(linsol);
+            solver->setPreconditionerType(amici::PreconditionerType::none);
+            auto rdata_none = runAmiciSimulation(*solver, &edata, *model);
+            ASSERT_EQ(amici::AMICI_SUCCESS, rdata_none->status);
+            amici::checkEqualArray(rdata_dense->sllh, rdata_none->sllh,
+                                   1e-6, 1e-4, "sllh");
+
+            // the preconditioner is applied in both the forward and the
+            // backward problem and must not change the gradient
+            for (auto preconditioner : {amici::PreconditionerType::jacobi,
+                                        amici::PreconditionerType::blockJacobi,
+                                        amici::PreconditionerType::ILU}) {
+                solver->setPreconditionerType(preconditioner);
+                auto rdata = runAmiciSimulation(*solver, &edata, *model);
+                ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+                ASSERT_NEAR(rdata_none->llh, rdata->llh,
+                            1e-4 * std::abs(rdata_none->llh));
+                amici::checkEqualArray(rdata_none->x, rdata->x, 1e-6, 1e-4,
+                                       "x");
+                amici::checkEqualArray(rdata_none->sllh, rdata->sllh, 1e-6,
+                                       1e-4, "sllh");
+            }
+        }
+    }
+}
+
+TEST(ExampleSteadystate, JacobianVectorProducts)
+{
+    auto model = amici::generic_model::getModel();
+    auto fresh_model = amici::generic_model::getModel();
+    auto &model_ode = dynamic_cast<amici::Model_ODE &>(*model);
+    auto &fresh_model_ode = dynamic_cast<amici::Model_ODE &>(*fresh_model);
+    auto nx = model->nx_solver;
+    amici::realtype t = 1.0;
+
+    amici::AmiVector x(model->getInitialStates());
+    auto x_other_values = x.getVector();
+    for (auto &xi : x_other_values)
+        xi = 2.0 * xi + 1.0;
+    amici::AmiVector x_other(x_other_values);
+    std::vector<amici::realtype> v_values(nx);
+    std::iota(v_values.begin(), v_values.end(), 1.0);
+    amici::AmiVector v(v_values);
+    amici::AmiVector xB(std::vector<amici::realtype>(nx, 0.5));
+    amici::AmiVector Jv(nx), JvB(nx), tmp(nx);
+
+    // Jacobians evaluated by other callbacks between the setup and the
+    // products of a linear solve must not change the products
+    model_ode.fJvSetup(t, x.getNVector());
+    model_ode.fJvSetupB(t, x.getNVector(), xB.getNVector());
+    model_ode.fJDiag(t, tmp.getNVector(), x_other.getNVector());
+    model_ode.fxBdot(t, x_other.getNVector(), xB.getNVector(),
+                     tmp.getNVector());
+    model_ode.fJv(v.getNVector(), Jv.getNVector());
+    model_ode.fJvB(v.getNVector(), JvB.getNVector());
+
+    amici::AmiVector Jv_fresh(nx), JvB_fresh(nx);
+    fresh_model_ode.fJv(v.getNVector(), Jv_fresh.getNVector(), t,
+                        x.getNVector());
+    fresh_model_ode.fJvB(v.getNVector(), JvB_fresh.getNVector(), t,
+                         x.getNVector(), xB.getNVector());
+    amici::checkEqualArray(Jv_fresh.getVector(), Jv.getVector(), TEST_ATOL,
+                           TEST_RTOL, "Jv");
+    amici::checkEqualArray(JvB_fresh.getVector(), JvB.getVector(), TEST_ATOL,
+                           TEST_RTOL, "JvB");
+
+    // simulations with a model that was used before agree with a fresh model
+    model->setTimepoints({1.0, 2.0, 5.0, 10.0});
+    amici::ExpData edata(*model);
+    edata.setObservedData(
+        std::vector<double>(edata.nt() * edata.nytrue(), 0.5));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    fresh_model->setTimepoints(model->getTimepoints());
+    for (auto sensi_meth : {amici::SensitivityMethod::forward,
+                            amici::SensitivityMethod::adjoint}) {
+        auto solver = model->getSolver();
+        solver->setSensitivityOrder(amici::SensitivityOrder::first);
+        solver->setSensitivityMethod(sensi_meth);
+        solver->setLinearSolver(amici::LinearSolver::SPGMR);
+        runAmiciSimulation(*solver, &edata, *model);
+        auto rdata = runAmiciSimulation(*solver, &edata, *model);
+        auto rdata_fresh = runAmiciSimulation(*solver, &edata, *fresh_model);
+        ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+        ASSERT_EQ(amici::AMICI_SUCCESS, rdata_fresh->status);
+        amici::checkEqualArray(rdata_fresh->x, rdata->x, TEST_ATOL,
+                               TEST_RTOL, "x");
+        amici::checkEqualArray(rdata_fresh->sllh, rdata->sllh, TEST_ATOL,
+                               TEST_RTOL, "sllh");
+    }
+}
+
+TEST(ExampleSteadystate, ConcurrentSteadyStateSearch)
+{
+    auto model = amici::generic_model::getModel();
+    auto solver = model->getSolver();
+    model->setTimepoints({1.0, INFINITY});
+    // Without damping, Newton's method does not converge from this starting
+    // point and only stops after the maximum number of steps, which takes
+    // much longer than finding the steady state by simulation
+    model->setInitialStates(std::vector<double>(model->nx_rdata, 10.0));
+    solver->setNewtonDampingFactorMode(amici::NewtonDampingFactorMode::off);
+    solver->setNewtonMaxSteps(10000000);
+    solver->setSteadyStateConcurrentSearch(true);
+
+    amici::ExpData edata(*model);
+    edata.fixedParametersPreequilibration = model->getFixedParameters();
+
+    // Newton's method must have been stopped by the converged simulation,
+    // also when running inside an OpenMP parallel region. The conditions
+    // must not share their preequilibration.
+    amici::ExpData edata2(edata);
+    edata2.fixedParametersPreequilibration[0] *= 1.5;
+    auto rdatas = runAmiciSimulations(*solver, {&edata, &edata2}, *model,
+                                      false, 2);
+    rdatas.push_back(runAmiciSimulation(*solver, &edata, *model));
+    for (auto const &rdata : rdatas) {
+        ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+        ASSERT_EQ(amici::SteadyStateStatus::not_run, rdata->preeq_status[0]);
+        ASSERT_EQ(amici::SteadyStateStatus::success, rdata->preeq_status[1]);
+        ASSERT_GT(rdata->preeq_numsteps[0], 0);
+        ASSERT_LT(rdata->preeq_numsteps[0], solver->getNewtonMaxSteps());
+        ASSERT_GT(rdata->preeq_numsteps[1], 0);
+    }
+}
+
+TEST(ExampleSteadystate, CheckpointMemoryBudget)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0, 100.0, 1000.0});
+
+    amici::ExpData edata(*model);
+    edata.setObservedData(std::vector<double>(edata.nt() * edata.nytrue(), 0.5));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+
+    auto solver = model->getSolver();
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+    solver->setSensitivityMethod(amici::SensitivityMethod::adjoint);
+    solver->setMaxSteps(500);
+    auto rdata_ref = runAmiciSimulation(*solver, &edata, *model);
+    ASSERT_EQ(amici::AMICI_SUCCESS, rdata_ref->status);
+    ASSERT_EQ(0, rdata_ref->numcheckpoints);
+    ASSERT_EQ(0, rdata_ref->numrecomputedrhsevals);
+
+    // memory per checkpoint (BDF Nordsieck history array) and per step of
+    // interpolation data (Hermite)
+    auto vector_size = model->nx_solver * sizeof(amici::realtype);
+    long int checkpoint_size = 6 * vector_size;
+    long int step_size = 2 * vector_size;
+    long int budget = 5000;
+
+    for (bool spill : {false, true}) {
+        solver->setCheckpointMemoryBudget(budget);
+        solver->setCheckpointSpill(spill);
+        auto rdata = runAmiciSimulation(*solver, &edata, *model);
+        ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+        ASSERT_GT(rdata->numcheckpoints, 0);
+        ASSERT_GT(rdata->numrecomputedrhsevals, 0);
+
+        // checkpoints in memory and interpolation data of (at least) one
+        // checkpoint interval fit into the budget
+        int num_intervals = rdata->numcheckpoints + 1;
+        int num_in_memory = spill ? std::min(num_intervals, 2) : num_intervals;
+        int steps_per_interval = rdata->numsteps.back() / num_intervals;
+        ASSERT_LE(num_in_memory * checkpoint_size
+                      + steps_per_interval * step_size,
+                  budget);
+
+        // results agree up to solver tolerances, checkpoints only force
+        // additional Jacobian updates
+        amici::checkEqualArray(rdata_ref->x, rdata->x, TEST_ATOL, TEST_RTOL,
+                               "x");
+        amici::checkEqualArray(rdata_ref->sllh, rdata->sllh, TEST_ATOL,
+                               TEST_RTOL, "sllh");
+    }
+
+    // spilled checkpoints allow for longer checkpoint intervals
+    solver->setCheckpointSpill(false);
+    auto rdata_memory = runAmiciSimulation(*solver, &edata, *model);
+    solver->setCheckpointSpill(true);
+    auto rdata_spill = runAmiciSimulation(*solver, &edata, *model);
+    ASSERT_LE(rdata_spill->numcheckpoints, rdata_memory->numcheckpoints);
+}
+
+TEST(ExampleSteadystate, SteadyStateSensitivityFactorization)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0});
+    model->setSteadyStateSensitivityMode(
+        amici::SteadyStateSensitivityMode::newtonOnly);
+
+    amici::ExpData edata(*model);
+    edata.fixedParametersPreequilibration = model->getFixedParameters();
+    edata.setObservedData(std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+
+    std::vector<double> sllh_ref;
+    for (auto linsol : {amici::LinearSolver::dense, amici::LinearSolver::KLU}) {
+        auto solver = model->getSolver();
+        solver->setLinearSolver(linsol);
+        solver->setNewtonMaxSteps(50);
+        auto rdata_nosensi = runAmiciSimulation(*solver, &edata, *model);
+
+        solver->setSensitivityOrder(amici::SensitivityOrder::first);
+        solver->setSensitivityMethod(amici::SensitivityMethod::forward);
+        auto rdata_fwd = runAmiciSimulation(*solver, &edata, *model);
+        solver->setSensitivityMethod(amici::SensitivityMethod::adjoint);
+        solver->setSensitivityMethodPreequilibration(
+            amici::SensitivityMethod::adjoint);
+        auto rdata_adj = runAmiciSimulation(*solver, &edata, *model);
+
+        // the transposed solve for the adjoint quadratures factorizes the
+        // Jacobian at the steady state only once, as do the sensitivities
+        ASSERT_EQ(rdata_nosensi->preeq_numfactorizations + 1,
+                  rdata_fwd->preeq_numfactorizations);
+        ASSERT_EQ(rdata_nosensi->preeq_numfactorizations + 1,
+                  rdata_adj->preeq_numfactorizations);
+
+        amici::checkEqualArray(rdata_fwd->sllh, rdata_adj->sllh, 1e-5, 1e-3,
+                               "sllh");
+        if (sllh_ref.empty())
+            sllh_ref = rdata_adj->sllh;
+        else
+            amici::checkEqualArray(sllh_ref, rdata_adj->sllh, TEST_ATOL,
+                                   TEST_RTOL, "sllh");
+    }
+}
+
+TEST(ExampleSteadystate, PreequilibrationCache)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0});
+    auto solver = model->getSolver();
+    solver->setNewtonMaxSteps(50);
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+
+    amici::ExpData edata(*model);
+    edata.fixedParametersPreequilibration = model->getFixedParameters();
+    edata.setObservedData(std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+
+    // the first two conditions share their preequilibration, the others
+    // differ in initial states, initial state sensitivities and plist
+    std::vector<amici::ExpData> edatas(5, edata);
+    edatas[2].x0 = std::vector<double>(model->nx_rdata, 1.0);
+    edatas[3].sx0 = std::vector<double>(model->nx_rdata * model->nplist(), 1.0);
+    edatas[4].plist = {0, 1};
+    std::vector<amici::ExpData *> edata_ptrs;
+    for (auto &e : edatas)
+        edata_ptrs.push_back(&e);
+
+    auto preeq_work = [](amici::ReturnData const &rdata) {
+        return std::accumulate(rdata.preeq_numsteps.begin(),
+                               rdata.preeq_numsteps.end(), 0)
+               + rdata.preeq_numfactorizations;
+    };
+
+    for (auto sensi_meth : {amici::SensitivityMethod::forward,
+                            amici::SensitivityMethod::adjoint}) {
+        solver->setSensitivityMethod(sensi_meth);
+        solver->setSensitivityMethodPreequilibration(sensi_meth);
+        amici::AmiciApplication app;
+        auto rdatas = app.runAmiciSimulations(*solver, edata_ptrs, *model,
+                                              false, 1);
+        for (auto const &rdata : rdatas)
+            ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+
+        // cache hit: same results, no work reported for the forward problem
+        amici::checkEqualArray(rdatas[0]->x, rdatas[1]->x, 0.0, 0.0, "x");
+        amici::checkEqualArray(rdatas[0]->sllh, rdatas[1]->sllh, TEST_ATOL,
+                               TEST_RTOL, "sllh");
+        ASSERT_GT(preeq_work(*rdatas[0]), 0);
+        ASSERT_EQ(0.0, rdatas[1]->preeq_cpu_time);
+        if (sensi_meth == amici::SensitivityMethod::forward) {
+            ASSERT_EQ(0, preeq_work(*rdatas[1]));
+        } else {
+            // only the factorization for the backward problem
+            ASSERT_EQ(1, preeq_work(*rdatas[1]));
+        }
+
+        // cache misses
+        for (int i = 2; i < 5; ++i)
+            ASSERT_GT(preeq_work(*rdatas[i]), 0);
+    }
+
+    // failed preequilibrations are not cached, and reported for every
+    // condition
+    solver->setSensitivityOrder(amici::SensitivityOrder::none);
+    solver->setNewtonMaxSteps(0);
+    solver->setMaxSteps(1);
+    amici::AmiciApplication app;
+    auto rdatas = app.runAmiciSimulations(
+        *solver, {edata_ptrs[0], edata_ptrs[1]}, *model, false, 1);
+    for (auto const &rdata : rdatas)
+        ASSERT_GT(0, rdata->status);
+}
+
+TEST(ExampleSteadystate, AggregatedFailfast)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0});
+    auto solver = model->getSolver();
+    solver->setMaxSteps(1);
+
+    amici::ExpData edata(*model);
+    std::vector<amici::ExpData *> edata_ptrs(3, &edata);
+
+    // conditions skipped after the first failure are reported as not run
+    amici::AmiciApplication app;
+    auto result = app.runAmiciSimulationsAggregated(*solver, edata_ptrs,
+                                                    *model, true, 1);
+    ASSERT_TRUE(std::isnan(result.llh));
+    ASSERT_EQ(std::vector<int>({0, 1, 2}), result.failed_conditions);
+    ASSERT_EQ(result.status, result.failed_status);
+    ASSERT_GT(0, result.status[0]);
+    ASSERT_NE(amici::AMICI_NOT_RUN, result.status[0]);
+    ASSERT_EQ(amici::AMICI_NOT_RUN, result.status[1]);
+    ASSERT_EQ(amici::AMICI_NOT_RUN, result.status[2]);
+
+    // without failfast, all conditions are run
+    result = app.runAmiciSimulationsAggregated(*solver, edata_ptrs, *model,
+                                               false, 1);
+    ASSERT_EQ(3U, result.failed_status.size());
+    for (auto status : result.failed_status)
+        ASSERT_NE(amici::AMICI_NOT_RUN, status);
+}
+
+TEST(ExampleSteadystate, AggregatedParameterListMismatch)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0});
+    auto solver = model->getSolver();
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+
+    amici::ExpData edata(*model);
+    edata.setObservedData(std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    amici::AmiciApplication app;
+
+    // the model's parameter list, explicitly or implicitly
+    amici::ExpData same_plist(edata);
+    same_plist.plist = model->getParameterList();
+    auto result = app.runAmiciSimulationsAggregated(
+        *solver, {&edata, &same_plist}, *model, false, 1);
+    ASSERT_TRUE(result.failed_conditions.empty());
+    ASSERT_EQ(model->nplist(), result.nplist);
+
+    // sensitivities w.r.t. different parameters cannot be summed
+    amici::ExpData other_plist(edata);
+    other_plist.plist = {0};
+    ASSERT_THROW(app.runAmiciSimulationsAggregated(
+                     *solver, {&edata, &other_plist}, *model, false, 1),
+                 amici::AmiException);
+
+    amici::ExpData other_pscale(edata);
+    other_pscale.pscale = std::vector<amici::ParameterScaling>(
+        model->np(), amici::ParameterScaling::log10);
+    if (other_pscale.pscale == model->getParameterScale())
+        other_pscale.pscale.assign(model->np(),
+                                   amici::ParameterScaling::none);
+    ASSERT_THROW(app.runAmiciSimulationsAggregated(
+                     *solver, {&edata, &other_pscale}, *model, false, 1),
+                 amici::AmiException);
+}
+
+TEST(ExampleSteadystate, SchedulingOrder)
+{
+    auto model = amici::generic_model::getModel();
+    auto solver = model->getSolver();
+
+    amici::ExpData cheap(*model);
+    cheap.setTimepoints({1.0});
+    amici::ExpData expensive(*model);
+    std::vector<double> timepoints(2000);
+    for (int it = 0; it < static_cast<int>(timepoints.size()); ++it)
+        timepoints[it] = 0.5 * it;
+    expensive.setTimepoints(timepoints);
+
+    amici::AmiciApplication app;
+    app.runAmiciSimulations(*solver, {&cheap, &expensive}, *model, false, 1);
+    auto utilization = app.getThreadUtilization();
+    // no recorded costs yet, so conditions are started in the given order
+    ASSERT_EQ(std::vector<int>({0, 1}), utilization.order);
+    ASSERT_EQ(1U, utilization.num_simulations.size());
+    ASSERT_EQ(2, utilization.num_simulations[0]);
+    ASSERT_GT(utilization.busy_time[0], 0.0);
+    ASSERT_LE(utilization.busy_time[0], utilization.wall_time);
+
+    // costs are recorded per condition, not per position, and do not depend
+    // on the parameters or data
+    amici::ExpData cheap2(cheap);
+    cheap2.parameters = model->getParameters();
+    cheap2.parameters[0] *= 1.1;
+    cheap2.setObservedData(std::vector<double>(cheap2.nytrue(), 1.0));
+    amici::ExpData unknown(cheap);
+    unknown.fixedParameters = model->getFixedParameters();
+    unknown.fixedParameters[0] *= 1.5;
+    app.runAmiciSimulations(*solver, {&cheap2, &expensive, &unknown}, *model,
+                            false, 1);
+    ASSERT_EQ(std::vector<int>({2, 1, 0}), app.getThreadUtilization().order);
+
+    // conditions with an id are identified by their id only
+    amici::ExpData labelled(expensive);
+    labelled.id = "c";
+    app.runAmiciSimulations(*solver, {&cheap, &labelled}, *model, false, 1);
+    ASSERT_EQ(std::vector<int>({1, 0}), app.getThreadUtilization().order);
+    labelled.setTimepoints({1.0});
+    app.runAmiciSimulations(*solver, {&cheap, &labelled}, *model, false, 1);
+    ASSERT_EQ(std::vector<int>({1, 0}), app.getThreadUtilization().order);
+
+    app.resetSimulationCosts();
+    app.runAmiciSimulations(*solver, {&cheap, &expensive}, *model, false, 1);
+    ASSERT_EQ(std::vector<int>({0, 1}), app.getThreadUtilization().order);
+}
+
+TEST(ExampleSteadystate, ReusedModelSolverPair)
+{
+    auto model = amici::generic_model::getModel();
+    auto solver = model->getSolver();
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+    solver->setSensitivityMethod(amici::SensitivityMethod::forward);
+
+    // the first condition changes initial states, sensitivities w.r.t. a
+    // subset of parameters and a later final timepoint, the others rely on
+    // the defaults of the template model
+    amici::ExpData custom(*model);
+    custom.setTimepoints({1.0, 10.0, 100.0});
+    custom.fixedParameters = model->getFixedParameters();
+    custom.fixedParameters[0] *= 1.5;
+    custom.x0 = std::vector<double>(model->nx_rdata, 1.0);
+    custom.plist = {0, 2};
+    custom.sx0 = std::vector<double>(model->nx_rdata * custom.plist.size(),
+                                     0.5);
+    amici::ExpData plain(*model);
+    plain.setTimepoints({1.0, 10.0});
+    amici::ExpData preeq(plain);
+    preeq.fixedParametersPreequilibration = model->getFixedParameters();
+    std::vector<amici::ExpData *> edatas {&custom, &plain, &preeq};
+
+    // all conditions run on the same pair
+    auto rdatas = runAmiciSimulations(*solver, edatas, *model, false, 1);
+    ASSERT_EQ(edatas.size(), rdatas.size());
+    for (int i = 0; i < static_cast<int>(edatas.size()); ++i) {
+        auto fresh_model = std::unique_ptr<amici::Model>(model->clone());
+        auto fresh_solver = std::unique_ptr<amici::Solver>(solver->clone());
+        auto expected = runAmiciSimulation(*fresh_solver, edatas[i],
+                                           *fresh_model);
+        ASSERT_EQ(amici::AMICI_SUCCESS, expected->status);
+        ASSERT_EQ(expected->status, rdatas[i]->status);
+        ASSERT_EQ(expected->numsteps, rdatas[i]->numsteps);
+        ASSERT_EQ(expected->ts, rdatas[i]->ts);
+        amici::checkEqualArray(expected->x, rdatas[i]->x, 0.0, 0.0, "x");
+        amici::checkEqualArray(expected->sx, rdatas[i]->sx, 0.0, 0.0, "sx");
+        amici::checkEqualArray(expected->x_ss, rdatas[i]->x_ss, 0.0, 0.0,
+                               "x_ss");
+    }
+}
+
+TEST(ExampleSteadystate, InterpolatedOutput)
+{
+    auto model = amici::generic_model::getModel();
+    std::vector<double> timepoints(1000);
+    for (int it = 0; it < static_cast<int>(timepoints.size()); ++it)
+        timepoints[it] = 0.1 * it;
+    timepoints.push_back(INFINITY);
+    model->setTimepoints(timepoints);
+    auto solver = model->getSolver();
+    solver->setSensitivityOrder(amici::SensitivityOrder::first);
+    solver->setSensitivityMethod(amici::SensitivityMethod::forward);
+
+    amici::ExpData edata(*model);
+    edata.setObservedData(std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+    edata.setObservedDataStdDev(
+        std::vector<double>(edata.nt() * edata.nytrue(), 1.0));
+
+    auto rdata_stop = runAmiciSimulation(*solver, &edata, *model);
+    solver->setInterpolatedOutput(true);
+    auto rdata = runAmiciSimulation(*solver, &edata, *model);
+
+    ASSERT_EQ(amici::AMICI_SUCCESS, rdata_stop->status);
+    ASSERT_EQ(amici::AMICI_SUCCESS, rdata->status);
+    ASSERT_EQ(0, rdata_stop->numinterpolatedoutputs);
+    ASSERT_GT(rdata->numinterpolatedoutputs, 0);
+    // numsteps at the last finite timepoint
+    auto const it_last = timepoints.size() - 2;
+    ASSERT_LT(rdata->numsteps.at(it_last), rdata_stop->numsteps.at(it_last));
+
+    // the interpolation error is of the order of the local error, but the
+    // different steps also change the global error
+    amici::checkEqualArray(rdata_stop->x, rdata->x, TEST_ATOL, TEST_RTOL,
+                           "x");
+    amici::checkEqualArray(rdata_stop->sx, rdata->sx, TEST_ATOL, TEST_RTOL,
+                           "sx");
+    amici::checkEqualArray(rdata_stop->y, rdata->y, TEST_ATOL, TEST_RTOL,
+                           "y");
+    amici::checkEqualArray(rdata_stop->sy, rdata->sy, TEST_ATOL, TEST_RTOL,
+                           "sy");
+    amici::checkEqualArray(rdata_stop->x_ss, rdata->x_ss, TEST_ATOL, TEST_RTOL,
+                           "x_ss");
+    amici::checkEqualArray(rdata_stop->sllh, rdata->sllh, TEST_ATOL, TEST_RTOL,
+                           "sllh");
+    ASSERT_NEAR(rdata_stop->llh, rdata->llh,
+                TEST_ATOL + TEST_RTOL * std::abs(rdata_stop->llh));
+}
+
+TEST(ExampleSteadystate, SteadyStateWarmStart)
+{
+    auto model = amici::generic_model::getModel();
+    model->setTimepoints({1.0, 10.0});
+    auto solver = model->getSolver();
+    solver->setNewtonMaxSteps(50);
+    auto warm_solver = std::unique_ptr<amici::Solver>(solver->clone());
+    warm_solver->setSteadyStateWarmStartMode(
+        amici::SteadyStateWarmStartMode::previous);
+
+    amici::ExpData edata(*model);
+    edata.fixedParametersPreequilibration = model->getFixedParameters();
+    auto const p = model->getParameters();
+
+    auto newton_steps = [&](amici::Solver &s, amici::ExpData &e) {
+        auto rdata = runAmiciSimulation(s, &e, *model);
+        EXPECT_EQ(amici::AMICI_SUCCESS, rdata->status);
+        EXPECT_EQ(amici::SteadyStateStatus::success, rdata->preeq_status[0]);
+        return rdata->preeq_numsteps[0];
+    };
+
+    // store the steady state, then restart from it for other parameters
+    newton_steps(*warm_solver, edata);
+    auto p_new = p;
+    for (auto &pi : p_new)
+        pi *= 1.01;
+    model->setParameters(p_new);
+    auto cold = newton_steps(*solver, edata);
+    ASSERT_LT(newton_steps(*warm_solver, edata), cold);
+
+    // conditions with other initial states, initial time or parameter list
+    // do not use the stored steady state
+    model->setParameters(p);
+    amici::ExpData other_x0(edata);
+    other_x0.x0 = std::vector<double>(model->nx_rdata, 1.0);
+    amici::ExpData other_plist(edata);
+    other_plist.plist = {0};
+    for (auto *e : {&other_x0, &other_plist})
+        ASSERT_EQ(newton_steps(*solver, *e), newton_steps(*warm_solver, *e));
+    model->setT0(-1.0);
+    ASSERT_EQ(newton_steps(*solver, edata),
+              newton_steps(*warm_solver, edata));
+    model->setT0(0.0);
+
+    // other fixed parameters
+    amici::ExpData other_k(edata);
+    other_k.fixedParametersPreequilibration[0] *= 1.5;
+    ASSERT_EQ(newton_steps(*solver, other_k),
+              newton_steps(*warm_solver, other_k));
+}
@@ -3,13 +3,20 @@
 #include <amici/amici.h>
 #include <amici/forwardproblem.h>
 #include <amici/model_ode.h>
+#include <amici/preconditioner.h>
 #include <amici/solver_cvodes.h>
 #include <amici/solver_idas.h>
+#include <amici/spline.h>
 #include <amici/symbolic_functions.h>
 
+#include <idas/idas.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunmatrix/sunmatrix_dense.h>
+
 #include <cmath>
 #include <cstring>
 #include <exception>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -231,6 +238,102 @@ TEST(SymbolicFunctionsTest, pos_pow)
     ASSERT_EQ(pow(0.1, 3), pos_pow(0.1, 3));
 }
 
+TEST(SymbolicFunctionsTest, Spline)
+{
+    std::vector<double> ts {0.0, 1.0, 2.5, 4.0};
+    std::vector<double> us {1.0, 3.0, 2.0, 5.0};
+    std::vector<double> b(ts.size()), c(ts.size()), d(ts.size());
+    spline(4, 1, 0, 0.5, 0.0, ts.data(), us.data(), b.data(), c.data(),
+           d.data());
+
+    CubicSpline cached(ts, us, true, 0.5);
+    for (double t : {-1.0, 0.0, 0.3, 1.0, 2.0, 3.9, 4.0, 5.0}) {
+        auto expected = seval(4, t, ts.data(), us.data(), b.data(), c.data(),
+                              d.data());
+        ASSERT_EQ(expected, cached.evaluate(t));
+        ASSERT_EQ(expected, spline(t, 4, ts[0], us[0], ts[1], us[1], ts[2],
+                                   us[2], ts[3], us[3], 1.0, 0.5));
+    }
+
+    // changed values must not reuse stale coefficients
+    ASSERT_DOUBLE_EQ(6.0, spline(4.0, 4, ts[0], us[0], ts[1], us[1], ts[2],
+                                 us[2], ts[3], 6.0, 1.0, 0.5));
+
+    // spline is linear in the values: derivative w.r.t. the value at the
+    // second knot (id 6) is the spline through the second unit vector
+    // (without slope at the first knot)
+    std::vector<double> e1 {0.0, 1.0, 0.0, 0.0};
+    CubicSpline unit(ts, e1, true, 0.0);
+    for (double t : {0.3, 1.0, 3.0}) {
+        ASSERT_EQ(unit.evaluate(t),
+                  Dspline(6, t, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2],
+                          ts[3], us[3], 1.0, 0.0));
+        auto u = spline_pos(t, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2],
+                            ts[3], us[3], 1.0, 0.0);
+        ASSERT_DOUBLE_EQ(unit.evaluate(t) * u / us[1],
+                         Dspline_pos(6, t, 4, ts[0], us[0], ts[1], us[1],
+                                     ts[2], us[2], ts[3], us[3], 1.0, 0.0));
+    }
+}
+
+TEST(SymbolicFunctionsTest, SplinesOnSharedKnots)
+{
+    std::vector<double> ts {0.0, 1.0, 2.5, 4.0};
+    std::vector<double> us {1.0, 3.0, 2.0, 5.0};
+    std::vector<double> vs {4.0, 0.5, 1.5, 2.0};
+    CubicSpline u_spline(ts, us, false, 0.0);
+    CubicSpline v_spline(ts, vs, false, 0.0);
+
+    // interleaved evaluation of different splines on the same knots, with
+    // enough other splines in between to evict some cache entries
+    for (int i = 0; i < 200; ++i) {
+        double t = 0.02 * i;
+        ASSERT_EQ(u_spline.evaluate(t),
+                  spline(t, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2],
+                         ts[3], us[3], 0.0, 0.0));
+        ASSERT_EQ(v_spline.evaluate(t),
+                  spline(t, 4, ts[0], vs[0], ts[1], vs[1], ts[2], vs[2],
+                         ts[3], vs[3], 0.0, 0.0));
+        double w = 1.0 + i;
+        ASSERT_DOUBLE_EQ(w, spline(ts[2], 4, ts[0], us[0], ts[1], us[1],
+                                   ts[2], w, ts[3], us[3], 0.0, 0.0));
+    }
+}
+
+TEST(SymbolicFunctionsTest, SplineCacheHits)
+{
+    std::vector<double> ts {0.0, 1.0, 2.5, 4.0};
+    std::vector<double> us {1.0, 3.0, 2.0, 7.0};
+
+    auto hits = getSplineCacheHits();
+    auto misses = getSplineCacheMisses();
+    auto first = spline(0.5, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2],
+                        ts[3], us[3], 0.0, 0.0);
+    ASSERT_EQ(hits, getSplineCacheHits());
+    ASSERT_EQ(misses + 1, getSplineCacheMisses());
+
+    // same arguments reuse the coefficients
+    ASSERT_EQ(first, spline(0.5, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2],
+                            ts[3], us[3], 0.0, 0.0));
+    ASSERT_EQ(hits + 1, getSplineCacheHits());
+    ASSERT_EQ(misses + 1, getSplineCacheMisses());
+
+    // different values do not
+    spline(0.5, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2], ts[3], 8.0, 0.0,
+           0.0);
+    ASSERT_EQ(hits + 1, getSplineCacheHits());
+    ASSERT_EQ(misses + 2, getSplineCacheMisses());
+
+    // derivatives w.r.t. different values share the splines through the unit
+    // vectors, which only depend on the knots
+    Dspline(6, 0.5, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2], ts[3], us[3],
+            0.0, 0.0);
+    Dspline(6, 0.5, 4, ts[0], us[0], ts[1], us[1], ts[2], us[2], ts[3], 8.0,
+            0.0, 0.0);
+    ASSERT_EQ(hits + 2, getSplineCacheHits());
+    ASSERT_EQ(misses + 3, getSplineCacheMisses());
+}
+
 TEST(SolverTestBasic, Equality)
 {
     IDASolver i1, i2;
@@ -258,6 +361,94 @@ TEST(SolverIdasTest, DefaultConstructableAndNotLeaky)
     IDASolver solver;
 }
 
+/**
+ * @brief Residual of y' = -p y^2
+ */
+static int spillTestResidual(realtype /*t*/, N_Vector y, N_Vector yp,
+                             N_Vector res, void *user_data) {
+    auto p = *static_cast<realtype *>(user_data);
+    NV_Ith_S(res, 0) = NV_Ith_S(yp, 0) + p * NV_Ith_S(y, 0) * NV_Ith_S(y, 0);
+    return 0;
+}
+
+/**
+ * @brief Residual of the adjoint equation of y' = -p y^2
+ */
+static int spillTestResidualB(realtype /*t*/, N_Vector y, N_Vector /*yp*/,
+                              N_Vector yB, N_Vector ypB, N_Vector resB,
+                              void *user_data) {
+    auto p = *static_cast<realtype *>(user_data);
+    NV_Ith_S(resB, 0) =
+        NV_Ith_S(ypB, 0) - 2.0 * p * NV_Ith_S(y, 0) * NV_Ith_S(yB, 0);
+    return 0;
+}
+
+/**
+ * @brief Computes dy(tf)/dy(0) for y' = -p y^2, y(0) = 1 with the IDAS
+ * adjoint module, using a checkpoint every 5 steps
+ * @param spill whether to spill checkpoints to the scratch file
+ * @param ncheck number of checkpoints
+ * @return adjoint state at t = 0
+ */
+static realtype solveSpillTestAdjoint(bool spill, int &ncheck) {
+    realtype p = 1.0;
+    realtype tf = 10.0;
+    realtype tret;
+    AmiVector y(std::vector<realtype>{1.0});
+    AmiVector yp(std::vector<realtype>{-p});
+
+    void *ida_mem = IDACreate();
+    EXPECT_EQ(IDA_SUCCESS, IDAInit(ida_mem, spillTestResidual, 0.0,
+                                   y.getNVector(), yp.getNVector()));
+    EXPECT_EQ(IDA_SUCCESS, IDASStolerances(ida_mem, 1e-8, 1e-10));
+    EXPECT_EQ(IDA_SUCCESS, IDASetUserData(ida_mem, &p));
+    SUNMatrix A = SUNDenseMatrix(1, 1);
+    SUNLinearSolver LS = SUNLinSol_Dense(y.getNVector(), A);
+    EXPECT_EQ(IDA_SUCCESS, IDASetLinearSolver(ida_mem, LS, A));
+    EXPECT_EQ(IDA_SUCCESS, IDAAdjInit(ida_mem, 5, IDA_HERMITE));
+    EXPECT_EQ(IDA_SUCCESS, IDAAdjSetSpillCheckpoints(ida_mem, spill));
+    EXPECT_EQ(IDA_SUCCESS,
+              IDASolveF(ida_mem, tf, &tret, y.getNVector(), yp.getNVector(),
+                        IDA_NORMAL, &ncheck));
+
+    int which;
+    AmiVector yB(std::vector<realtype>{1.0});
+    AmiVector ypB(std::vector<realtype>{2.0 * p * y.at(0)});
+    EXPECT_EQ(IDA_SUCCESS, IDACreateB(ida_mem, &which));
+    EXPECT_EQ(IDA_SUCCESS, IDAInitB(ida_mem, which, spillTestResidualB, tf,
+                                    yB.getNVector(), ypB.getNVector()));
+    EXPECT_EQ(IDA_SUCCESS, IDASStolerancesB(ida_mem, which, 1e-8, 1e-10));
+    EXPECT_EQ(IDA_SUCCESS, IDASetUserDataB(ida_mem, which, &p));
+    SUNMatrix AB = SUNDenseMatrix(1, 1);
+    SUNLinearSolver LSB = SUNLinSol_Dense(yB.getNVector(), AB);
+    EXPECT_EQ(IDA_SUCCESS, IDASetLinearSolverB(ida_mem, which, LSB, AB));
+    EXPECT_EQ(IDA_SUCCESS, IDASolveB(ida_mem, 0.0, IDA_NORMAL));
+    EXPECT_EQ(IDA_SUCCESS, IDAGetB(ida_mem, which, &tret, yB.getNVector(),
+                                   ypB.getNVector()));
+
+    IDAFree(&ida_mem);
+    SUNLinSolFree(LS);
+    SUNLinSolFree(LSB);
+    SUNMatDestroy(A);
+    SUNMatDestroy(AB);
+    return yB.at(0);
+}
+
+TEST(SolverIdasTest, CheckpointSpill)
+{
+    int ncheck_memory;
+    auto yB_memory = solveSpillTestAdjoint(false, ncheck_memory);
+    int ncheck_spill;
+    auto yB_spill = solveSpillTestAdjoint(true, ncheck_spill);
+
+    // the backward problem passes through several checkpoints, which are
+    // read back from the scratch file when spilling
+    ASSERT_GT(ncheck_spill, 2);
+    ASSERT_EQ(ncheck_memory, ncheck_spill);
+    ASSERT_EQ(yB_memory, yB_spill);
+    ASSERT_NEAR(1.0 / (11.0 * 11.0), yB_spill, 1e-5 / (11.0 * 11.0));
+}
+
 
 class SolverTest : public ::testing::Test {
   protected:
@@ -490,6 +681,36 @@ TEST_F(AmiVectorTest, VectorArray)
     }
 }
 
+TEST_F(AmiVectorTest, VectorArrayContiguous)
+{
+    AmiVectorArray ava(4, 3);
+    ava[0] = AmiVector(vec1);
+    ava[1] = AmiVector(vec2);
+    ava[2] = AmiVector(vec3);
+    ASSERT_THROW(ava[0] = AmiVector(3), AmiException);
+
+    // column-major block, N_Vectors are views on the columns
+    auto block = ava.data();
+    ASSERT_EQ(12, block.size());
+    for (int i = 0; i < ava.getLength(); ++i) {
+        ASSERT_EQ(block.data() + i * 4, ava.data(i));
+        ASSERT_EQ(ava.data(i), N_VGetArrayPointer(ava.getNVector(i)));
+    }
+    ASSERT_EQ(vec2.at(3), block[1 * 4 + 3]);
+
+    // copies of elements own their data
+    auto copy = ava[1];
+    copy.zero();
+    ASSERT_EQ(vec2.at(0), ava.at(0, 1));
+
+    // assignment with matching dimensions keeps the N_Vectors valid
+    auto nvec = ava.getNVector(2);
+    AmiVectorArray other(4, 3);
+    ava = other;
+    ASSERT_EQ(nvec, ava.getNVector(2));
+    ASSERT_EQ(0.0, NV_Ith_S(nvec, 1));
+}
+
 class SunMatrixWrapperTest : public ::testing::Test {
   protected:
     void SetUp() override {
@@ -553,6 +774,26 @@ TEST_F(SunMatrixWrapperTest, SparseMultiplyEmpty)
     ASSERT_TRUE(c[0] == 0.1);
 }
 
+TEST_F(SunMatrixWrapperTest, BlockMultiply)
+{
+    // C += A * [b, 2b] for row-major B and C
+    std::vector<double> B_block{b[0], 2 * b[0], b[1], 2 * b[1]};
+    std::vector<double> C_block{a[0], a[0], a[1], a[1], a[2], a[2]};
+    std::vector<double> expected(C_block);
+    for (int irow = 0; irow < 3; ++irow)
+        for (int k = 0; k < 2; ++k)
+            expected[irow * 2 + k] += (k + 1) * (d[irow] - a[irow]);
+
+    auto C(C_block);
+    A.multiply_block(C, B_block, 2);
+    checkEqualArray(expected, C, TEST_ATOL, TEST_RTOL, "multiply_block");
+
+    C = C_block;
+    auto A_sparse = SUNMatrixWrapper(A, 0.0, CSC_MAT);
+    A_sparse.multiply_block(C, B_block, 2);
+    checkEqualArray(expected, C, TEST_ATOL, TEST_RTOL, "multiply_block");
+}
+
 TEST_F(SunMatrixWrapperTest, DenseMultiply)
 {
     auto c(a); //copy c
@@ -600,4 +841,143 @@ TEST_F(SunMatrixWrapperTest, BlockTranspose)
                   SM_INDEXPTRS_S(B_sparse.get())[icol]);
 }
 
+TEST_F(SunMatrixWrapperTest, SparseOperationPatterns)
+{
+    SUNMatrixWrapper Bt(4, 4, 7, CSC_MAT);
+    B.transpose(Bt, 1.0, 4);
+
+    auto checkEqualDense = [](SUNMatrixWrapper const &expected,
+                              SUNMatrixWrapper const &actual) {
+        SUNMatrixWrapper expected_dense(4, 4);
+        SUNMatrixWrapper actual_dense(4, 4);
+        expected.to_dense(expected_dense);
+        actual.to_dense(actual_dense);
+        ASSERT_EQ(expected.num_nonzeros(), actual.num_nonzeros());
+        checkEqualArray(expected_dense.data(), actual_dense.data(), 16,
+                        TEST_ATOL, TEST_RTOL, "pattern");
+    };
+
+    auto multiply_pattern = B.sparse_multiply_pattern(Bt);
+    auto sum_pattern = SUNMatrixWrapper::sparse_sum_pattern({&B, &Bt});
+
+    // patterns remain valid if only values change
+    for (auto scale : {1.0, -2.0}) {
+        B.scale(scale);
+
+        SUNMatrixWrapper C(4, 4, 7, CSC_MAT);
+        SUNMatrixWrapper C_pattern(4, 4, 0, CSC_MAT);
+        B.sparse_multiply(C, Bt);
+        B.sparse_multiply(C_pattern, Bt, multiply_pattern);
+        checkEqualDense(C, C_pattern);
+
+        SUNMatrixWrapper D(4, 4, 0, CSC_MAT);
+        SUNMatrixWrapper D_pattern(4, 4, 0, CSC_MAT);
+        D.sparse_add(B, 1.0, Bt, scale);
+        D_pattern.sparse_add(B, 1.0, Bt, scale, sum_pattern);
+        checkEqualDense(D, D_pattern);
+
+        std::vector<SUNMatrixWrapper> mats {B, Bt};
+        SUNMatrixWrapper E(4, 4, 0, CSC_MAT);
+        SUNMatrixWrapper E_pattern(4, 4, 0, CSC_MAT);
+        E.sparse_sum(mats);
+        E_pattern.sparse_sum(mats, sum_pattern);
+        checkEqualDense(E, E_pattern);
+    }
+
+    // patterns are rejected if the structure of the operands changed
+    SUNMatrixWrapper I_dense(4, 4);
+    for (int i = 0; i < 4; ++i)
+        I_dense.set_data(i, i, 1.0);
+    SUNMatrixWrapper I(I_dense, 0.0, CSC_MAT);
+    ASSERT_EQ(4, I.num_nonzeros());
+
+    SUNMatrixWrapper C(4, 4, 0, CSC_MAT);
+    ASSERT_THROW(B.sparse_multiply(C, I, multiply_pattern), AmiException);
+    ASSERT_THROW(C.sparse_add(B, 1.0, I, 1.0, sum_pattern), AmiException);
+    std::vector<SUNMatrixWrapper> mats {B, I};
+    ASSERT_THROW(C.sparse_sum(mats, sum_pattern), AmiException);
+    std::vector<SUNMatrixWrapper> too_many_mats {B, Bt, I};
+    ASSERT_THROW(C.sparse_sum(too_many_mats, sum_pattern), AmiException);
+}
+
+TEST_F(SunMatrixWrapperTest, SparseOperationPatternCache)
+{
+    auto cache = std::make_shared<SparseOperationPatternCache>();
+    auto shared_cache = cache;
+
+    // compute once from several threads, then reuse
+    int ncomputed = 0;
+    auto compute = [&]() {
+        ++ncomputed;
+        return B.sparse_multiply_pattern(B);
+    };
+    std::vector<std::shared_ptr<const SparseOperationPattern>> patterns(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&, i]() {
+            patterns[i] = (i % 2 ? cache : shared_cache)->get("BB", compute);
+        });
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(ncomputed, 1);
+    for (auto const &pattern : patterns)
+        ASSERT_EQ(pattern, patterns.at(0));
+
+    cache->get("B+B", [&]() {
+        return SUNMatrixWrapper::sparse_sum_pattern({&B, &B});
+    });
+    ASSERT_EQ(shared_cache->size(), 2);
+    ASSERT_EQ(ncomputed, 1);
+}
+
+TEST_F(SunMatrixWrapperTest, Preconditioners)
+{
+    // M = alpha * I + beta * B
+    realtype alpha = 10.0;
+    realtype beta = -0.5;
+    std::vector<double> z_expected{1.0, -2.0, 3.0, 0.5};
+    std::vector<double> r(4, 0.0);
+    B.multiply(r, z_expected, beta);
+    for (int i = 0; i < 4; ++i)
+        r[i] += alpha * z_expected[i];
+
+    // block-Jacobi with a single block is an exact LU decomposition
+    auto block_jacobi = Preconditioner::create(PreconditionerType::blockJacobi,
+                                               4, 7);
+    block_jacobi->getJacobian() = B;
+    ASSERT_EQ(block_jacobi->setup(alpha, beta), AMICI_SUCCESS);
+    std::vector<double> z(4, 0.0);
+    block_jacobi->solve(r, z);
+    checkEqualArray(z_expected, z, TEST_ATOL, TEST_RTOL, "blockJacobi");
+
+    auto jacobi = Preconditioner::create(PreconditionerType::jacobi, 4, 7);
+    jacobi->getJacobian() = B;
+    ASSERT_EQ(jacobi->setup(alpha, beta), AMICI_SUCCESS);
+    jacobi->solve(r, z);
+    std::vector<double> z_jacobi{r[0] / alpha, r[1] / alpha, r[2] / alpha,
+                                 r[3] / (alpha + beta * 9)};
+    checkEqualArray(z_jacobi, z, TEST_ATOL, TEST_RTOL, "jacobi");
+
+    // ILU(0) is exact without fill-in, e.g. for tridiagonal matrices
+    SUNMatrixWrapper T(4, 4, 10, CSC_MAT);
+    T.set_indexptrs(std::vector<sunindextype>{0, 2, 5, 8, 10});
+    T.set_indexvals(
+        std::vector<sunindextype>{0, 1, 0, 1, 2, 1, 2, 3, 2, 3});
+    for (int idx = 0; idx < 10; ++idx)
+        T.set_data(idx, 1.0 + idx);
+    std::fill(r.begin(), r.end(), 0.0);
+    T.multiply(r, z_expected);
+
+    auto ilu = Preconditioner::create(PreconditionerType::ILU, 4, 10);
+    ilu->getJacobian() = T;
+    ASSERT_EQ(ilu->setup(0.0, 1.0), AMICI_SUCCESS);
+    ilu->solve(r, z);
+    checkEqualArray(z_expected, z, TEST_ATOL, TEST_RTOL, "ILU");
+
+    // zero pivots are recoverable errors
+    ASSERT_EQ(jacobi->setup(0.0, 1.0), AMICI_RECOVERABLE_ERROR);
+    ASSERT_EQ(Preconditioner::create(PreconditionerType::none, 4, 7),
+              nullptr);
+}
+
 } // namespace
@@ -63,6 +63,9 @@ checkReturnDataEqual(amici::ReturnData const& r, amici::ReturnData const& s)
     ASSERT_EQ(r.order, s.order);
     ASSERT_EQ(r.cpu_time, s.cpu_time);
     ASSERT_EQ(r.cpu_timeB, s.cpu_timeB);
+    ASSERT_EQ(r.numcheckpoints, s.numcheckpoints);
+    ASSERT_EQ(r.numrecomputedrhsevals, s.numrecomputedrhsevals);
+    ASSERT_EQ(r.numinterpolatedoutputs, s.numinterpolatedoutputs);
 
     ASSERT_EQ(r.preeq_status, s.preeq_status);
     ASSERT_TRUE(r.preeq_t == s.preeq_t ||
@@ -71,6 +74,10 @@ checkReturnDataEqual(amici::ReturnData const& r, amici::ReturnData const& s)
                 (std::isnan(r.preeq_wrms) && std::isnan(s.preeq_wrms)));
     ASSERT_EQ(r.preeq_numsteps, s.preeq_numsteps);
     ASSERT_EQ(r.preeq_numlinsteps, s.preeq_numlinsteps);
+    ASSERT_EQ(r.preeq_numjacevals, s.preeq_numjacevals);
+    ASSERT_EQ(r.preeq_numfactorizations, s.preeq_numfactorizations);
+    ASSERT_EQ(r.preeq_ptc_numsteps, s.preeq_ptc_numsteps);
+    ASSERT_EQ(r.preeq_ptc_numlinsolves, s.preeq_ptc_numlinsolves);
     EXPECT_NEAR(r.preeq_cpu_time, s.preeq_cpu_time, 1e-16);
 
     ASSERT_EQ(r.posteq_status, s.posteq_status);
@@ -80,6 +87,10 @@ checkReturnDataEqual(amici::ReturnData const& r, amici::ReturnData const& s)
                 (std::isnan(r.posteq_wrms) && std::isnan(s.posteq_wrms)));
     ASSERT_EQ(r.posteq_numsteps, s.posteq_numsteps);
     ASSERT_EQ(r.posteq_numlinsteps, s.posteq_numlinsteps);
+    ASSERT_EQ(r.posteq_numjacevals, s.posteq_numjacevals);
+    ASSERT_EQ(r.posteq_numfactorizations, s.posteq_numfactorizations);
+    ASSERT_EQ(r.posteq_ptc_numsteps, s.posteq_ptc_numsteps);
+    ASSERT_EQ(r.posteq_ptc_numlinsolves, s.posteq_ptc_numlinsolves);
     EXPECT_NEAR(r.posteq_cpu_time, s.posteq_cpu_time, 1e-16);
 
     checkEqualArray(r.x0, s.x0, 1e-16, 1e-16, "x0");
@@ -91,6 +102,8 @@ checkReturnDataEqual(amici::ReturnData const& r, amici::ReturnData const& s)
 
     checkEqualArray(r.sllh, s.sllh, 1e-5, 1e-5, "sllh");
     checkEqualArray(r.s2llh, s.s2llh, 1e-5, 1e-5, "s2llh");
+    checkEqualArray(r.inner_parameters, s.inner_parameters, 1e-16, 1e-16,
+                    "inner_parameters");
 }
 
 class SolverSerializationTest : public ::testing::Test {
@@ -107,13 +120,22 @@ class SolverSerializationTest : public ::testing::Test {
         solver.setSensitivityOrder(amici::SensitivityOrder::second);
         solver.setMaxSteps(1e1);
         solver.setMaxStepsBackwardProblem(1e2);
+        solver.setCheckpointMemoryBudget(1e6);
+        solver.setCheckpointSpill(true);
         solver.setNewtonMaxSteps(1e3);
         solver.setNewtonMaxLinearSteps(1e4);
+        solver.setNewtonJacobianReuse(true);
+        solver.setSteadyStatePseudoTransientContinuation(true);
+        solver.setSteadyStateConcurrentSearch(true);
+        solver.setSteadyStateWarmStartMode(
+            amici::SteadyStateWarmStartMode::firstOrder);
         solver.setPreequilibration(true);
         solver.setStateOrdering(static_cast<int>(amici::SUNLinSolKLU::StateOrdering::COLAMD));
         solver.setInterpolationType(amici::InterpolationType::polynomial);
         solver.setStabilityLimitFlag(false);
+        solver.setInterpolatedOutput(true);
         solver.setLinearSolver(amici::LinearSolver::dense);
+        solver.setPreconditionerType(amici::PreconditionerType::ILU);
         solver.setLinearMultistepMethod(amici::LinearMultistepMethod::adams);
         solver.setNonlinearSolverIteration(amici::NonlinearSolverIteration::newton);
         solver.setInternalSensitivityMethod(amici::InternalSensitivityMethod::staggered);